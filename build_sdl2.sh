@@ -6,19 +6,23 @@
 CC="gcc"
 # BUILD_INFO="RG:$(git describe) / SDL:$(sdl2-config --version)"
 CFLAGS="-no-pie -DRG_TARGET_SDL2 -DRETRO_GO -DCJSON_HIDE_SYMBOLS -DSDL_MAIN_HANDLED=1 -DRG_BUILD_INFO=\"SDL2\" -Dapp_main=SDL_Main $(sdl2-config --cflags)"
-INCLUDES="-Icomponents/retro-go -Icomponents/retro-go/libs/cJSON -Icomponents/retro-go/libs/lodepng"
+INCLUDES="-Icomponents/retro-go -Icomponents/retro-go/libs/cJSON -Icomponents/retro-go/libs/lodepng -Icomponents/retro-go/libs/netplay"
 SRCFILES="components/retro-go/*.c components/retro-go/drivers/audio/*.c components/retro-go/fonts/*.c
-		  components/retro-go/libs/cJSON/*.c components/retro-go/libs/lodepng/*.c"
+		  components/retro-go/libs/cJSON/*.c components/retro-go/libs/lodepng/*.c components/retro-go/libs/netplay/*.c"
 LIBS="$(sdl2-config --libs) -lstdc++"
 
 echo "Cleaning..."
-rm -f launcher.exe retro-core.exe gmon.out
+rm -rf launcher.exe retro-core.exe gmon.out build_sdl2
 
 echo "Building launcher..."
 $CC $CFLAGS $INCLUDES -Ilauncher/main $SRCFILES launcher/main/*.c $LIBS -o launcher.exe
 
+echo "Generating tables..."
+mkdir -p build_sdl2
+python3 retro-core/components/smsplus/gen_tables.py build_sdl2/render_lut.h
+
 echo "Building retro-core..."
-$CC $CFLAGS $INCLUDES \
+$CC $CFLAGS $INCLUDES -DSMS_GENERATED_LUTS -Ibuild_sdl2 \
 	-Iretro-core/components/gnuboy \
 	-Iretro-core/components/gw-emulator/src \
 	-Iretro-core/components/gw-emulator/src/cpus \
@@ -103,6 +103,23 @@
 #define RG_RECOVERY_BTN RG_KEY_ANY
 #endif
 
+// Polled gamepad drivers require a key to be stable for 3 reads (30ms), set to 0 to disable
+#ifndef RG_GAMEPAD_ADC_DEBOUNCE
+#define RG_GAMEPAD_ADC_DEBOUNCE 1
+#endif
+#ifndef RG_GAMEPAD_GPIO_DEBOUNCE
+#define RG_GAMEPAD_GPIO_DEBOUNCE 1
+#endif
+#ifndef RG_GAMEPAD_I2C_DEBOUNCE
+#define RG_GAMEPAD_I2C_DEBOUNCE 1
+#endif
+#ifndef RG_GAMEPAD_KBD_DEBOUNCE
+#define RG_GAMEPAD_KBD_DEBOUNCE 0
+#endif
+#ifndef RG_GAMEPAD_SERIAL_DEBOUNCE
+#define RG_GAMEPAD_SERIAL_DEBOUNCE 1
+#endif
+
 #ifndef RG_BATTERY_CALC_PERCENT
 #define RG_BATTERY_CALC_PERCENT(raw) (100)
 #endif
@@ -0,0 +1,471 @@
+#include "rg_system.h"
+#include "rg_rollback.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netdb.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+#define ROLLBACK_VERSION 0x01
+#define PACKET_MAX_SIZE  512
+
+// The input rings must cover everything a peer can be ahead or behind, that is
+// at most 2 * (RG_ROLLBACK_MAX_FRAMES + RG_ROLLBACK_MAX_DELAY) + 1 frames.
+#define WINDOW 64
+
+typedef struct __attribute__((packed))
+{
+    uint8_t version;
+    uint8_t count;      // Number of inputs that follow
+    uint8_t input_size;
+    uint8_t reserved;
+    int32_t first;      // Frame of the first input
+    int32_t ack;        // All the receiver's inputs up to this frame have arrived
+    uint8_t inputs[];
+} packet_t;
+
+struct rg_rollback_s
+{
+    rg_rollback_config_t config;
+    rg_rollback_link_t *link;
+    int player;
+    int32_t frame;          // Next frame to emulate
+    int32_t local_last;     // Last frame for which we have local input
+    int32_t remote_frame;   // All remote inputs up to this frame have arrived
+    int32_t remote_ack;     // All local inputs up to this frame have reached the peer
+    int32_t rollback_frame; // First mispredicted frame, or -1
+    int64_t stall_start;
+    uint8_t local[WINDOW][RG_ROLLBACK_MAX_INPUT];
+    uint8_t remote[WINDOW][RG_ROLLBACK_MAX_INPUT];
+    uint8_t used[WINDOW][RG_ROLLBACK_MAX_INPUT]; // Remote input that was used to emulate each frame
+    uint8_t *states;
+    rg_rollback_stats_t stats;
+};
+
+#define STATE(s, f) ((s)->states + ((f) % ((s)->config.max_rollback + 1)) * (s)->config.state_size)
+
+
+static void receive_inputs(rg_rollback_t *s)
+{
+    const size_t size = s->config.input_size;
+    uint8_t buffer[PACKET_MAX_SIZE];
+    packet_t *packet = (packet_t *)buffer;
+    int len;
+
+    while ((len = s->link->recv(s->link, buffer, sizeof(buffer))) > 0)
+    {
+        if (len < (int)sizeof(packet_t) || packet->version != ROLLBACK_VERSION || packet->input_size != size
+            || (size_t)len != sizeof(packet_t) + packet->count * size)
+        {
+            RG_LOGW("Dropping invalid packet (len=%d)", len);
+            continue;
+        }
+
+        s->stats.packets_received++;
+        s->remote_ack = RG_MAX(s->remote_ack, RG_MIN(packet->ack, s->local_last));
+
+        // Inputs are resent until acknowledged, so we only need to accept the next contiguous ones
+        for (int i = 0; i < packet->count; i++)
+        {
+            int32_t f = packet->first + i;
+            const uint8_t *input = packet->inputs + i * size;
+
+            if (f != s->remote_frame + 1)
+                continue;
+
+            memcpy(s->remote[f % WINDOW], input, size);
+            s->remote_frame = f;
+
+            if (f < s->frame && memcmp(s->used[f % WINDOW], input, size) != 0)
+            {
+                if (s->rollback_frame < 0 || f < s->rollback_frame)
+                    s->rollback_frame = f;
+            }
+        }
+    }
+}
+
+
+static void send_inputs(rg_rollback_t *s)
+{
+    const size_t size = s->config.input_size;
+    uint8_t buffer[PACKET_MAX_SIZE];
+    packet_t *packet = (packet_t *)buffer;
+    int32_t first = s->remote_ack + 1;
+    int count = RG_MIN(s->local_last - first + 1, (int)((sizeof(buffer) - sizeof(packet_t)) / size));
+
+    if (count > WINDOW)
+        count = WINDOW;
+
+    if (count < 0)
+        count = 0;
+
+    packet->version = ROLLBACK_VERSION;
+    packet->count = count;
+    packet->input_size = size;
+    packet->reserved = 0;
+    packet->first = first;
+    packet->ack = s->remote_frame;
+
+    for (int i = 0; i < count; i++)
+        memcpy(packet->inputs + i * size, s->local[(first + i) % WINDOW], size);
+
+    if (s->link->send(s->link, buffer, sizeof(packet_t) + count * size))
+        s->stats.packets_sent++;
+}
+
+
+static void emulate_frame(rg_rollback_t *s, bool render)
+{
+    const size_t size = s->config.input_size;
+    const int32_t f = s->frame;
+    uint8_t inputs[2 * RG_ROLLBACK_MAX_INPUT];
+    uint8_t *remote = s->used[f % WINDOW];
+
+    // Only frames emulated with a predicted input can ever be rolled back to
+    if (s->config.max_rollback > 0 && f > s->remote_frame)
+    {
+        int64_t start = rg_system_timer();
+        if (!s->config.save_state(s->config.arg, STATE(s, f), s->config.state_size))
+            RG_LOGE("Failed to snapshot frame %d", (int)f);
+        s->stats.save_time += rg_system_timer() - start;
+    }
+
+    if (f <= s->remote_frame)
+        memcpy(remote, s->remote[f % WINDOW], size);
+    else if (s->remote_frame >= 0) // Predict that the remote player is still holding the same buttons
+        memcpy(remote, s->remote[s->remote_frame % WINDOW], size);
+    else
+        memset(remote, 0, size);
+
+    memcpy(inputs + s->player * size, s->local[f % WINDOW], size);
+    memcpy(inputs + (s->player ^ 1) * size, remote, size);
+
+    s->config.run_frame(s->config.arg, inputs, render);
+    s->frame++;
+}
+
+
+static void rollback(rg_rollback_t *s)
+{
+    int64_t start = rg_system_timer();
+    int32_t target = s->frame;
+
+    s->frame = s->rollback_frame;
+    s->rollback_frame = -1;
+
+    if (!s->config.load_state(s->config.arg, STATE(s, s->frame), s->config.state_size))
+        RG_LOGE("Failed to restore frame %d", (int)s->frame);
+
+    s->stats.rollbacks++;
+    s->stats.resim_frames += target - s->frame;
+
+    while (s->frame < target)
+        emulate_frame(s, false);
+
+    s->stats.rollback_time += rg_system_timer() - start;
+}
+
+
+rg_rollback_t *rg_rollback_create(const rg_rollback_config_t *config, rg_rollback_link_t *link, int player)
+{
+    RG_ASSERT(config && link && (player == 0 || player == 1), "bad param");
+    RG_ASSERT(config->save_state && config->load_state && config->run_frame, "missing handler");
+
+    if (config->input_size < 1 || config->input_size > RG_ROLLBACK_MAX_INPUT
+        || config->max_rollback < 0 || config->max_rollback > RG_ROLLBACK_MAX_FRAMES
+        || config->input_delay < 0 || config->input_delay > RG_ROLLBACK_MAX_DELAY)
+    {
+        RG_LOGE("Invalid config: input_size=%d max_rollback=%d input_delay=%d",
+                (int)config->input_size, config->max_rollback, config->input_delay);
+        return NULL;
+    }
+
+    rg_rollback_t *s = calloc(1, sizeof(rg_rollback_t));
+    if (!s)
+        return NULL;
+
+    if (config->max_rollback > 0)
+    {
+        size_t states_size = (config->max_rollback + 1) * config->state_size;
+        if (!(s->states = malloc(states_size)))
+        {
+            RG_LOGE("Not enough memory for %d snapshots of %d bytes",
+                    config->max_rollback + 1, (int)config->state_size);
+            free(s);
+            return NULL;
+        }
+    }
+
+    s->config = *config;
+    s->link = link;
+    s->player = player;
+    s->local_last = config->input_delay - 1; // Delayed frames have an empty input
+    s->remote_frame = -1;
+    s->remote_ack = -1;
+    s->rollback_frame = -1;
+
+    RG_LOGI("Session started: player=%d max_rollback=%d input_delay=%d state_size=%d",
+            player, config->max_rollback, config->input_delay, (int)config->state_size);
+
+    return s;
+}
+
+
+void rg_rollback_free(rg_rollback_t *s)
+{
+    if (!s)
+        return;
+
+    RG_LOGI("Session ended: frames=%d stalls=%d (%dms) rollbacks=%d (%d frames, %dms) snapshots=%dms",
+            (int)s->stats.frames, (int)s->stats.stalls, (int)(s->stats.stall_time / 1000),
+            (int)s->stats.rollbacks, (int)s->stats.resim_frames, (int)(s->stats.rollback_time / 1000),
+            (int)(s->stats.save_time / 1000));
+
+    if (s->link->close)
+        s->link->close(s->link);
+    free(s->states);
+    free(s);
+}
+
+
+bool rg_rollback_advance(rg_rollback_t *s, const void *local_input)
+{
+    int64_t now = rg_system_timer();
+
+    if (s->link->tick)
+        s->link->tick(s->link);
+
+    // The input is recorded before we know if we can advance, otherwise in lockstep both
+    // peers would wait for each other forever. Retries of the same frame keep the first input.
+    if (s->local_last < s->frame + s->config.input_delay)
+    {
+        s->local_last = s->frame + s->config.input_delay;
+        memcpy(s->local[s->local_last % WINDOW], local_input, s->config.input_size);
+    }
+
+    receive_inputs(s);
+    send_inputs(s);
+
+    // We can't predict further than what we can roll back (in lockstep that means not at all)
+    if (s->frame - s->remote_frame > s->config.max_rollback)
+    {
+        if (!s->stall_start)
+            s->stall_start = now;
+        s->stats.stalls++;
+        return false;
+    }
+
+    if (s->stall_start)
+    {
+        s->stats.stall_time += now - s->stall_start;
+        s->stall_start = 0;
+    }
+
+    if (s->rollback_frame >= 0)
+        rollback(s);
+
+    emulate_frame(s, true);
+    s->stats.frames++;
+
+    return true;
+}
+
+
+uint32_t rg_rollback_frame(rg_rollback_t *s)
+{
+    return s->frame;
+}
+
+
+const rg_rollback_stats_t *rg_rollback_get_stats(rg_rollback_t *s)
+{
+    return &s->stats;
+}
+
+
+typedef struct loopback_s
+{
+    rg_rollback_link_t link;
+    struct loopback_s *peer;
+    uint32_t clock;
+    uint32_t seed;
+    int latency;
+    int loss;
+    struct {
+        uint32_t deliver_at;
+        uint16_t len;
+        uint8_t data[PACKET_MAX_SIZE];
+    } queue[64];
+    size_t head, count;
+} loopback_t;
+
+static bool loopback_send(rg_rollback_link_t *link, const void *data, size_t len)
+{
+    loopback_t *lo = (loopback_t *)link;
+    loopback_t *peer = lo->peer;
+
+    if (!peer || len > PACKET_MAX_SIZE)
+        return false;
+
+    // xorshift32, so that a given seed always produces the same losses
+    lo->seed ^= lo->seed << 13;
+    lo->seed ^= lo->seed >> 17;
+    lo->seed ^= lo->seed << 5;
+
+    if ((int)(lo->seed % 100) < lo->loss || peer->count == RG_COUNT(peer->queue))
+        return true; // The packet was "sent"
+
+    size_t pos = (peer->head + peer->count++) % RG_COUNT(peer->queue);
+    peer->queue[pos].deliver_at = peer->clock + lo->latency;
+    peer->queue[pos].len = len;
+    memcpy(peer->queue[pos].data, data, len);
+    return true;
+}
+
+static int loopback_recv(rg_rollback_link_t *link, void *data, size_t len)
+{
+    loopback_t *lo = (loopback_t *)link;
+
+    if (lo->count == 0 || (int32_t)(lo->clock - lo->queue[lo->head].deliver_at) < 0)
+        return 0;
+
+    len = RG_MIN(len, lo->queue[lo->head].len);
+    memcpy(data, lo->queue[lo->head].data, len);
+    lo->head = (lo->head + 1) % RG_COUNT(lo->queue);
+    lo->count--;
+    return len;
+}
+
+static void loopback_tick(rg_rollback_link_t *link)
+{
+    ((loopback_t *)link)->clock++;
+}
+
+static void loopback_close(rg_rollback_link_t *link)
+{
+    loopback_t *lo = (loopback_t *)link;
+    if (lo->peer)
+        lo->peer->peer = NULL;
+    free(lo);
+}
+
+bool rg_rollback_link_loopback(rg_rollback_link_t *links[2], int latency, int loss, uint32_t seed)
+{
+    loopback_t *lo[2] = {calloc(1, sizeof(loopback_t)), calloc(1, sizeof(loopback_t))};
+
+    if (!lo[0] || !lo[1])
+    {
+        free(lo[0]);
+        free(lo[1]);
+        return false;
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        lo[i]->link = (rg_rollback_link_t){loopback_send, loopback_recv, loopback_tick, loopback_close};
+        lo[i]->peer = lo[i ^ 1];
+        lo[i]->seed = (seed ?: 1) + i * 0x9E3779B9; // Each direction drops different packets
+        lo[i]->latency = RG_MAX(latency, 0);
+        lo[i]->loss = RG_MAX(loss, 0);
+        links[i] = &lo[i]->link;
+    }
+
+    RG_LOGI("Loopback link: latency=%d loss=%d%% seed=%u", latency, loss, (unsigned)seed);
+
+    return true;
+}
+
+
+#ifndef _WIN32
+typedef struct
+{
+    rg_rollback_link_t link;
+    int sock;
+} udp_link_t;
+
+static bool udp_send(rg_rollback_link_t *link, const void *data, size_t len)
+{
+    return send(((udp_link_t *)link)->sock, data, len, 0) == (ssize_t)len;
+}
+
+static int udp_recv(rg_rollback_link_t *link, void *data, size_t len)
+{
+    // The socket is non-blocking. ECONNREFUSED just means the peer isn't up yet.
+    int ret = recv(((udp_link_t *)link)->sock, data, len, 0);
+    if (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != ECONNREFUSED)
+        RG_LOGE("recv() failed: %d", errno);
+    return ret;
+}
+
+static void udp_close(rg_rollback_link_t *link)
+{
+    close(((udp_link_t *)link)->sock);
+    free(link);
+}
+
+rg_rollback_link_t *rg_rollback_link_udp(int local_port, const char *remote_host, int remote_port)
+{
+    struct addrinfo hints = {.ai_family = AF_INET, .ai_socktype = SOCK_DGRAM};
+    struct sockaddr_in local_addr = {0};
+    struct addrinfo *remote = NULL;
+    char port[8];
+    int sock;
+
+    snprintf(port, sizeof(port), "%d", remote_port);
+    if (getaddrinfo(remote_host, port, &hints, &remote) != 0 || !remote)
+    {
+        RG_LOGE("Unable to resolve '%s'", remote_host);
+        return NULL;
+    }
+
+    local_addr.sin_family = AF_INET;
+    local_addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    local_addr.sin_port = htons(local_port);
+
+    if ((sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP)) < 0)
+    {
+        RG_LOGE("socket() failed: %d", errno);
+        freeaddrinfo(remote);
+        return NULL;
+    }
+
+    if (bind(sock, (struct sockaddr *)&local_addr, sizeof(local_addr)) < 0
+        || connect(sock, remote->ai_addr, remote->ai_addrlen) < 0
+        || fcntl(sock, F_SETFL, fcntl(sock, F_GETFL, 0) | O_NONBLOCK) < 0)
+    {
+        RG_LOGE("Socket setup failed: %d", errno);
+        freeaddrinfo(remote);
+        close(sock);
+        return NULL;
+    }
+    freeaddrinfo(remote);
+
+    udp_link_t *udp = calloc(1, sizeof(udp_link_t));
+    if (!udp)
+    {
+        close(sock);
+        return NULL;
+    }
+    udp->link = (rg_rollback_link_t){udp_send, udp_recv, NULL, udp_close};
+    udp->sock = sock;
+
+    RG_LOGI("UDP link: %d -> %s:%d", local_port, remote_host, remote_port);
+
+    return &udp->link;
+}
+#else
+rg_rollback_link_t *rg_rollback_link_udp(int local_port, const char *remote_host, int remote_port)
+{
+    RG_LOGE("UDP link is not supported on this platform");
+    return NULL;
+}
+#endif
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#define RG_ROLLBACK_MAX_FRAMES 16 // Maximum number of frames we can re-simulate
+#define RG_ROLLBACK_MAX_DELAY  8  // Maximum local input delay, in frames
+#define RG_ROLLBACK_MAX_INPUT  16 // Maximum size of one player's input for one frame
+
+typedef struct rg_rollback_link_s rg_rollback_link_t;
+typedef struct rg_rollback_s rg_rollback_t;
+
+// A link is an unreliable datagram transport between the two peers. Packets may be
+// lost or arrive late, but must not be corrupted. recv() must never block.
+struct rg_rollback_link_s
+{
+    bool (*send)(rg_rollback_link_t *link, const void *data, size_t len);
+    int (*recv)(rg_rollback_link_t *link, void *data, size_t len); // Returns <= 0 if nothing pending
+    void (*tick)(rg_rollback_link_t *link); // Optional, called once per rg_rollback_advance()
+    void (*close)(rg_rollback_link_t *link);
+};
+
+typedef struct
+{
+    // Snapshot the complete emulator state into memory (buffer is state_size bytes)
+    bool (*save_state)(void *arg, void *buffer, size_t size);
+    // Restore a snapshot taken by save_state
+    bool (*load_state)(void *arg, const void *buffer, size_t size);
+    // Emulate one frame. inputs holds 2 * input_size bytes, player 0 first.
+    // render is false when re-simulating, the core should skip video and audio output.
+    void (*run_frame)(void *arg, const void *inputs, bool render);
+    void *arg;
+    size_t state_size;
+    size_t input_size;
+    int max_rollback;   // 0 = lockstep, otherwise 1..RG_ROLLBACK_MAX_FRAMES
+    int input_delay;    // 0..RG_ROLLBACK_MAX_DELAY
+} rg_rollback_config_t;
+
+typedef struct
+{
+    uint32_t frames;        // Frames emulated (excluding re-simulation)
+    uint32_t stalls;        // rg_rollback_advance() calls that couldn't advance
+    int64_t stall_time;     // Time spent waiting for the peer, in us
+    uint32_t rollbacks;     // Mispredictions detected
+    uint32_t resim_frames;  // Frames emulated again because of mispredictions
+    int64_t rollback_time;  // Time spent loading states and re-simulating, in us
+    int64_t save_time;      // Time spent taking snapshots, in us
+    uint32_t packets_sent;
+    uint32_t packets_received;
+} rg_rollback_stats_t;
+
+rg_rollback_t *rg_rollback_create(const rg_rollback_config_t *config, rg_rollback_link_t *link, int player);
+void rg_rollback_free(rg_rollback_t *session);
+bool rg_rollback_advance(rg_rollback_t *session, const void *local_input);
+uint32_t rg_rollback_frame(rg_rollback_t *session);
+const rg_rollback_stats_t *rg_rollback_get_stats(rg_rollback_t *session);
+
+// UDP link, not available on Windows. remote_host can be a name or an address.
+rg_rollback_link_t *rg_rollback_link_udp(int local_port, const char *remote_host, int remote_port);
+
+// In-process link pair for testing. latency is counted in rg_rollback_advance() calls of the
+// receiving side and loss is a percentage. The same seed will always drop the same packets.
+bool rg_rollback_link_loopback(rg_rollback_link_t *links[2], int latency, int loss, uint32_t seed);
@@ -10,13 +10,33 @@
 static rg_task_t *display_task_queue;
 static rg_display_counters_t counters;
 static rg_display_config_t config;
-static rg_surface_t *osd;
+static display_rotation_t auto_rotation;
+static struct
+{
+    const rg_surface_t *surface;
+    int left, top;          // In the viewport, negative values are from the right/bottom edges
+    int screen_top, height; // Screen lines covered by the last update
+    uint32_t line_hash[RG_SCREEN_HEIGHT];
+} osd;
 static rg_surface_t *border;
 static rg_display_t display;
 static int16_t map_viewport_to_source_x[RG_SCREEN_WIDTH + 1];
 static int16_t map_viewport_to_source_y[RG_SCREEN_HEIGHT + 1];
 static uint32_t screen_line_checksum[RG_SCREEN_HEIGHT + 1];
 
+// Messages to the display task, other than RG_TASK_MSG_STOP
+enum
+{
+    DISPLAY_MSG_UPDATE = 0, // dataPtr: rg_surface_t to draw
+    DISPLAY_MSG_OSD,        // dataPtr: the new OSD, see rg_display_set_osd()
+    DISPLAY_MSG_KEY_PRESS,  // dataInt: key press reflected by the next update, see rg_input_take_key_press()
+};
+typedef struct
+{
+    const rg_surface_t *surface;
+    int left, top;
+} osd_request_t;
+
 #define LINE_IS_REPEATED(Y) (map_viewport_to_source_y[(Y)] == map_viewport_to_source_y[(Y) - 1])
 // This is to avoid flooring a number that is approximated to .9999999 and be explicit about it
 #define FLOAT_TO_INT(x) ((int)((x) + 0.1f))
@@ -84,8 +104,44 @@ static inline void write_update(const rg_surface_t *update)
 
     const int format = update->format;
     const int stride = update->stride;
-    const void *data = update->data + update->offset + (crop_top * stride) + (crop_left * RG_PIXEL_GET_SIZE(format));
+    const void *data = update->data + update->offset;
     const uint16_t *palette = update->palette;
+    const int rotation = display.viewport.rotation;
+    const uint8_t *dirty_lines = rotation == RG_DISPLAY_ROTATION_OFF ? update->dirty_lines : NULL;
+
+    // When rotated, viewport lines map to source columns: row = row_base + row_step * x
+    // and column = col_base + col_step * y, crop included.
+    int row_base = crop_left, row_step = 1;
+    int col_base = crop_top, col_step = 1;
+
+    if (rotation == RG_DISPLAY_ROTATION_LEFT)
+        col_base = update->width - 1 - crop_top, col_step = -1;
+    else if (rotation == RG_DISPLAY_ROTATION_RIGHT)
+        row_base = update->height - 1 - crop_left, row_step = -1;
+    else
+        data += (crop_top * stride) + (crop_left * RG_PIXEL_GET_SIZE(format));
+
+    // The OSD is composed into the outgoing lines after scaling and filtering. Its content is folded
+    // into the line checksums so that partial updates still work, and only the lines it covers
+    // are touched. The lines it covered and will cover are invalidated when it changes or moves.
+    const rg_surface_t *osd_surface = osd.surface;
+    int osd_left = 0, osd_top = 0, osd_bottom = 0;
+
+    if (osd_surface)
+    {
+        osd_left = RG_MIN(RG_MAX(osd.left < 0 ? draw_width + osd.left : osd.left, 0), draw_width - 1);
+        osd_top = RG_MIN(RG_MAX(osd.top < 0 ? draw_height + osd.top : osd.top, 0), draw_height - 1);
+        osd_bottom = RG_MIN(osd_top + RG_MIN(osd_surface->height, RG_SCREEN_HEIGHT), draw_height);
+        if (osd.screen_top != draw_top + osd_top || osd.height != osd_bottom - osd_top)
+        {
+            for (int i = 0; i < osd.height; ++i)
+                screen_line_checksum[osd.screen_top + i] = 0;
+            for (int i = osd_top; i < osd_bottom; ++i)
+                screen_line_checksum[draw_top + i] = 0;
+            osd.screen_top = draw_top + osd_top;
+            osd.height = osd_bottom - osd_top;
+        }
+    }
 
     int lines_per_buffer = LCD_BUFFER_LENGTH / draw_width;
     int lines_remaining = draw_height;
@@ -108,15 +164,58 @@ static inline void write_update(const rg_surface_t *update)
                 --lines_to_copy;
         }
 
+        // Skip converting and hashing blocks made only of lines the source says didn't change,
+        // as long as the screen still holds what we drew there last time.
+        if (dirty_lines)
+        {
+            bool dirty = false;
+            for (int i = 0; i < lines_to_copy && !dirty; ++i)
+                dirty = dirty_lines[crop_top + map_viewport_to_source_y[y + i]] || !screen_line_checksum[draw_top + y + i];
+            if (!dirty)
+            {
+                lines_remaining -= lines_to_copy;
+                y += lines_to_copy;
+                continue;
+            }
+        }
+
         uint16_t *line_buffer = lcd_get_buffer(LCD_BUFFER_LENGTH);
         uint16_t *line_buffer_ptr = line_buffer;
 
         uint32_t checksum = 0xFFFFFFFF;
         bool need_update = !partial;
 
+        if (rotation != RG_DISPLAY_ROTATION_OFF)
+        {
+            // Fill the whole block one source row at a time, walking down the columns
+            // of a rotated source line by line would touch a new cache line every pixel.
+            #define RENDER_BLOCK(PTR_TYPE, PIXEL) { \
+                for (int xx = 0; xx < draw_width; ++xx) { \
+                    PTR_TYPE *buffer = (PTR_TYPE *)(data + (row_base + row_step * map_viewport_to_source_x[xx]) * stride); \
+                    uint16_t *dst = line_buffer + xx; \
+                    for (int i = 0; i < lines_to_copy; ++i, dst += draw_width) { \
+                        int x = col_base + col_step * map_viewport_to_source_y[y + i]; \
+                        *dst = (PIXEL); \
+                    } \
+                } \
+            }
+            if (format & RG_PIXEL_PALETTE)
+                RENDER_BLOCK(uint8_t, palette[buffer[x]])
+            else if (format == RG_PIXEL_565_LE)
+                RENDER_BLOCK(uint16_t, (buffer[x] << 8) | (buffer[x] >> 8))
+            else
+                RENDER_BLOCK(uint16_t, buffer[x])
+        }
+
         for (int i = 0; i < lines_to_copy; ++i)
         {
-            if (i > 0 && LINE_IS_REPEATED(y))
+            if (rotation != RG_DISPLAY_ROTATION_OFF)
+            {
+                if (partial && (i == 0 || !LINE_IS_REPEATED(y)))
+                    checksum = rg_hash((void*)line_buffer_ptr, draw_width * 2);
+                line_buffer_ptr += draw_width;
+            }
+            else if (i > 0 && LINE_IS_REPEATED(y))
             {
                 memcpy(line_buffer_ptr, line_buffer_ptr - draw_width, draw_width * 2);
                 line_buffer_ptr += draw_width;
@@ -143,9 +242,13 @@ static inline void write_update(const rg_surface_t *update)
                 }
             }
 
-            if (screen_line_checksum[draw_top + y] != checksum)
+            uint32_t line_checksum = checksum;
+            if (y >= osd_top && y < osd_bottom)
+                line_checksum ^= osd.line_hash[y - osd_top] ^ osd_left;
+
+            if (screen_line_checksum[draw_top + y] != line_checksum)
             {
-                screen_line_checksum[draw_top + y] = checksum;
+                screen_line_checksum[draw_top + y] = line_checksum;
                 need_update = true;
             }
 
@@ -185,6 +288,19 @@ static inline void write_update(const rg_surface_t *update)
             }
         }
 
+        if (need_update && osd_top < y && osd_bottom > y - lines_to_copy)
+        {
+            const int64_t osd_start = rg_system_timer();
+            int block_top = y - lines_to_copy;
+            int first = RG_MAX(osd_top, block_top), last = RG_MIN(osd_bottom, y);
+            rg_surface_t block = {draw_width, lines_to_copy, .stride = draw_width * 2,
+                                  .format = RG_PIXEL_565_BE, .data = line_buffer};
+            rg_surface_blend(osd_surface, &(rg_rect_t){0, first - osd_top, osd_surface->width, last - first},
+                             &block, &(rg_rect_t){osd_left, first - block_top, osd_surface->width, last - first},
+                             false, C_TRANSPARENT, 255);
+            counters.osdTime += rg_system_timer() - osd_start;
+        }
+
         if (need_update)
         {
             int left = display.screen.margin_left + draw_left;
@@ -204,12 +320,6 @@ static inline void write_update(const rg_surface_t *update)
         lines_remaining -= lines_to_copy;
     }
 
-    if (osd != NULL)
-    {
-        // TODO: Draw on screen display. By default it should be bottom left which is fine
-        // for both virtual keyboard and info labels. Maybe make it configurable later...
-    }
-
     if (lines_updated > display.screen.height * 0.80f)
         counters.fullFrames++;
     else
@@ -219,8 +329,16 @@ static inline void write_update(const rg_surface_t *update)
 
 static void update_viewport_scaling(void)
 {
-    int src_width = display.source.width;
-    int src_height = display.source.height;
+    display_rotation_t rotation = config.rotation;
+    if (rotation == RG_DISPLAY_ROTATION_AUTO)
+        rotation = auto_rotation;
+    if (rotation != RG_DISPLAY_ROTATION_LEFT && rotation != RG_DISPLAY_ROTATION_RIGHT)
+        rotation = RG_DISPLAY_ROTATION_OFF;
+    display.viewport.rotation = rotation;
+
+    bool swap = rotation != RG_DISPLAY_ROTATION_OFF;
+    int src_width = swap ? display.source.height : display.source.width;
+    int src_height = swap ? display.source.width : display.source.height;
     int new_width = src_width;
     int new_height = src_height;
 
@@ -273,6 +391,18 @@ static void update_viewport_scaling(void)
             display.viewport.left, display.viewport.top, display.viewport.step_x, display.viewport.step_y);
 }
 
+static void set_osd(const rg_surface_t *surface, int left, int top)
+{
+    for (int i = 0; i < osd.height; ++i)
+        screen_line_checksum[osd.screen_top + i] = 0;
+    osd.surface = surface;
+    osd.left = left;
+    osd.top = top;
+    osd.height = 0;
+    for (int i = 0; surface && i < RG_MIN(surface->height, RG_SCREEN_HEIGHT); ++i)
+        osd.line_hash[i] = rg_hash(surface->data + surface->offset + i * surface->stride, surface->width * 2);
+}
+
 static bool load_border_file(const char *filename)
 {
     RG_LOGI("Loading border file: %s", filename ?: "(none)");
@@ -300,6 +430,7 @@ IRAM_ATTR
 static void display_task(void *arg)
 {
     rg_task_msg_t msg;
+    uint32_t key_press = 0;
 
     while (rg_task_peek(&msg))
     {
@@ -307,6 +438,22 @@ static void display_task(void *arg)
         if (msg.type == RG_TASK_MSG_STOP)
             break;
 
+        // Taken between two frames, the sender waits for it
+        if (msg.type == DISPLAY_MSG_OSD)
+        {
+            const osd_request_t *request = msg.dataPtr;
+            set_osd(request->surface, request->left, request->top);
+            rg_task_receive(&msg);
+            continue;
+        }
+
+        if (msg.type == DISPLAY_MSG_KEY_PRESS)
+        {
+            key_press = msg.dataInt;
+            rg_task_receive(&msg);
+            continue;
+        }
+
         if (display.changed)
         {
             if (config.scaling != RG_DISPLAY_SCALING_FULL)
@@ -325,9 +472,32 @@ static void display_task(void *arg)
         rg_task_receive(&msg);
 
         lcd_sync();
+
+        // The frame is now on the panel, this is as close to the photons as we can measure
+        if (key_press)
+        {
+            uint32_t latency = (uint32_t)rg_system_timer() - key_press;
+            counters.inputLatency += latency;
+            counters.inputLatencyMax = RG_MAX(counters.inputLatencyMax, latency);
+            counters.inputPresses++;
+            key_press = 0;
+        }
     }
 }
 
+void rg_display_set_osd(const rg_surface_t *surface, int left, int top)
+{
+    if (surface && (surface->format != RG_PIXEL_565_LE || !surface->data))
+    {
+        RG_LOGE("The OSD must be a RG_PIXEL_565_LE surface");
+        return;
+    }
+    // The request lives on our stack, rg_display_sync() returns once the display task has taken it
+    osd_request_t request = {surface, left, top};
+    rg_task_send(display_task_queue, &(rg_task_msg_t){.type = DISPLAY_MSG_OSD, .dataPtr = &request});
+    rg_display_sync(true);
+}
+
 void rg_display_force_redraw(void)
 {
     display.changed = true;
@@ -385,7 +555,7 @@ display_filter_t rg_display_get_filter(void)
 void rg_display_set_rotation(display_rotation_t rotation)
 {
     config.rotation = RG_MIN(RG_MAX(0, rotation), RG_DISPLAY_ROTATION_COUNT - 1);
-    rg_settings_set_number(NS_APP, SETTING_SCALING, config.rotation);
+    rg_settings_set_number(NS_APP, SETTING_ROTATION, config.rotation);
     display.changed = true;
 }
 
@@ -394,6 +564,16 @@ display_rotation_t rg_display_get_rotation(void)
     return config.rotation;
 }
 
+void rg_display_set_auto_rotation(display_rotation_t rotation)
+{
+    // This is what RG_DISPLAY_ROTATION_AUTO resolves to, typically set by the core per game
+    if (auto_rotation != rotation)
+    {
+        auto_rotation = rotation;
+        display.changed = true;
+    }
+}
+
 void rg_display_set_backlight(display_backlight_t percent)
 {
     config.backlight = RG_MIN(RG_MAX(percent, RG_DISPLAY_BACKLIGHT_MIN), RG_DISPLAY_BACKLIGHT_MAX);
@@ -445,7 +625,12 @@ void rg_display_submit(const rg_surface_t *update, uint32_t flags)
         display.changed = true;
     }
 
-    rg_task_send(display_task_queue, &(rg_task_msg_t){.dataPtr = update});
+    // Presses consumed by menus are only taken here when the emulation resumes, ignore those
+    uint32_t press = rg_input_take_key_press();
+    if (press && (uint32_t)time_start - press < 1000000)
+        rg_task_send(display_task_queue, &(rg_task_msg_t){.type = DISPLAY_MSG_KEY_PRESS, .dataInt = press});
+
+    rg_task_send(display_task_queue, &(rg_task_msg_t){.type = DISPLAY_MSG_UPDATE, .dataPtr = update});
 
     counters.blockTime += rg_system_timer() - time_start;
     counters.totalFrames++;
@@ -59,6 +59,10 @@ typedef struct
     int32_t partFrames;
     int64_t blockTime;
     int64_t busyTime;
+    int64_t osdTime;
+    int32_t inputPresses;    // Key presses that reached the screen
+    int64_t inputLatency;    // Total time from key press to displayed frame, in us
+    uint32_t inputLatencyMax;
 } rg_display_counters_t;
 
 typedef struct
@@ -89,6 +93,7 @@ typedef struct
         int width, height;
         float step_x, step_y;
         bool filter_x, filter_y;
+        display_rotation_t rotation; // Resolved rotation: OFF, LEFT or RIGHT
     } viewport;
     struct
     {
@@ -106,6 +111,11 @@ void rg_display_clear(uint16_t color_le);
 bool rg_display_sync(bool block);
 void rg_display_force_redraw(void);
 void rg_display_submit(const rg_surface_t *update, uint32_t flags);
+// The OSD is drawn over the emulator's output with C_TRANSPARENT as colour key. The surface must stay
+// valid until it's replaced, and this must be called again whenever its content changes. The display
+// task takes it between two frames, this returns once it has. Call rg_display_sync(true) before
+// drawing into a surface that is already set, a frame may be reading it.
+void rg_display_set_osd(const rg_surface_t *surface, int left, int top);
 
 rg_display_counters_t rg_display_get_counters(void);
 const rg_display_t *rg_display_get_info(void);
@@ -116,6 +126,7 @@ void rg_display_set_filter(display_filter_t filter);
 display_filter_t rg_display_get_filter(void);
 void rg_display_set_rotation(display_rotation_t rotation);
 display_rotation_t rg_display_get_rotation(void);
+void rg_display_set_auto_rotation(display_rotation_t rotation);
 void rg_display_set_backlight(display_backlight_t percent);
 display_backlight_t rg_display_get_backlight(void);
 void rg_display_set_border(const char *filename);
@@ -33,11 +33,27 @@ static struct
     cJSON *theme_obj;
     int font_index;
     bool show_clock;
+    bool show_fps;
+    rg_surface_t *osd;
+    int64_t osd_update_time;
     bool initialized;
 } gui;
 
+// Metrics and bitmaps of every glyph of the current font, so that rg_gui_draw_text doesn't
+// have to scan and unpack the font data up to three times for each character it draws
+static struct
+{
+    const rg_font_t *font;
+    uint8_t width[256];
+    uint16_t index[256];    // Glyph's position in rows (font->height rows each), 0 if blank
+    uint32_t *rows;
+    rg_color_t span_fg, span_bg;
+    uint16_t spans[16][4];  // Pre-rendered pixels for each 4-bit chunk of a glyph row
+} atlas;
+
 #define SETTING_FONTTYPE    "FontType"
 #define SETTING_CLOCK       "Clock"
+#define SETTING_SHOW_FPS    "ShowFPS"
 #define SETTING_THEME       "Theme"
 #define SETTING_WIFI_ENABLE "Enable"
 #define SETTING_WIFI_SLOT   "Slot"
@@ -59,8 +75,11 @@ static uint16_t *get_draw_buffer(int width, int height, rg_color_t fill_color)
     if (!gui.draw_buffer)
         RG_PANIC("Failed to allocate draw buffer!");
 
-    for (size_t i = 0; i < pixels; ++i)
-        gui.draw_buffer[i] = fill_color;
+    if (width > 0 && height > 0)
+    {
+        rg_surface_t surface = {width, height, .stride = width * 2, .format = RG_PIXEL_565_LE, .data = gui.draw_buffer};
+        rg_surface_fill(&surface, NULL, fill_color);
+    }
 
     return gui.draw_buffer;
 }
@@ -103,6 +122,7 @@ void rg_gui_init(void)
     rg_gui_set_font(rg_settings_get_number(NS_GLOBAL, SETTING_FONTTYPE, RG_FONT_VERA_12));
     rg_gui_set_theme(rg_settings_get_string(NS_GLOBAL, SETTING_THEME, NULL));
     gui.show_clock = rg_settings_get_number(NS_GLOBAL, SETTING_CLOCK, 0);
+    gui.show_fps = rg_settings_get_number(NS_GLOBAL, SETTING_SHOW_FPS, 0);
     gui.initialized = true;
 }
 
@@ -224,17 +244,13 @@ void rg_gui_copy_buffer(int left, int top, int width, int height, int stride, co
         if (stride < width)
             stride = width * 2;
 
-        width = RG_MIN(width, gui.screen_width - left);
-        height = RG_MIN(height, gui.screen_height - top);
+        if (width < 1 || height < 1 || left >= gui.screen_width || top >= gui.screen_height)
+            return;
 
-        for (int y = 0; y < height; ++y)
-        {
-            uint16_t *dst = gui.screen_buffer + (top + y) * gui.screen_width + left;
-            const uint16_t *src = (void *)buffer + y * stride;
-            for (int x = 0; x < width; ++x)
-                if (src[x] != C_TRANSPARENT)
-                    dst[x] = src[x];
-        }
+        rg_surface_t source = {width, height, .stride = stride, .format = RG_PIXEL_565_LE, .data = (void *)buffer};
+        rg_surface_t screen = {gui.screen_width, gui.screen_height, .stride = gui.screen_width * 2,
+                               .format = RG_PIXEL_565_LE, .data = gui.screen_buffer};
+        rg_surface_blend(&source, NULL, &screen, &(rg_rect_t){left, top, width, height}, false, C_TRANSPARENT, 255);
     }
     else
     {
@@ -280,6 +296,8 @@ static size_t get_glyph(uint32_t *output, const rg_font_t *font, int points, int
         const uint8_t *data = font->data;
         while (1) {
             charCode = *data++;
+            if (charCode == 0xFF) // The terminator is a single byte
+                break;
             adjYOffset = *data++;
             width = *data++;
             height = *data++;
@@ -287,7 +305,7 @@ static size_t get_glyph(uint32_t *output, const rg_font_t *font, int points, int
             xOffset = xOffset < 0x80 ? xOffset : -(0xFF - xOffset);
             xDelta = *data++;
 
-            if (charCode == c || charCode == 0xFF)
+            if (charCode == c)
                 break;
 
             if (width != 0)
@@ -330,6 +348,50 @@ static size_t get_glyph(uint32_t *output, const rg_font_t *font, int points, int
     return glyph_width;
 }
 
+static void build_atlas(const rg_font_t *font)
+{
+    uint32_t bitmap[32];
+    size_t count = 1;
+
+    for (int c = 0; c < 256; c++)
+    {
+        memset(bitmap, 0, sizeof(bitmap));
+        atlas.width[c] = get_glyph(bitmap, font, 0, c);
+        atlas.index[c] = 0;
+        for (int y = 0; y < font->height; y++)
+        {
+            if (bitmap[y])
+            {
+                atlas.index[c] = count++;
+                break;
+            }
+        }
+    }
+
+    free(atlas.rows);
+    atlas.rows = rg_alloc(count * font->height * sizeof(uint32_t), MEM_ANY);
+    memset(atlas.rows, 0, font->height * sizeof(uint32_t));
+
+    for (int c = 0; c < 256; c++)
+    {
+        if (atlas.index[c])
+        {
+            memset(bitmap, 0, sizeof(bitmap));
+            get_glyph(bitmap, font, 0, c);
+            memcpy(atlas.rows + atlas.index[c] * font->height, bitmap, font->height * sizeof(uint32_t));
+        }
+    }
+
+    atlas.font = font;
+
+    RG_LOGD("Glyph atlas built: %d glyphs, %d bytes", (int)count - 1, (int)(count * font->height * 4));
+}
+
+static inline int glyph_width(int c)
+{
+    return (c >= 0 && c < 256) ? atlas.width[c] : 0;
+}
+
 rg_rect_t rg_gui_draw_text(int x_pos, int y_pos, int width, const char *text, // const rg_font_t *font,
                            rg_color_t color_fg, rg_color_t color_bg, uint32_t flags)
 {
@@ -339,10 +401,27 @@ rg_rect_t rg_gui_draw_text(int x_pos, int y_pos, int width, const char *text, //
     int line_height = font_height + padding * 2;
     int line_count = 0;
     const rg_font_t *font = gui.style.font;
+    uint8_t row_map[32];
 
     if (!text || *text == 0)
         text = " ";
 
+    if (atlas.font != font)
+        build_atlas(font);
+
+    if (atlas.span_fg != color_fg || atlas.span_bg != color_bg)
+    {
+        for (int i = 0; i < 16; i++)
+            for (int x = 0; x < 4; x++)
+                atlas.spans[i][x] = (i & (1 << x)) ? color_fg : color_bg;
+        atlas.span_fg = color_fg;
+        atlas.span_bg = color_bg;
+    }
+
+    // Vertical stretching
+    for (int y = 0; y < font_height; y++)
+        row_map[y] = (font_height != font->height) ? (int)(y / ((float)font_height / font->height)) : y;
+
     if (width == 0)
     {
         // Find the longest line to determine our box width
@@ -350,7 +429,7 @@ rg_rect_t rg_gui_draw_text(int x_pos, int y_pos, int width, const char *text, //
         for (const char *ptr = text; *ptr;)
         {
             int chr = *ptr++;
-            line_width += monospace ?: get_glyph(NULL, font, font_height, chr);
+            line_width += monospace ?: glyph_width(chr);
 
             if (chr == '\n' || *ptr == 0)
             {
@@ -384,7 +463,7 @@ rg_rect_t rg_gui_draw_text(int x_pos, int y_pos, int width, const char *text, //
             while (x_offset < draw_width && *line && *line != '\n')
             {
                 int chr = *line++;
-                int width = monospace ?: get_glyph(NULL, font, font_height, chr);
+                int width = monospace ?: glyph_width(chr);
                 if (draw_width - x_offset < width) // Do not truncate glyphs
                     break;
                 x_offset += width;
@@ -402,9 +481,9 @@ rg_rect_t rg_gui_draw_text(int x_pos, int y_pos, int width, const char *text, //
 
         while (x_offset < draw_width)
         {
-            uint32_t bitmap[32] = {0};
-            int glyph_width = get_glyph(bitmap, font, font_height, *ptr++);
-            int width = monospace ?: glyph_width;
+            int chr = *ptr++;
+            int width = monospace ?: glyph_width(chr);
+            int index = (chr >= 0 && chr < 256) ? atlas.index[chr] : 0;
 
             if (draw_width - x_offset < width) // Do not truncate glyphs
             {
@@ -413,13 +492,16 @@ rg_rect_t rg_gui_draw_text(int x_pos, int y_pos, int width, const char *text, //
                 break;
             }
 
-            if (!(flags & RG_TEXT_DUMMY_DRAW))
+            // Blank glyphs and rows can be skipped, the buffer is already filled with color_bg
+            if (!(flags & RG_TEXT_DUMMY_DRAW) && index)
             {
+                const uint32_t *glyph = atlas.rows + index * font->height;
                 for (int y = 0; y < font_height; y++)
                 {
                     uint16_t *output = &draw_buffer[(draw_width * (y + padding)) + x_offset];
-                    for (int x = 0; x < width; x++)
-                        output[x] = (bitmap[y] & (1 << x)) ? color_fg : color_bg;
+                    uint32_t bits = glyph[row_map[y]];
+                    for (int x = 0; x < width && bits; x += 4, bits >>= 4)
+                        memcpy(output + x, atlas.spans[bits & 0xF], RG_MIN(width - x, 4) * 2);
                 }
             }
 
@@ -603,6 +685,56 @@ void rg_gui_draw_status_bars(void)
     rg_gui_draw_icons();
 }
 
+void rg_gui_draw_osd(void)
+{
+    const rg_app_t *app = rg_system_get_app();
+
+    if (!gui.initialized || !gui.show_fps || app->isLauncher)
+    {
+        if (gui.osd)
+        {
+            rg_display_set_osd(NULL, 0, 0);
+            rg_surface_free(gui.osd);
+            gui.osd = NULL;
+        }
+        return;
+    }
+
+    int64_t now = rg_system_timer();
+    if (gui.osd && now < gui.osd_update_time)
+        return;
+    gui.osd_update_time = now + 1000000;
+
+    int width = TEXT_RECT("000 FPS", 0).width;
+    int height = gui.style.font_height + 2;
+
+    if (!gui.osd || gui.osd->width != width || gui.osd->height != height)
+    {
+        rg_display_set_osd(NULL, 0, 0);
+        rg_surface_free(gui.osd);
+        gui.osd = rg_surface_create(width, height, RG_PIXEL_565_LE, MEM_SLOW);
+        if (!gui.osd)
+            return;
+    }
+
+    char text[16];
+    snprintf(text, sizeof(text), "%d FPS", (int)roundf(rg_system_get_counters().totalFPS));
+
+    // Draw into the OSD surface instead of the screen, once the frame being sent is done with it
+    rg_display_sync(true);
+    uint16_t *screen_buffer = gui.screen_buffer;
+    int screen_width = gui.screen_width, screen_height = gui.screen_height;
+    gui.screen_buffer = gui.osd->data;
+    gui.screen_width = width;
+    gui.screen_height = height;
+    rg_gui_draw_text(0, 0, width, text, C_WHITE, C_BLACK, RG_TEXT_ALIGN_CENTER);
+    gui.screen_buffer = screen_buffer;
+    gui.screen_width = screen_width;
+    gui.screen_height = screen_height;
+
+    rg_display_set_osd(gui.osd, -(width + 4), 4);
+}
+
 static size_t get_dialog_items_count(const rg_gui_option_t *options)
 {
     if (!options)
@@ -1263,6 +1395,18 @@ static rg_gui_event_t show_clock_cb(rg_gui_option_t *option, rg_gui_event_t even
     return RG_DIALOG_VOID;
 }
 
+static rg_gui_event_t show_fps_cb(rg_gui_option_t *option, rg_gui_event_t event)
+{
+    if (event == RG_DIALOG_PREV || event == RG_DIALOG_NEXT)
+    {
+        gui.show_fps = !gui.show_fps;
+        rg_settings_set_number(NS_GLOBAL, SETTING_SHOW_FPS, gui.show_fps);
+        return RG_DIALOG_REDRAW;
+    }
+    strcpy(option->value, gui.show_fps ? "On " : "Off");
+    return RG_DIALOG_VOID;
+}
+
 static rg_gui_event_t timezone_cb(rg_gui_option_t *option, rg_gui_event_t event)
 {
     const char utc_offsets[][10] = {"UTC-12:00", "UTC-11:00", "UTC-10:00", "UTC-09:00", "UTC-09:30", "UTC-08:00",
@@ -1513,6 +1657,7 @@ void rg_gui_options_menu(void)
         *opt++ = (rg_gui_option_t){0, "Filter",    "-", RG_DIALOG_FLAG_NORMAL, &filter_update_cb};
         *opt++ = (rg_gui_option_t){0, "Border",    "-", RG_DIALOG_FLAG_NORMAL, &border_update_cb};
         *opt++ = (rg_gui_option_t){0, "Speed",     "-", RG_DIALOG_FLAG_NORMAL, &speedup_update_cb};
+        *opt++ = (rg_gui_option_t){0, "Show FPS",  "-", RG_DIALOG_FLAG_NORMAL, &show_fps_cb};
     }
 
     size_t extra_options = get_dialog_items_count(app->options);
@@ -1589,8 +1734,9 @@ void rg_gui_debug_menu(const rg_gui_option_t *extra_options)
 {
     char screen_res[20], source_res[20], scaled_res[20];
     char stack_hwm[20], heap_free[20], block_free[20];
+    char heap_low[20], heap_frag[20], pool_info[32];
     char local_time[32], timezone[32], uptime[20];
-    char battery_info[25], frame_time[32];
+    char battery_info[25], frame_time[32], input_lag[32];
     char app_name[32], network_str[64];
 
     const rg_gui_option_t options[] = {
@@ -1600,6 +1746,9 @@ void rg_gui_debug_menu(const rg_gui_option_t *extra_options)
         {0, "Stack HWM ", stack_hwm,    RG_DIALOG_FLAG_NORMAL, NULL},
         {0, "Heap free ", heap_free,    RG_DIALOG_FLAG_NORMAL, NULL},
         {0, "Block free", block_free,   RG_DIALOG_FLAG_NORMAL, NULL},
+        {0, "Heap low  ", heap_low,     RG_DIALOG_FLAG_NORMAL, NULL},
+        {0, "Heap frag ", heap_frag,    RG_DIALOG_FLAG_NORMAL, NULL},
+        {0, "Pool      ", pool_info,    RG_DIALOG_FLAG_NORMAL, NULL},
         {0, "App name  ", app_name,     RG_DIALOG_FLAG_NORMAL, NULL},
         {0, "Network   ", network_str,  RG_DIALOG_FLAG_NORMAL, NULL},
         {0, "Local time", local_time,   RG_DIALOG_FLAG_NORMAL, NULL},
@@ -1607,6 +1756,7 @@ void rg_gui_debug_menu(const rg_gui_option_t *extra_options)
         {0, "Uptime    ", uptime,       RG_DIALOG_FLAG_NORMAL, NULL},
         {0, "Battery   ", battery_info, RG_DIALOG_FLAG_NORMAL, NULL},
         {0, "Blit time ", frame_time,   RG_DIALOG_FLAG_NORMAL, NULL},
+        {0, "Input lag ", input_lag,    RG_DIALOG_FLAG_NORMAL, NULL},
         RG_DIALOG_SEPARATOR,
         {0, "Overclock", "-", RG_DIALOG_FLAG_NORMAL, &overclock_update_cb},
         {1, "Reboot to firmware", NULL, RG_DIALOG_FLAG_NORMAL, NULL},
@@ -1633,13 +1783,34 @@ void rg_gui_debug_menu(const rg_gui_option_t *extra_options)
     {
         int total = (float)display_stats.busyTime / display_stats.totalFrames / 1000.f;
         int block = (float)display_stats.blockTime / display_stats.totalFrames / 1000.f;
-        snprintf(frame_time, 20, "%dms (block: %dms)", total, block);
+        int osd = display_stats.osdTime / display_stats.totalFrames;
+        snprintf(frame_time, 32, "%dms (block: %dms, OSD: %dus)", total, block, osd);
     }
     else
         snprintf(frame_time, 20, "N/A");
+    if (display_stats.inputPresses > 0)
+        snprintf(input_lag, 32, "%dms (max: %dms)", (int)stats.inputLatency, (int)stats.inputLatencyMax);
+    else
+        snprintf(input_lag, 32, "N/A");
     snprintf(stack_hwm, 20, "%d", stats.freeStackMain);
     snprintf(heap_free, 20, "%d+%d", stats.freeMemoryInt, stats.freeMemoryExt);
     snprintf(block_free, 20, "%d+%d", stats.freeBlockInt, stats.freeBlockExt);
+    snprintf(heap_low, 20, "%d+%d", stats.minFreeMemoryInt, stats.minFreeMemoryExt);
+    // Fragmentation: how much of the free memory isn't usable by a single allocation
+    snprintf(heap_frag, 20, "%d%%+%d%%",
+             stats.freeMemoryInt ? 100 - (int)(stats.freeBlockInt * 100LL / stats.freeMemoryInt) : 0,
+             stats.freeMemoryExt ? 100 - (int)(stats.freeBlockExt * 100LL / stats.freeMemoryExt) : 0);
+    const uint32_t mem_kinds[] = {MEM_ANY, MEM_SLOW, MEM_FAST, MEM_DMA};
+    size_t pool_used = 0, pool_peak = 0, pool_slack = 0;
+    for (size_t i = 0; i < RG_COUNT(mem_kinds); i++)
+    {
+        rg_alloc_stats_t alloc_stats = rg_alloc_get_stats(mem_kinds[i]);
+        pool_used += alloc_stats.pool_used;
+        pool_peak += alloc_stats.pool_peak;
+        pool_slack += alloc_stats.pool_slack;
+    }
+    snprintf(pool_info, 32, "%dK (peak %dK, slack %d%%)", (int)(pool_used / 1024), (int)(pool_peak / 1024),
+             pool_used ? (int)(pool_slack * 100 / pool_used) : 0);
     snprintf(uptime, 20, "%ds", (int)(rg_system_timer() / 1000000));
     rg_battery_t battery;
     if (rg_input_read_battery_raw(&battery))
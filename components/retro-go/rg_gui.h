@@ -111,6 +111,7 @@ void rg_gui_draw_dialog(const char *header, const rg_gui_option_t *options, int
 void rg_gui_draw_image(int x_pos, int y_pos, int width, int height, bool resample, const rg_image_t *img);
 void rg_gui_draw_hourglass(void); // This should be moved to system or display...
 void rg_gui_draw_status_bars(void);
+void rg_gui_draw_osd(void); // In-game overlay (FPS counter), refreshed once per second
 void rg_gui_draw_keyboard(const rg_keyboard_map_t *map, size_t cursor);
 void rg_gui_draw_message(const char *format, ...);
 
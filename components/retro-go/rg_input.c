@@ -38,11 +38,22 @@ static rg_keymap_virt_t keymap_virt[] = RG_GAMEPAD_VIRT_MAP;
 static bool input_task_running = false;
 static uint32_t gamepad_state = -1; // _Atomic
 static uint32_t gamepad_mapped = 0;
+static uint32_t gamepad_debounced = 0; // Keys whose driver needs debouncing
+static uint32_t gamepad_events = 0;    // Keys whose driver is event-driven rather than polled
+static uint32_t events_state = 0;      // _Atomic
 static rg_battery_t battery_state = {0};
+// Timestamps are the low 32 bits of rg_system_timer() so they can be handed between tasks with
+// atomic operations. 0 means no key press, 71 minutes is plenty to measure latency.
+static uint32_t pending_press = 0; // Oldest key press not yet returned by rg_input_read_gamepad()
+static uint32_t latched_press = 0; // Oldest key press returned by rg_input_read_gamepad()
 
-#define UPDATE_GLOBAL_MAP(keymap)                 \
+#define UPDATE_GLOBAL_MAP(keymap, debounce)       \
     for (size_t i = 0; i < RG_COUNT(keymap); ++i) \
+    {                                             \
         gamepad_mapped |= keymap[i].key;          \
+        if (debounce)                             \
+            gamepad_debounced |= keymap[i].key;   \
+    }
 
 #ifdef ESP_PLATFORM
 static inline int adc_get_raw(adc_unit_t unit, adc_channel_t channel)
@@ -100,6 +111,18 @@ bool rg_input_read_battery_raw(rg_battery_t *out)
     return true;
 }
 
+static uint32_t apply_virtual_keys(uint32_t state)
+{
+#if defined(RG_GAMEPAD_VIRT_MAP)
+    for (size_t i = 0; i < RG_COUNT(keymap_virt); ++i)
+    {
+        if (state == keymap_virt[i].src)
+            state = keymap_virt[i].key;
+    }
+#endif
+    return state;
+}
+
 bool rg_input_read_gamepad_raw(uint32_t *out)
 {
     uint32_t state = 0;
@@ -177,19 +200,41 @@ bool rg_input_read_gamepad_raw(uint32_t *out)
     }
 #endif
 
-#if defined(RG_GAMEPAD_VIRT_MAP)
-    for (size_t i = 0; i < RG_COUNT(keymap_virt); ++i)
-    {
-        if (state == keymap_virt[i].src)
-            state = keymap_virt[i].key;
-    }
-#endif
-
     if (out)
-        *out = state;
+        *out = apply_virtual_keys(state);
     return true;
 }
 
+static inline void record_key_press(void)
+{
+    uint32_t none = 0;
+    __atomic_compare_exchange_n(&pending_press, &none, (uint32_t)rg_system_timer() | 1, false, __ATOMIC_RELAXED,
+                                __ATOMIC_RELAXED);
+}
+
+#if defined(RG_TARGET_SDL2) && defined(RG_GAMEPAD_KBD_MAP)
+// Called by SDL_PumpEvents() as soon as the events are queued, before anyone polls them
+static int kbd_event_watch(void *arg, SDL_Event *event)
+{
+    if ((event->type != SDL_KEYDOWN && event->type != SDL_KEYUP) || event->key.repeat)
+        return 0;
+
+    for (size_t i = 0; i < RG_COUNT(keymap_kbd); ++i)
+    {
+        if (keymap_kbd[i].src != event->key.keysym.scancode)
+            continue;
+        if (event->type == SDL_KEYUP)
+            events_state &= ~keymap_kbd[i].key;
+        else if (!(events_state & keymap_kbd[i].key))
+        {
+            events_state |= keymap_kbd[i].key;
+            record_key_press();
+        }
+    }
+    return 0;
+}
+#endif
+
 static void input_task(void *arg)
 {
     const uint8_t debounce_level = 0x03;
@@ -205,8 +250,18 @@ static void input_task(void *arg)
     {
         if (rg_input_read_gamepad_raw(&state))
         {
+            uint32_t previous_state = local_gamepad_state;
             for (int i = 0; i < RG_KEY_COUNT; ++i)
             {
+                if (gamepad_events & (1 << i))
+                {
+                    continue;
+                }
+                if (!(gamepad_debounced & (1 << i)))
+                {
+                    local_gamepad_state = (local_gamepad_state & ~(1 << i)) | (state & (1 << i));
+                    continue;
+                }
                 debounce[i] = ((debounce[i] << 1) | ((state >> i) & 1));
                 debounce[i] &= debounce_level;
 
@@ -219,6 +274,8 @@ static void input_task(void *arg)
                     local_gamepad_state &= ~(1 << i);
                 }
             }
+            if (local_gamepad_state & ~previous_state)
+                record_key_press();
             gamepad_state = local_gamepad_state;
         }
 
@@ -260,7 +317,7 @@ void rg_input_init(void)
         else
             RG_LOGE("Invalid ADC unit %d!", (int)mapping->unit);
     }
-    UPDATE_GLOBAL_MAP(keymap_adc);
+    UPDATE_GLOBAL_MAP(keymap_adc, RG_GAMEPAD_ADC_DEBOUNCE);
 #endif
 
 #if defined(RG_GAMEPAD_GPIO_MAP)
@@ -271,7 +328,7 @@ void rg_input_init(void)
         gpio_set_direction(mapping->num, GPIO_MODE_INPUT);
         gpio_set_pull_mode(mapping->num, mapping->pull);
     }
-    UPDATE_GLOBAL_MAP(keymap_gpio);
+    UPDATE_GLOBAL_MAP(keymap_gpio, RG_GAMEPAD_GPIO_DEBOUNCE);
 #endif
 
 #if defined(RG_GAMEPAD_I2C_MAP)
@@ -280,12 +337,18 @@ void rg_input_init(void)
 #if defined(RG_TARGET_QTPY_GAMER)
     rg_i2c_gpio_init();
 #endif
-    UPDATE_GLOBAL_MAP(keymap_i2c);
+    UPDATE_GLOBAL_MAP(keymap_i2c, RG_GAMEPAD_I2C_DEBOUNCE);
 #endif
 
 #if defined(RG_GAMEPAD_KBD_MAP)
     RG_LOGI("Initializing KBD gamepad driver...");
-    UPDATE_GLOBAL_MAP(keymap_kbd);
+    UPDATE_GLOBAL_MAP(keymap_kbd, RG_GAMEPAD_KBD_DEBOUNCE);
+#ifdef RG_TARGET_SDL2
+    // Key events update the state directly, input_task doesn't have to poll the keyboard
+    for (size_t i = 0; i < RG_COUNT(keymap_kbd); ++i)
+        gamepad_events |= keymap_kbd[i].key;
+    SDL_AddEventWatch(kbd_event_watch, NULL);
+#endif
 #endif
 
 #if defined(RG_GAMEPAD_SERIAL_MAP)
@@ -295,7 +358,7 @@ void rg_input_init(void)
     gpio_set_direction(RG_GPIO_GAMEPAD_DATA, GPIO_MODE_INPUT);
     gpio_set_level(RG_GPIO_GAMEPAD_LATCH, 0);
     gpio_set_level(RG_GPIO_GAMEPAD_CLOCK, 1);
-    UPDATE_GLOBAL_MAP(keymap_serial);
+    UPDATE_GLOBAL_MAP(keymap_serial, RG_GAMEPAD_SERIAL_DEBOUNCE);
 #endif
 
 
@@ -341,7 +404,19 @@ uint32_t rg_input_read_gamepad(void)
 #ifdef RG_TARGET_SDL2
     SDL_PumpEvents();
 #endif
-    return gamepad_state;
+    // Emulators should call this as late as possible before running a frame, the state
+    // is always current and there is no queue to drain.
+    if (__atomic_load_n(&pending_press, __ATOMIC_RELAXED))
+    {
+        uint32_t press = __atomic_exchange_n(&pending_press, 0, __ATOMIC_RELAXED), none = 0;
+        __atomic_compare_exchange_n(&latched_press, &none, press, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    }
+    return gamepad_state | apply_virtual_keys(events_state);
+}
+
+uint32_t rg_input_take_key_press(void)
+{
+    return __atomic_exchange_n(&latched_press, 0, __ATOMIC_RELAXED);
 }
 
 bool rg_input_key_is_pressed(rg_key_t mask)
@@ -96,6 +96,9 @@ bool rg_input_wait_for_key(rg_key_t mask, bool pressed, int timeout_ms);
 const char *rg_input_get_key_name(rg_key_t key);
 const char *rg_input_get_key_mapping(rg_key_t key);
 uint32_t rg_input_read_gamepad(void);
+// Returns when (low 32 bits of rg_system_timer) the oldest key press seen by rg_input_read_gamepad()
+// happened, or 0 if there was none since the last call. Used to measure input latency.
+uint32_t rg_input_take_key_press(void);
 int rg_input_read_keyboard(const rg_keyboard_map_t *map);
 rg_battery_t rg_input_read_battery(void);
 bool rg_input_read_gamepad_raw(uint32_t *out);
@@ -576,8 +576,8 @@ bool rg_storage_unzip_file(const char *zip_path, const char *filter, void **data
     }
 
     size_t read_buffer_size = 0x8000;
-    uint8_t *read_buffer = malloc(read_buffer_size);
-    tinfl_decompressor *decomp = malloc(sizeof(tinfl_decompressor));
+    uint8_t *read_buffer = rg_pool_alloc(read_buffer_size, MEM_ANY | MEM_NOZERO | MEM_NOPANIC);
+    tinfl_decompressor *decomp = rg_pool_alloc(sizeof(tinfl_decompressor), MEM_ANY | MEM_NOZERO | MEM_NOPANIC);
 
     if (!read_buffer || !output_buffer || !decomp)
     {
@@ -612,8 +612,8 @@ bool rg_storage_unzip_file(const char *zip_path, const char *filter, void **data
         goto _fail;
     }
 
-    free(read_buffer);
-    free(decomp);
+    rg_pool_free(read_buffer);
+    rg_pool_free(decomp);
     fclose(fp);
 
     *data_out = output_buffer;
@@ -623,8 +623,8 @@ bool rg_storage_unzip_file(const char *zip_path, const char *filter, void **data
 _fail:
     if (!(flags & RG_FILE_USER_BUFFER))
         free(output_buffer);
-    free(read_buffer);
-    free(decomp);
+    rg_pool_free(read_buffer);
+    rg_pool_free(decomp);
     fclose(fp);
     return false;
 #else
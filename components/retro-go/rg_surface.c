@@ -46,6 +46,8 @@ rg_surface_t *rg_surface_create(int width, int height, int format, uint32_t allo
     size_t pixel_size = RG_PIXEL_GET_SIZE(format);
     size_t data_size = height * width * pixel_size;
     size_t palette_size = (format & RG_PIXEL_PALETTE) ? (256 * (format == RG_PIXEL_PAL888 ? 3 : 2)) : 0;
+    if (palette_size)
+        data_size = (data_size + 3) & ~3; // Keep the palette aligned
     size_t total_size = sizeof(rg_surface_t) + data_size + palette_size;
     rg_surface_t *surface = alloc_flags ? rg_alloc(total_size, alloc_flags) : malloc(total_size);
     if (!surface)
@@ -76,13 +78,116 @@ void rg_surface_free(rg_surface_t *surface)
     free(surface);
 }
 
-bool rg_surface_copy(const rg_surface_t *source, const rg_rect_t *source_rect, rg_surface_t *dest,
-                     const rg_rect_t *dest_rect, bool scale)
+// GCC vector extensions map onto SSE2 and NEON. Other targets (Xtensa) work on 32bit words
+// where it helps, and everything falls back to the scalar loops for the tails.
+// Define RG_SURFACE_NO_SIMD to always use the scalar code as a reference.
+#if defined(__GNUC__) && (defined(__SSE2__) || defined(__ARM_NEON)) && !defined(RG_SURFACE_NO_SIMD)
+#define SURFACE_VECTOR 8
+typedef uint16_t vu16_t __attribute__((vector_size(16)));
+typedef int16_t vs16_t __attribute__((vector_size(16)));
+#endif
+
+#define SWAP16(x) ((uint16_t)(((x) << 8) | ((x) >> 8)))
+
+static void fill_pixels16(uint16_t *dst, uint16_t pixel, size_t count)
+{
+    if (count && ((uintptr_t)dst & 2))
+    {
+        *dst++ = pixel;
+        count--;
+    }
+#ifndef RG_SURFACE_NO_SIMD
+#ifdef SURFACE_VECTOR
+    vu16_t vec = (vu16_t){0} + pixel;
+    for (; count >= 8; count -= 8, dst += 8)
+        memcpy(dst, &vec, 16);
+#endif
+    uint32_t word = pixel | ((uint32_t)pixel << 16);
+    for (; count >= 2; count -= 2, dst += 2)
+        memcpy(dst, &word, 4);
+#endif
+    while (count--)
+        *dst++ = pixel;
+}
+
+// Each channel becomes d + (s - d) * alpha / 32, alpha is 0-32
+static inline uint16_t blend_pixel(uint16_t s, uint16_t d, int alpha)
+{
+    int r = (d >> 11) + ((((s >> 11) - (d >> 11)) * alpha) >> 5);
+    int g = ((d >> 5) & 0x3F) + (((((s >> 5) & 0x3F) - ((d >> 5) & 0x3F)) * alpha) >> 5);
+    int b = (d & 0x1F) + ((((s & 0x1F) - (d & 0x1F)) * alpha) >> 5);
+    return (r << 11) | (g << 5) | b;
+}
+
+// Writes a line of 565 LE pixels to a 565 LE or BE (swap) line. color_key < 0 disables keying.
+static void compose_pixels16(uint16_t *dst, const uint16_t *src, size_t count, int color_key, int alpha, bool swap)
+{
+    size_t x = 0;
+
+    if (color_key < 0 && alpha == 32 && !swap)
+    {
+        memcpy(dst, src, count * 2);
+        return;
+    }
+
+#ifdef SURFACE_VECTOR
+    const vs16_t valpha = (vs16_t){0} + (int16_t)alpha;
+    const vu16_t vkey = (vu16_t){0} + (uint16_t)color_key;
+    for (; x + 8 <= count; x += 8)
+    {
+        vu16_t s, d, out;
+        memcpy(&s, src + x, 16);
+        memcpy(&d, dst + x, 16);
+        if (swap)
+            d = (d << 8) | (d >> 8);
+        if (alpha == 32)
+        {
+            out = s;
+        }
+        else
+        {
+            vs16_t sr = (vs16_t)(s >> 11), sg = (vs16_t)((s >> 5) & 0x3F), sb = (vs16_t)(s & 0x1F);
+            vs16_t dr = (vs16_t)(d >> 11), dg = (vs16_t)((d >> 5) & 0x3F), db = (vs16_t)(d & 0x1F);
+            vu16_t r = (vu16_t)(dr + (((sr - dr) * valpha) >> 5));
+            vu16_t g = (vu16_t)(dg + (((sg - dg) * valpha) >> 5));
+            vu16_t b = (vu16_t)(db + (((sb - db) * valpha) >> 5));
+            out = (r << 11) | (g << 5) | b;
+        }
+        if (color_key >= 0)
+        {
+            vu16_t keep = (vu16_t)(s == vkey);
+            out = (d & keep) | (out & ~keep);
+        }
+        if (swap)
+            out = (out << 8) | (out >> 8);
+        memcpy(dst + x, &out, 16);
+    }
+#endif
+
+    for (; x < count; ++x)
+    {
+        uint16_t pixel = src[x];
+        if ((int)pixel == color_key)
+            continue;
+        if (alpha < 32)
+            pixel = blend_pixel(pixel, swap ? SWAP16(dst[x]) : dst[x], alpha);
+        dst[x] = swap ? SWAP16(pixel) : pixel;
+    }
+}
+
+bool rg_surface_blend(const rg_surface_t *source, const rg_rect_t *source_rect, rg_surface_t *dest,
+                      const rg_rect_t *dest_rect, bool scale, rg_color_t color_key, int alpha)
 {
     // This function will eventually replace rg_gui_copy_buffer and rg_gui_draw_image but not today!
     CHECK_SURFACE(source, false);
     CHECK_SURFACE(dest, false);
 
+    if ((dest->format & RG_PIXEL_PALETTE) && !(source->format & RG_PIXEL_PALETTE))
+    {
+        RG_LOGE("Copying to a paletted surface can only be done from a paletted source surface!");
+        return false;
+    }
+
     if (dest->palette && (!source->palette || memcmp(source->palette, dest->palette, 512) != 0))
     {
         RG_LOGE("Copying to a paletted surface can only be done from a source surface with an identical palette!");
@@ -92,12 +197,26 @@ bool rg_surface_copy(const rg_surface_t *source, const rg_rect_t *source_rect, r
     rg_surface_t temp1, temp2;
     if (create_window(source, source_rect, &temp1))
         source = &temp1;
+    else if (source_rect)
+        return false;
     if (create_window(dest, dest_rect, &temp2))
         dest = &temp2;
+    else if (dest_rect)
+        return false;
 
     int copy_width = dest->width;
     int copy_height = dest->height;
-    int transparency = -1;
+
+    // Keep a bit of precision in the 565 channels but make 255 opaque
+    alpha = (RG_MIN(RG_MAX(alpha, 0), 255) + 4) >> 3;
+    if (alpha == 0)
+        return true;
+
+    if (alpha < 32 && (dest->format & RG_PIXEL_PALETTE))
+    {
+        RG_LOGE("Alpha blending to a paletted surface isn't supported!");
+        return false;
+    }
 
     if (source->width == copy_width && source->height == copy_height)
     {
@@ -111,87 +230,113 @@ bool rg_surface_copy(const rg_surface_t *source, const rg_rect_t *source_rect, r
             copy_height = source->height;
     }
 
+    if (source->format == dest->format && !scale && color_key < 0 && alpha == 32)
+    {
+        for (int y = 0; y < copy_height; ++y)
+        {
+            const uint8_t *src = source->data + source->offset + (y * source->stride);
+            uint8_t *dst = dest->data + dest->offset + (y * dest->stride);
+            memcpy(dst, src, copy_width * RG_PIXEL_GET_SIZE(dest->format));
+        }
+        return true;
+    }
+
+    if (source->format != RG_PIXEL_565_LE && source->format != RG_PIXEL_565_BE && source->format != RG_PIXEL_888
+        && source->format != RG_PIXEL_PAL565_LE && source->format != RG_PIXEL_PAL565_BE)
+    {
+        RG_LOGE("Invalid source format?");
+        return false;
+    }
+
     float step_x = (float)source->width / copy_width;
     float step_y = (float)source->height / copy_height;
 
     // This may look weird but it avoids up to 75k branches and float multiplications...
-    // Maybe there's a better way, without making it even more macro-heavy...
     short src_x_map[copy_width];
     for (int x = 0; x < copy_width; ++x)
         src_x_map[x] = scale ? (int)(x * step_x) : x;
 
-    #define COPY_PIXELS_1(SRC_PIXEL, DST_PIXEL)                                            \
-        for (int y = 0; y < copy_height; ++y)                                              \
-        {                                                                                  \
-            int src_y = scale ? (y * step_y) : y;                                          \
-            const uint8_t *src = source->data + source->offset + (src_y * source->stride); \
-            uint8_t *dst = dest->data + dest->offset + (y * dest->stride);                 \
-            for (int x = 0; x < copy_width; ++x)                                           \
-            {                                                                              \
-                int src_x = (int)src_x_map[x];                                             \
-                uint16_t pixel = SRC_PIXEL;                                                \
-                if ((int)pixel == transparency)                                            \
-                    continue;                                                              \
-                DST_PIXEL;                                                                 \
-            }                                                                              \
+    // Every source line is converted to 565 LE first, then composed onto the destination
+    uint16_t line[copy_width];
+
+    for (int y = 0; y < copy_height; ++y)
+    {
+        int src_y = scale ? (y * step_y) : y;
+        const uint8_t *src = source->data + source->offset + (src_y * source->stride);
+        uint8_t *dst = dest->data + dest->offset + (y * dest->stride);
+        const uint16_t *pixels = line;
+
+        if (dest->format & RG_PIXEL_PALETTE)
+        {
+            bool swap = source->format == RG_PIXEL_PAL565_BE;
+            for (int x = 0; x < copy_width; ++x)
+            {
+                uint8_t index = src[src_x_map[x]];
+                if (color_key < 0 || (swap ? SWAP16(source->palette[index]) : source->palette[index]) != color_key)
+                    dst[x] = index;
+            }
+            continue;
         }
 
-    #define COPY_PIXELS(SRC_PIXEL)                                                                   \
-        if (dest->format == RG_PIXEL_565_LE)                                                         \
-        {                                                                                            \
-            COPY_PIXELS_1(SRC_PIXEL, ((uint16_t *)dst)[x] = pixel);                                  \
-        }                                                                                            \
-        else if (dest->format == RG_PIXEL_565_BE)                                                    \
-        {                                                                                            \
-            COPY_PIXELS_1(SRC_PIXEL, ((uint16_t *)dst)[x] = (pixel << 8) | (pixel >> 8));            \
-        }                                                                                            \
-        else if (dest->format == RG_PIXEL_888)                                                       \
-        {                                                                                            \
-            COPY_PIXELS_1(SRC_PIXEL, *dst++ = ((pixel >> 8) & 0xF8); *dst++ = ((pixel >> 3) & 0xFC); \
-                        *dst++ = ((pixel & 0x1F) << 3););                                            \
+        switch (source->format)
+        {
+        case RG_PIXEL_565_LE:
+            if (!scale)
+                pixels = (const uint16_t *)src;
+            else
+                for (int x = 0; x < copy_width; ++x)
+                    line[x] = ((const uint16_t *)src)[src_x_map[x]];
+            break;
+        case RG_PIXEL_565_BE:
+            for (int x = 0; x < copy_width; ++x)
+                line[x] = SWAP16(((const uint16_t *)src)[src_x_map[x]]);
+            break;
+        case RG_PIXEL_PAL565_LE:
+            for (int x = 0; x < copy_width; ++x)
+                line[x] = source->palette[src[src_x_map[x]]];
+            break;
+        case RG_PIXEL_PAL565_BE:
+            for (int x = 0; x < copy_width; ++x)
+                line[x] = SWAP16(source->palette[src[src_x_map[x]]]);
+            break;
+        case RG_PIXEL_888:
+            for (int x = 0; x < copy_width; ++x)
+            {
+                const uint8_t *pix = &src[src_x_map[x] * 3];
+                line[x] = ((pix[0] << 8) & 0xF800) | ((pix[1] << 3) & 0x7E0) | ((pix[2] >> 3) & 0x1F);
+            }
+            break;
         }
 
-    if (source->format == dest->format && !scale && transparency == -1)
-    {
-        for (int y = 0; y < copy_height; ++y)
+        if (dest->format == RG_PIXEL_565_LE || dest->format == RG_PIXEL_565_BE)
         {
-            const uint8_t *src = source->data + source->offset + (y * source->stride);
-            uint8_t *dst = dest->data + dest->offset + (y * dest->stride);
-            memcpy(dst, src, copy_width * RG_PIXEL_GET_SIZE(dest->format));
+            compose_pixels16((uint16_t *)dst, pixels, copy_width, color_key, alpha, dest->format == RG_PIXEL_565_BE);
+        }
+        else if (dest->format == RG_PIXEL_888)
+        {
+            for (int x = 0; x < copy_width; ++x, dst += 3)
+            {
+                uint16_t pixel = pixels[x];
+                if ((int)pixel == color_key)
+                    continue;
+                if (alpha < 32)
+                    pixel = blend_pixel(pixel, ((dst[0] << 8) & 0xF800) | ((dst[1] << 3) & 0x7E0) | (dst[2] >> 3), alpha);
+                dst[0] = (pixel >> 8) & 0xF8;
+                dst[1] = (pixel >> 3) & 0xFC;
+                dst[2] = (pixel & 0x1F) << 3;
+            }
         }
-    }
-    else if (source->format == RG_PIXEL_565_LE)
-    {
-        COPY_PIXELS(((uint16_t *)src)[src_x]);
-    }
-    else if (source->format == RG_PIXEL_565_BE)
-    {
-        COPY_PIXELS(((uint16_t *)src)[src_x]; pixel = (pixel << 8) | (pixel >> 8));
-    }
-    else if (source->format == RG_PIXEL_PAL565_LE)
-    {
-        COPY_PIXELS(source->palette[src[src_x]]);
-    }
-    else if (source->format == RG_PIXEL_PAL565_BE)
-    {
-        COPY_PIXELS(source->palette[src[src_x]]; pixel = (pixel << 8) | (pixel >> 8));
-    }
-    else if (source->format == RG_PIXEL_888)
-    {
-        COPY_PIXELS(({
-            const uint8_t *pix = &src[src_x * 3];
-            (((pix[0] << 8) & 0xF800) | ((pix[1] << 3) & 0x7E0) | (((pix[2] >> 3) & 0x1F)));
-        }));
-    }
-    else
-    {
-        RG_LOGE("Invalid source format?");
-        return false;
     }
 
     return true;
 }
 
+bool rg_surface_copy(const rg_surface_t *source, const rg_rect_t *source_rect, rg_surface_t *dest,
+                     const rg_rect_t *dest_rect, bool scale)
+{
+    return rg_surface_blend(source, source_rect, dest, dest_rect, scale, -1, 255);
+}
+
 rg_surface_t *rg_surface_convert(const rg_surface_t *source, int new_width, int new_height, int new_format)
 {
     CHECK_SURFACE(source, NULL);
@@ -220,7 +365,33 @@ rg_surface_t *rg_surface_convert(const rg_surface_t *source, int new_width, int
 bool rg_surface_fill(rg_surface_t *dest, const rg_rect_t *rect, rg_color_t color)
 {
     CHECK_SURFACE(dest, false);
-    //
+
+    rg_surface_t temp;
+    if (create_window(dest, rect, &temp))
+        dest = &temp;
+    else if (rect)
+        return false;
+
+    uint16_t pixel = color;
+    uint8_t r = (pixel >> 8) & 0xF8, g = (pixel >> 3) & 0xFC, b = (pixel & 0x1F) << 3;
+
+    for (int y = 0; y < dest->height; ++y)
+    {
+        uint8_t *dst = dest->data + dest->offset + (y * dest->stride);
+
+        if (dest->format & RG_PIXEL_PALETTE) // color is a palette index
+            memset(dst, pixel & 0xFF, dest->width);
+        else if (dest->format == RG_PIXEL_565_LE)
+            fill_pixels16((uint16_t *)dst, pixel, dest->width);
+        else if (dest->format == RG_PIXEL_565_BE)
+            fill_pixels16((uint16_t *)dst, SWAP16(pixel), dest->width);
+        else if (r == g && g == b)
+            memset(dst, r, dest->width * 3);
+        else
+            for (int x = 0; x < dest->width; ++x, dst += 3)
+                dst[0] = r, dst[1] = g, dst[2] = b;
+    }
+
     return true;
 }
 
@@ -248,7 +419,7 @@ rg_surface_t *rg_surface_load_image(const uint8_t *data, size_t data_len, uint32
         return img;
     }
     // RAW565 (uint16 width, uint16 height, uint16 data[])
-    else if (data_len == (data16[0] * data16[1] * 2 + 4))
+    else if (data_len == (size_t)data16[0] * data16[1] * 2 + 4)
     {
         rg_surface_t raw = {data16[0], data16[1], .stride = data16[0] * 2, .format = RG_PIXEL_565_LE,
                             .data = (void *)(data16 + 2)};
@@ -37,6 +37,7 @@ typedef struct
     int format;
     uint16_t *palette;
     void *data;
+    const uint8_t *dirty_lines; // Optional, one flag per line: 0 if unchanged since the previous frame
     bool free_data;
     bool free_palette;
 } rg_surface_t;
@@ -53,6 +54,10 @@ rg_surface_t *rg_surface_load_image_file(const char *filename, uint32_t flags);
 void rg_surface_free(rg_surface_t *surface);
 bool rg_surface_copy(const rg_surface_t *source, const rg_rect_t *source_rect, rg_surface_t *dest,
                      const rg_rect_t *dest_rect, bool scale);
+// color_key is a 565 colour to skip (-1 to disable) and alpha goes from 0 (invisible) to 255 (opaque)
+bool rg_surface_blend(const rg_surface_t *source, const rg_rect_t *source_rect, rg_surface_t *dest,
+                      const rg_rect_t *dest_rect, bool scale, rg_color_t color_key, int alpha);
+// color is a 565 colour, or the palette index on paletted surfaces
 bool rg_surface_fill(rg_surface_t *dest, const rg_rect_t *rect, rg_color_t color);
 rg_surface_t *rg_surface_convert(const rg_surface_t *source, int new_width, int new_height, int new_format);
 #define rg_surface_resize(source, new_width, new_height) rg_surface_convert(source, new_width, new_height, RG_PIXEL_565_LE)
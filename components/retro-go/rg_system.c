@@ -39,8 +39,8 @@ typedef struct
 
 typedef struct
 {
-    int32_t totalFrames, fullFrames, partFrames, ticks;
-    int64_t busyTime, updateTime;
+    int32_t totalFrames, fullFrames, partFrames, ticks, inputPresses;
+    int64_t busyTime, updateTime, inputLatency;
 } counters_t;
 
 struct rg_task_s
@@ -123,16 +123,19 @@ static void update_memory_statistics(void)
     heap_caps_get_info(&heap_info, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
     statistics.freeMemoryInt = heap_info.total_free_bytes;
     statistics.freeBlockInt = heap_info.largest_free_block;
+    statistics.minFreeMemoryInt = heap_info.minimum_free_bytes;
     statistics.totalMemoryInt = heap_info.total_free_bytes + heap_info.total_allocated_bytes;
     heap_caps_get_info(&heap_info, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
     statistics.freeMemoryExt = heap_info.total_free_bytes;
     statistics.freeBlockExt = heap_info.largest_free_block;
+    statistics.minFreeMemoryExt = heap_info.minimum_free_bytes;
     statistics.totalMemoryExt = heap_info.total_free_bytes + heap_info.total_allocated_bytes;
 
     statistics.freeStackMain = uxTaskGetStackHighWaterMark(tasks[0].handle);
 #else
     statistics.freeMemoryInt = statistics.freeBlockInt = statistics.totalMemoryInt = (1 << 28);
     statistics.freeMemoryExt = statistics.freeBlockExt = statistics.totalMemoryExt = (1 << 28);
+    statistics.minFreeMemoryInt = statistics.minFreeMemoryExt = (1 << 28);
 #endif
 }
 
@@ -147,6 +150,8 @@ static void update_statistics(void)
     counters.totalFrames = display.totalFrames;
     counters.fullFrames = display.fullFrames;
     counters.partFrames = display.partFrames;
+    counters.inputPresses = display.inputPresses;
+    counters.inputLatency = display.inputLatency;
     counters.busyTime = statistics.busyTime;
     counters.ticks = statistics.ticks;
     counters.updateTime = statistics.lastTick;
@@ -175,6 +180,12 @@ static void update_statistics(void)
         statistics.fullFPS = fullFrames / totalTimeSecs;
         statistics.partialFPS = partFrames / totalTimeSecs;
     }
+    if (counters.inputPresses != previous.inputPresses)
+    {
+        float presses = counters.inputPresses - previous.inputPresses;
+        statistics.inputLatency = (counters.inputLatency - previous.inputLatency) / presses / 1000.f;
+    }
+    statistics.inputLatencyMax = display.inputLatencyMax / 1000.f;
     statistics.uptime = rg_system_timer() / 1000000;
 
     update_memory_statistics();
@@ -216,7 +227,7 @@ static void system_monitor_task(void *arg)
                                                            !rg_system_get_indicator(RG_INDICATOR_LOW_BATTERY)));
 
         // Try to avoid complex conversions that could allocate, prefer rounding/ceiling if necessary.
-        rg_system_log(RG_LOG_DEBUG, NULL, "STACK:%d, HEAP:%d+%d (%d+%d), BUSY:%d%%, FPS:%d (%d+%d+%d), BATT:%d\n",
+        rg_system_log(RG_LOG_DEBUG, NULL, "STACK:%d, HEAP:%d+%d (%d+%d), BUSY:%d%%, FPS:%d (%d+%d+%d), LAG:%dms, BATT:%d\n",
             statistics.freeStackMain,
             statistics.freeMemoryInt / 1024,
             statistics.freeMemoryExt / 1024,
@@ -227,6 +238,7 @@ static void system_monitor_task(void *arg)
             (int)roundf(statistics.skippedFPS),
             (int)roundf(statistics.partialFPS),
             (int)roundf(statistics.fullFPS),
+            (int)roundf(statistics.inputLatency),
             (int)roundf((battery.volts * 1000) ?: battery.level));
 
         // Auto frameskip
@@ -759,6 +771,7 @@ void rg_system_tick(int busyTime)
     statistics.lastTick = rg_system_timer();
     statistics.busyTime += busyTime;
     statistics.ticks++;
+    rg_gui_draw_osd();
     // WDT_RELOAD(WDT_TIMEOUT);
 }
 
@@ -964,7 +977,9 @@ bool rg_system_save_trace(const char *filename, bool panic_trace)
     fprintf(fp, "Total memory: %d + %d\n", stats->totalMemoryInt, stats->totalMemoryExt);
     fprintf(fp, "Free memory: %d + %d\n", stats->freeMemoryInt, stats->freeMemoryExt);
     fprintf(fp, "Free block: %d + %d\n", stats->freeBlockInt, stats->freeBlockExt);
+    fprintf(fp, "Lowest free memory: %d + %d\n", stats->minFreeMemoryInt, stats->minFreeMemoryExt);
     fprintf(fp, "Stack HWM: %d\n", stats->freeStackMain);
+    fprintf(fp, "Input latency: %.1fms (max: %.1fms)\n", stats->inputLatency, stats->inputLatencyMax);
     fprintf(fp, "Uptime: %ds (%d ticks)\n", stats->uptime, stats->ticks);
     if (panic_trace && panicTrace.configNs[0])
         fprintf(fp, "Panic configNs: %.16s\n", panicTrace.configNs);
@@ -203,6 +203,8 @@ typedef struct
     float fullFPS;
     float totalFPS;
     float busyPercent;
+    float inputLatency;    // Average time from key press to displayed frame, in ms
+    float inputLatencyMax; // Worst since boot, in ms
     int64_t busyTime;
     int64_t lastTick;
     int ticks;
@@ -213,6 +215,8 @@ typedef struct
     int freeMemoryExt;
     int freeBlockInt;
     int freeBlockExt;
+    int minFreeMemoryInt; // Low-water mark since boot
+    int minFreeMemoryExt;
     int freeStackMain;
 } rg_stats_t;
 
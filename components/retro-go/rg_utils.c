@@ -235,21 +235,35 @@ const char *rg_unique_string(const char *str)
 // Note: You should use calloc/malloc everywhere possible. This function is used to ensure
 // that some memory is put in specific regions for performance or hardware reasons.
 // Memory from this function should be freed with free()
-void *rg_alloc(size_t size, uint32_t caps)
+static rg_alloc_stats_t alloc_stats[4];
+
+// Stats are kept per memory kind: any, slow (SPIRAM), fast (internal), DMA
+static inline int alloc_kind(uint32_t caps)
 {
-    char caps_list[36] = "";
-    size_t available = 0;
-    void *ptr;
+    return (caps & MEM_DMA) ? 3 : (caps & MEM_FAST) ? 2 : (caps & MEM_SLOW) ? 1 : 0;
+}
 
+static const char *caps_to_string(uint32_t caps, char *buffer)
+{
+    *buffer = 0;
     if (caps & MEM_SLOW)
-        strcat(caps_list, "SPIRAM|");
+        strcat(buffer, "SPIRAM|");
     if (caps & MEM_FAST)
-        strcat(caps_list, "INTERNAL|");
+        strcat(buffer, "INTERNAL|");
     if (caps & MEM_DMA)
-        strcat(caps_list, "DMA|");
+        strcat(buffer, "DMA|");
     if (caps & MEM_EXEC)
-        strcat(caps_list, "IRAM|");
-    strcat(caps_list, (caps & MEM_32BIT) ? "32BIT" : "8BIT");
+        strcat(buffer, "IRAM|");
+    strcat(buffer, (caps & MEM_32BIT) ? "32BIT" : "8BIT");
+    return buffer;
+}
+
+void *rg_alloc(size_t size, uint32_t caps)
+{
+    rg_alloc_stats_t *stats = &alloc_stats[alloc_kind(caps)];
+    char caps_list[36];
+    size_t available = 0;
+    void *ptr;
 
 #ifdef ESP_PLATFORM
     uint32_t esp_caps = 0;
@@ -258,33 +272,216 @@ void *rg_alloc(size_t size, uint32_t caps)
     esp_caps |= (caps & MEM_EXEC ? MALLOC_CAP_EXEC : 0);
     esp_caps |= (caps & MEM_32BIT ? MALLOC_CAP_32BIT : MALLOC_CAP_8BIT);
 
-    if (!(ptr = heap_caps_calloc(1, size, esp_caps)))
+    if (caps & MEM_NOZERO)
+        ptr = heap_caps_malloc(size, esp_caps);
+    else
+        ptr = heap_caps_calloc(1, size, esp_caps);
+
+    if (!ptr)
     {
         available = heap_caps_get_largest_free_block(esp_caps);
         // Loosen the caps and try again
-        if ((ptr = heap_caps_calloc(1, size, esp_caps & ~(MALLOC_CAP_SPIRAM | MALLOC_CAP_INTERNAL))))
+        esp_caps &= ~(MALLOC_CAP_SPIRAM | MALLOC_CAP_INTERNAL);
+        if (caps & MEM_NOZERO)
+            ptr = heap_caps_malloc(size, esp_caps);
+        else
+            ptr = heap_caps_calloc(1, size, esp_caps);
+        if (ptr)
         {
             RG_LOGW("SIZE=%d, CAPS=%s, PTR=%p << CAPS not fully met! (available: %d)\n",
-                    (int)size, caps_list, ptr, (int)available);
-            return ptr;
+                    (int)size, caps_to_string(caps, caps_list), ptr, (int)available);
         }
     }
 #else
-    ptr = calloc(1, size);
+    ptr = (caps & MEM_NOZERO) ? malloc(size) : calloc(1, size);
 #endif
 
     if (!ptr)
     {
-        RG_LOGE("SIZE=%d, CAPS=%s << FAILED! (available: %d)\n", (int)size, caps_list, (int)available);
+        __atomic_fetch_add(&stats->failures, 1, __ATOMIC_RELAXED);
+        RG_LOGE("SIZE=%d, CAPS=%s << FAILED! (available: %d)\n", (int)size, caps_to_string(caps, caps_list), (int)available);
         if (caps & MEM_NOPANIC)
             return NULL;
         RG_PANIC("Memory allocation failed!");
     }
 
-    RG_LOGI("SIZE=%d, CAPS=%s, PTR=%p\n", (int)size, caps_list, ptr);
+    // rg_alloc is called from any task without a lock
+    __atomic_fetch_add(&stats->allocs, 1, __ATOMIC_RELAXED);
+    size_t largest = __atomic_load_n(&stats->largest, __ATOMIC_RELAXED);
+    while (size > largest && !__atomic_compare_exchange_n(&stats->largest, &largest, size, true, __ATOMIC_RELAXED,
+                                                          __ATOMIC_RELAXED))
+        continue;
+
+    RG_LOGD("SIZE=%d, CAPS=%s, PTR=%p\n", (int)size, caps_to_string(caps, caps_list), ptr);
     return ptr;
 }
 
+// The pool keeps a few freed blocks of each power of two size (64B to 64KB) around so that
+// transient buffers (decompression, file I/O, drawing) don't go back to the heap every time.
+#define POOL_MIN_SHIFT 6
+#define POOL_CLASSES   11
+#define POOL_KEEP      4
+#define POOL_MAGIC     0x504C
+
+// 16 bytes on every target, so that the data keeps the heap's alignment
+typedef struct pool_block_s
+{
+    uint32_t size;  // Requested size
+    uint8_t class;  // POOL_CLASSES means it didn't fit any class
+    uint8_t kind;
+    uint16_t magic;
+    struct pool_block_s *next; // Free list link
+#if UINTPTR_MAX == UINT32_MAX
+    uint32_t padding;
+#endif
+} pool_block_t;
+_Static_assert(sizeof(pool_block_t) == 16, "pool_block_t must be 16 bytes");
+
+static struct
+{
+    pool_block_t *free_list[4][POOL_CLASSES];
+    uint8_t free_count[4][POOL_CLASSES];
+    rg_mutex_t *lock;
+} pool;
+
+// The lock is created on first use, whichever task gets there first. Losers free their mutex.
+static rg_mutex_t *pool_lock(void)
+{
+    rg_mutex_t *lock = __atomic_load_n(&pool.lock, __ATOMIC_ACQUIRE);
+    if (!lock)
+    {
+        rg_mutex_t *created = rg_mutex_create();
+        if (__atomic_compare_exchange_n(&pool.lock, &lock, created, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            lock = created;
+        else
+            rg_mutex_free(created);
+    }
+    rg_mutex_take(lock, -1);
+    return lock;
+}
+
+void *rg_pool_alloc(size_t size, uint32_t caps)
+{
+    int kind = alloc_kind(caps);
+    rg_alloc_stats_t *stats = &alloc_stats[kind];
+    pool_block_t *block = NULL;
+    int class = 0;
+
+    while (class < POOL_CLASSES && size > (1 << (class + POOL_MIN_SHIFT)))
+        class++;
+
+    rg_mutex_t *lock = pool_lock();
+
+    if (class < POOL_CLASSES && (block = pool.free_list[kind][class]))
+    {
+        pool.free_list[kind][class] = block->next;
+        pool.free_count[kind][class]--;
+        stats->pool_cached -= 1 << (class + POOL_MIN_SHIFT);
+        stats->pool_hits++;
+    }
+    else
+    {
+        // Don't hold the lock while going to the heap
+        rg_mutex_give(lock);
+
+        size_t block_size = class < POOL_CLASSES ? (1 << (class + POOL_MIN_SHIFT)) : size;
+        // The pool's memory is never expected to be zeroed, it may be recycled anyway
+        block = rg_alloc(sizeof(pool_block_t) + block_size, caps | MEM_NOZERO | MEM_NOPANIC);
+        if (!block)
+        {
+            // Give the cached blocks back to the heap and try one last time
+            rg_pool_trim();
+            block = rg_alloc(sizeof(pool_block_t) + block_size, caps | MEM_NOZERO | MEM_NOPANIC);
+        }
+        if (!block)
+        {
+            if (caps & MEM_NOPANIC)
+                return NULL;
+            RG_PANIC("Memory allocation failed!");
+        }
+
+        rg_mutex_take(lock, -1);
+        stats->pool_misses++;
+    }
+
+    stats->pool_used += size;
+    stats->pool_peak = RG_MAX(stats->pool_peak, stats->pool_used);
+    if (class < POOL_CLASSES)
+        stats->pool_slack += (1 << (class + POOL_MIN_SHIFT)) - size;
+
+    rg_mutex_give(lock);
+
+    block->size = size;
+    block->class = class;
+    block->kind = kind;
+    block->magic = POOL_MAGIC;
+
+    if (!(caps & MEM_NOZERO))
+        memset(block + 1, 0, size);
+
+    return block + 1;
+}
+
+void rg_pool_free(void *ptr)
+{
+    if (!ptr)
+        return;
+
+    pool_block_t *block = (pool_block_t *)ptr - 1;
+    RG_ASSERT(block->magic == POOL_MAGIC, "Not a pool block!");
+
+    int class = block->class, kind = block->kind;
+    rg_alloc_stats_t *stats = &alloc_stats[kind];
+
+    rg_mutex_take(pool.lock, -1);
+
+    stats->pool_used -= block->size;
+    if (class < POOL_CLASSES)
+        stats->pool_slack -= (1 << (class + POOL_MIN_SHIFT)) - block->size;
+
+    if (class < POOL_CLASSES && pool.free_count[kind][class] < POOL_KEEP)
+    {
+        block->next = pool.free_list[kind][class];
+        pool.free_list[kind][class] = block;
+        pool.free_count[kind][class]++;
+        stats->pool_cached += 1 << (class + POOL_MIN_SHIFT);
+        block = NULL;
+    }
+
+    rg_mutex_give(pool.lock);
+
+    free(block);
+}
+
+void rg_pool_trim(void)
+{
+    rg_mutex_t *lock = __atomic_load_n(&pool.lock, __ATOMIC_ACQUIRE);
+    if (!lock)
+        return;
+
+    rg_mutex_take(lock, -1);
+    for (int kind = 0; kind < 4; kind++)
+    {
+        for (int class = 0; class < POOL_CLASSES; class++)
+        {
+            while (pool.free_list[kind][class])
+            {
+                pool_block_t *block = pool.free_list[kind][class];
+                pool.free_list[kind][class] = block->next;
+                free(block);
+            }
+            pool.free_count[kind][class] = 0;
+        }
+        alloc_stats[kind].pool_cached = 0;
+    }
+    rg_mutex_give(lock);
+}
+
+rg_alloc_stats_t rg_alloc_get_stats(uint32_t caps)
+{
+    return alloc_stats[alloc_kind(caps)];
+}
+
 void rg_usleep(uint32_t us)
 {
     int64_t goal = rg_system_timer() + us;
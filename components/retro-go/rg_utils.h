@@ -58,6 +58,10 @@ const char *rg_relpath(const char *path);
 uint32_t rg_crc32(uint32_t crc, const uint8_t *buf, size_t len);
 uint32_t rg_hash(const char *buf, size_t len);
 void *rg_alloc(size_t size, uint32_t caps);
+// Pool allocations are recycled through size classes, they must be released with rg_pool_free()
+void *rg_pool_alloc(size_t size, uint32_t caps);
+void rg_pool_free(void *ptr);
+void rg_pool_trim(void);
 // rg_usleep behaves like usleep in libc: it will sleep for *at least* `us` microseconds, but possibly more
 // due to scheduling. You should use rg_task_delay() if you don't need more than 10-15ms granularity.
 void rg_usleep(uint32_t us);
@@ -70,5 +74,22 @@ void rg_usleep(uint32_t us);
 #define MEM_32BIT (16)
 #define MEM_EXEC  (32)
 #define MEM_NOPANIC (64)
+#define MEM_NOZERO  (128) // Don't clear the memory, for buffers that will be overwritten anyway
+
+typedef struct
+{
+    uint32_t allocs;    // Successful rg_alloc calls
+    uint32_t failures;
+    size_t largest;     // Largest rg_alloc request
+    size_t pool_used;   // Bytes currently handed out by rg_pool_alloc
+    size_t pool_peak;   // High-water mark of pool_used
+    size_t pool_slack;  // Bytes lost to rounding pool_used up to size classes
+    size_t pool_cached; // Bytes kept in the pool's free lists
+    uint32_t pool_hits;
+    uint32_t pool_misses;
+} rg_alloc_stats_t;
+
+// Statistics are kept separately for MEM_ANY, MEM_SLOW, MEM_FAST and MEM_DMA
+rg_alloc_stats_t rg_alloc_get_stats(uint32_t caps);
 
 #define PTR_IN_SPIRAM(ptr) ((void *)(ptr) >= (void *)0x3F800000 && (void *)(ptr) < (void *)0x3FC00000)
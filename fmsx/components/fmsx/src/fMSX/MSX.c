@@ -184,6 +184,15 @@ byte PLatch;                       /* Palette buffer         */
 byte ALatch;                       /* Address buffer         */
 int  Palette[16];                  /* Current palette        */
 
+/** Lazy screen refresh **************************************/
+int  LazyRefresh = 0;              /* # frame buffers, 0: off*/
+unsigned int LineStamp;            /* Drawn lines counter    */
+unsigned int VStamp[VBLOCKS+1];    /* Last change stamps     */
+byte LineChanged[256];             /* 1: Changed since last  */
+static unsigned int LineDrawn[2][256]; /* Stamps of drawn    */
+static byte LineStatus[256];       /* Sprite status of lines */
+static byte RefreshPage;           /* Current frame buffer   */
+
 /** Cheat entries ********************************************/
 int MCFCount     = 0;              /* Size of MCFEntries[]   */
 MCFEntry MCFEntries[MAXCHEATS];    /* Entries from .MCF file */
@@ -317,6 +326,7 @@ static int hasext(const char *FileName,const char *Ext);
 static byte *GetMemory(int Size); /* Get memory chunk                */
 static void FreeMemory(const void *Ptr); /* Free memory chunk        */
 static void FreeAllMemory(void);  /* Free all memory chunks          */
+static int CheckLine(byte Y);     /* 1 if scanline has to be drawn   */
 
 /** hasext() *************************************************/
 /** Check if file name has given extension.                 **/
@@ -986,6 +996,9 @@ int ResetMSX(int NewMode,int NewRAMPages,int NewVRAMPages)
   /* Set "V9958" VDP version for MSX2+ */
   if(MODEL(MSX_MSX2P)) VDPStatus[1]|=0x04;
 
+  /* VRAM and palette have changed */
+  InvalidateScreen();
+
   /* Reset CPU */
   ResetZ80(&CPU);
 
@@ -1267,6 +1280,7 @@ case 0x87:
 
 case 0x98: /* VDP Data */
   VKey=1;
+  TouchVRAM(VPAGE-VRAM+VAddr);
   VDPData=VPAGE[VAddr]=Value;
   VAddr=(VAddr+1)&0x3FFF;
   /* If VAddr rolled over, modify VRAM page# */
@@ -1323,6 +1337,7 @@ case 0x9A: /* VDP Palette Latch */
     /* Set new color for palette entry J */
     Palette[J]=RGB2INT(R,G,B);
     SetColor(J,R,G,B);
+    TouchVDP();
     /* Next palette entry */
     VDP[16]=(J+1)&0x0F;
   }
@@ -1889,6 +1904,9 @@ void VDPOut(register byte R,register byte V)
 { 
   register byte J;
 
+  /* Registers 0-13,18,23,25-27 affect the display */
+  if((R<28)&&(VDP[R]!=V)&&((1L<<R)&0x0E843FFFL)) TouchVDP();
+
   switch(R)  
   {
     case  0: /* Reset HBlank interrupt if disabled */
@@ -2020,6 +2038,125 @@ byte RTCIn(register byte R)
   return(J|0xF0);
 }
 
+/** InvalidateScreen() ***************************************/
+/** Forget which scanlines are already in the frame buffers **/
+/** so that the next frames get drawn in full. Call it when **/
+/** something else has drawn over the frame buffers.        **/
+/*************************************************************/
+void InvalidateScreen(void)
+{
+  memset(VStamp,0,sizeof(VStamp));
+  memset(LineDrawn,0,sizeof(LineDrawn));
+  memset(LineChanged,1,sizeof(LineChanged));
+  LineStamp=0;
+}
+
+/** StampVRAM() **********************************************/
+/** Return the newest of stamp S and stamps of VRAM blocks  **/
+/** holding Size bytes at P.                                **/
+/*************************************************************/
+static unsigned int StampVRAM(unsigned int S,const byte *P,int Size)
+{
+  register int J,K;
+
+  J=(P-VRAM)>>VBLOCK_BITS;
+  K=(P-VRAM+Size-1)>>VBLOCK_BITS;
+  for(;J<=K;++J)
+    if(VStamp[J&(VBLOCKS-1)]>S) S=VStamp[J&(VBLOCKS-1)];
+  return(S);
+}
+
+/** StampLine() **********************************************/
+/** Return the newest stamp of everything RefreshLine#()    **/
+/** reads to draw scanline Y.                               **/
+/*************************************************************/
+static unsigned int StampLine(byte Y)
+{
+  register unsigned int S;
+  register byte L;
+  register byte *P;
+
+  S = VStamp[VSTAMP_VDP];
+  L = Y+VScroll;
+
+  switch(ScrMode)
+  {
+    case 0:
+      S=StampVRAM(S,ChrTab+40*(Y>>3),40);
+      S=StampVRAM(S,ChrGen,0x800);
+      break;
+    case MAXSCREEN+1:
+      S=StampVRAM(S,ChrTab+((80*(Y>>3))&ChrTabM),80);
+      S=StampVRAM(S,ColTab+((10*(Y>>3))&ColTabM),10);
+      S=StampVRAM(S,ChrGen,0x800);
+      break;
+    case 1:
+      S=StampVRAM(S,ChrTab+((int)(L&0xF8)<<2),32);
+      S=StampVRAM(S,ColTab,32);
+      S=StampVRAM(S,ChrGen,0x800);
+      break;
+    case 2:
+    case 4:
+      S=StampVRAM(S,ChrTab+((int)(L&0xF8)<<2),32);
+      S=StampVRAM(S,ColTab,0x1800);
+      S=StampVRAM(S,ChrGen,0x1800);
+      break;
+    case 3:
+      S=StampVRAM(S,ChrTab+((int)(L&0xF8)<<2),32);
+      S=StampVRAM(S,ChrGen,0x800);
+      break;
+    case 5:
+    case 6:
+      S=StampVRAM(S,ChrTab+(((int)L<<7)&ChrTabM&0x7FFF),128);
+      break;
+    default:
+      P=ChrTab+(((int)L<<8)&ChrTabM&0xFFFF);
+      S=StampVRAM(S,P,256);
+      /* SCREEN12 may show the other page when scrolled */
+      if(HScroll)
+        S=StampVRAM(S,P+(HScroll512&&(HScroll>255)? 0x10000:0)+(HScroll&0xFC),256);
+      break;
+  }
+
+  /* Sprites in SCREENs 1-3 and 4-8 */
+  if(!SpritesOFF&&ScrMode&&(ScrMode<=8))
+  {
+    if(ScrMode<4) S=StampVRAM(S,SprTab,128);
+    else S=StampVRAM(S,SprTab-0x200,0x280);
+    S=StampVRAM(S,SprGen,0x820);
+  }
+
+  return(S);
+}
+
+/** CheckLine() **********************************************/
+/** Return 1 if scanline Y has to be drawn, or 0 if the     **/
+/** current frame buffer already holds it. In that case,    **/
+/** the sprite status it produced is replayed instead.      **/
+/*************************************************************/
+static int CheckLine(byte Y)
+{
+  register unsigned int S,D;
+
+  if(!LazyRefresh) return(1);
+
+  S = StampLine(Y);
+
+  /* Compare with the frame shown before this one */
+  D = LineDrawn[LazyRefresh>1? RefreshPage^1:RefreshPage][Y];
+  LineChanged[Y] = !D||(S>=D);
+
+  /* Draw the line if anything it shows has changed */
+  D = LineDrawn[RefreshPage][Y];
+  if(!D||(S>=D)) return(1);
+
+  /* Sprite code sets VDPStatus[0] when drawing the line */
+  if(ScreenON&&(ScrMode>3? (ScrMode<=8):(ScrMode&&!SpritesOFF)))
+    VDPStatus[0]=(VDPStatus[0]&~0x5F)|LineStatus[Y];
+
+  return(0);
+}
+
 /** LoopZ80() ************************************************/
 /** Refresh screen, check keyboard and sprites. Call this   **/
 /** function on each interrupt.                             **/
@@ -2055,10 +2192,19 @@ word LoopZ80(Z80 *R)
       VDPStatus[2]&=0xBF;
 
       /* Refresh display */
-      if(UCount>=100) { UCount-=100;RefreshScreen(); }
+      if(UCount>=100)
+      {
+        UCount-=100;
+        RefreshScreen();
+        /* Following lines go to the next frame buffer */
+        if(LazyRefresh>1) RefreshPage^=1;
+        /* Start over before the stamps could wrap around */
+        if(LineStamp>=0xF0000000) InvalidateScreen();
+      }
       UCount+=UPeriod;
 
       /* Blinking for TEXT80 */
+      J=(XFGColor<<4)|XBGColor;
       if(BCount) BCount--;
       else
       {
@@ -2074,6 +2220,7 @@ word LoopZ80(Z80 *R)
           }
         }
       }
+      if(J!=((XFGColor<<4)|XBGColor)) TouchVDP();
     }
 
     /* Line coincidence is active at 0..255 */
@@ -2146,13 +2293,20 @@ word LoopZ80(Z80 *R)
   LoopVDP();
 
   /* Refresh scanline, possibly with the overscan */
-  if((UCount>=100)&&Drawing&&(ScanLine<256))
+  if((UCount>=100)&&Drawing&&(ScanLine<256)&&CheckLine(ScanLine))
   {
     if(!ModeYJK||(ScrMode<7)||(ScrMode>8))
       (RefreshLine[ScrMode])(ScanLine);
     else
       if(ModeYAE) RefreshLine10(ScanLine);
       else RefreshLine12(ScanLine);
+
+    /* Remember when the line was drawn and its sprite status */
+    if(LazyRefresh)
+    {
+      LineDrawn[RefreshPage][ScanLine]=++LineStamp;
+      LineStatus[ScanLine]=VDPStatus[0]&0x5F;
+    }
   }
 
   /* Every few scanlines, update sound */
@@ -255,6 +255,26 @@ extern byte ScrMode;                  /* Current screen mode */
 extern int  ScanLine;                 /* Current scanline    */
 extern byte *FontBuf;                 /* Optional fixed font */
 
+/** Lazy screen refresh **************************************/
+/** VRAM is split into 256-byte blocks. Writing a block or **/
+/** a register/palette entry affecting the display stamps   **/
+/** it with LineStamp. Scanlines whose inputs were not      **/
+/** stamped since they were last drawn into the same frame  **/
+/** buffer are not drawn again.                             **/
+/*************************************************************/
+#define VBLOCK_BITS   8               /* 256-byte blocks     */
+#define VBLOCKS       (0x20000>>VBLOCK_BITS)
+#define VSTAMP_VDP    VBLOCKS         /* Registers, palette  */
+
+#define TouchVRAM(A)  VStamp[((A)>>VBLOCK_BITS)&(VBLOCKS-1)]=LineStamp
+#define TouchVDP()    VStamp[VSTAMP_VDP]=LineStamp
+
+extern int  LazyRefresh;              /* # buffers, 0: off   */
+extern unsigned int LineStamp;        /* Drawn lines counter */
+extern unsigned int VStamp[VBLOCKS+1];/* Last change stamps  */
+extern byte LineChanged[256];         /* 1: Line differs from*/
+                                      /* the previous frame  */
+
 extern byte ExitNow;                  /* 1: Exit emulator    */
 
 extern byte PSLReg;                   /* Primary slot reg.   */
@@ -398,6 +418,13 @@ byte ChangeDisk(byte N,const char *FileName);
 /*************************************************************/
 byte LoadFNT(const char *FileName);
 
+/** InvalidateScreen() ***************************************/
+/** Forget which scanlines are already in the frame buffers **/
+/** so that the next frames get drawn in full. Call it when **/
+/** something else has drawn over the frame buffers.        **/
+/*************************************************************/
+void InvalidateScreen(void);
+
 /** SetScreenDepth() *****************************************/
 /** Set screen depth for the display drivers. Returns 1 on  **/
 /** success, 0 on failure.                                  **/
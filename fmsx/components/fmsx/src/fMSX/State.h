@@ -217,6 +217,9 @@ unsigned int LoadState(unsigned char *Buf,unsigned int MaxSize)
   XFGColor = FGColor;
   XBGColor = BGColor;
 
+  /* VRAM and palette have changed */
+  InvalidateScreen();
+
   /* All sound channels could have been changed */
   PSG.Changed     = (1<<AY8910_CHANNELS)-1;
   SCChip.Changed  = (1<<SCC_CHANNELS)-1;
@@ -156,6 +156,9 @@ static void HmmmEngine(void);
 static void YmmmEngine(void);
 static void HmmcEngine(void);
 
+static void TouchRows(register int Y0, register int Y1);
+static void RunEngine(void);
+
 void ReportVdpCommand(register byte Op);
 
 /*************************************************************/
@@ -846,6 +849,37 @@ void HmmcEngine(void)
   }
 }
 
+/** TouchRows() **********************************************/
+/** Stamp VRAM holding rows Y0..Y1 of the bitmap screen, so **/
+/** that the scanlines showing them get drawn again.        **/
+/*************************************************************/
+void TouchRows(int Y0, int Y1)
+{
+  register int J;
+
+  if (Y0>Y1) { J=Y0;Y0=Y1;Y1=J; }
+  for (J=Y0; J<=Y1; J++)
+    TouchVRAM(VDP_VRMP(ScrMode-5, 0, J)-VRAM);
+}
+
+/** RunEngine() **********************************************/
+/** Run the active VDP command and stamp the VRAM rows it   **/
+/** went through.                                           **/
+/*************************************************************/
+void RunEngine(void)
+{
+  register int DY=MMC.DY;
+
+  VdpEngine();
+
+  /* SRCH and LMCM only read from VRAM */
+  if (MMC.CM==CM_SRCH || MMC.CM==CM_LMCM)
+    return;
+
+  /* Finished commands leave the last row in VDP[38-39] */
+  TouchRows(DY, VdpEngine? MMC.DY:VDP[38]+((int)VDP[39]<<8));
+}
+
 /** VDPWrite() ***********************************************/
 /** Use this function to transfer pixel(s) from CPU to VDP. **/
 /*************************************************************/
@@ -853,7 +887,7 @@ void VDPWrite(byte V)
 {
   VDPStatus[2]&=0x7F;
   VDPStatus[7]=VDP[44]=V;
-  if(VdpEngine&&(VdpOpsCnt>0)) VdpEngine();
+  if(VdpEngine&&(VdpOpsCnt>0)) RunEngine();
 }
 
 /** VDPRead() ************************************************/
@@ -862,7 +896,7 @@ void VDPWrite(byte V)
 byte VDPRead(void)
 {
   VDPStatus[2]&=0x7F;
-  if(VdpEngine&&(VdpOpsCnt>0)) VdpEngine();
+  if(VdpEngine&&(VdpOpsCnt>0)) RunEngine();
   return(VDP[44]);
 }
 
@@ -944,6 +978,7 @@ byte VDPDraw(byte Op)
                VDP[38]+((int)VDP[39]<<8),
                VDP[44],
                Op&0x0F);
+      TouchRows(VDP[38]+((int)VDP[39]<<8), VDP[38]+((int)VDP[39]<<8));
       return 1;
     case CM_SRCH:
       VdpEngine=SrchEngine;
@@ -1021,7 +1056,7 @@ byte VDPDraw(byte Op)
   VDPStatus[2]|=0x01;
 
   /* Start execution if we still have time slices */
-  if(VdpEngine&&(VdpOpsCnt>0)) VdpEngine();
+  if(VdpEngine&&(VdpOpsCnt>0)) RunEngine();
 
   /* Operation successfull initiated */
   return(1);
@@ -1035,12 +1070,12 @@ void LoopVDP(void)
   if(VdpOpsCnt<=0)
   {
     VdpOpsCnt+=12500;
-    if(VdpEngine&&(VdpOpsCnt>0)) VdpEngine();
+    if(VdpEngine&&(VdpOpsCnt>0)) RunEngine();
   }
   else
   {
     VdpOpsCnt=12500;
-    if(VdpEngine) VdpEngine();
+    if(VdpEngine) RunEngine();
   }
 }
 
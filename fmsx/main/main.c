@@ -33,6 +33,8 @@ static uint16_t BPal[256];
 static uint16_t XPal[80];
 static uint16_t XPal0;
 static uint16_t *XBuf;
+static uint8_t DirtyLines[2][HEIGHT];
+static bool FrameComplete;
 
 #include <fmsx.h>
 
@@ -63,12 +65,15 @@ static const char *BiosFiles[] = {
     // "KANJI.ROM",
 };
 
-static inline void SubmitFrame(void)
+static inline void SubmitFrame(const uint8_t *dirty_lines)
 {
     int crop_v = CropPicture ? (ScanLines212 ? 8 : 18) : 0;
     currentUpdate->offset = crop_v * currentUpdate->stride;
     currentUpdate->height = HEIGHT - crop_v * 2;
+    currentUpdate->dirty_lines = dirty_lines ? dirty_lines + crop_v : NULL;
     rg_display_submit(currentUpdate, 0);
+    // Only frames completed by PutImage() can be compared line by line with the next one
+    FrameComplete = false;
 }
 
 int ProcessEvents(int Wait)
@@ -107,6 +112,7 @@ int ProcessEvents(int Wait)
         InMenu = 1;
         rg_audio_set_mute(true);
         MenuMSX();
+        InvalidateScreen();
         rg_audio_set_mute(false);
         rg_input_wait_for_key(RG_KEY_ANY, false, 500);
         InMenu = 0;
@@ -206,6 +212,9 @@ int InitMachine(void)
     SetScreenDepth(NormScreen.D);
     SetVideo(&NormScreen, 0, 0, WIDTH, HEIGHT);
 
+    // Only redraw the scanlines that changed since they were last drawn in each of our two buffers
+    LazyRefresh = 2;
+
     for (int J = 0; J < 80; J++)
         SetColor(J, 0, 0, 0);
 
@@ -241,10 +250,26 @@ void SetColor(byte N, byte R, byte G, byte B)
 
 void PutImage(void)
 {
+    uint8_t *dirty_lines = DirtyLines[currentUpdate == updates[1]];
+    bool partial = FrameComplete;
+
     if (InKeyboard)
+    {
         DrawKeyboard(&NormScreen, KBDKeys[KeyboardRow][KeyboardCol]);
+        // The keyboard covers parts of the picture that fMSX believes are already drawn
+        InvalidateScreen();
+        partial = false;
+    }
 
-    SubmitFrame();
+    if (partial)
+    {
+        // Rows above and below the active area are drawn along with its first and last lines
+        int last_line = (ScanLines212 ? 212 : 192) - 1;
+        for (int y = 0; y < HEIGHT; ++y)
+            dirty_lines[y] = LineChanged[RG_MIN(RG_MAX(y - FirstLine_16, 0), last_line)];
+    }
+    SubmitFrame(partial ? dirty_lines : NULL);
+    FrameComplete = true;
     currentUpdate = updates[currentUpdate == updates[0]];
     NormScreen.Data = currentUpdate->data;
     XBuf = NormScreen.Data;
@@ -277,7 +302,7 @@ unsigned int Mouse(byte N)
 
 int ShowVideo(void)
 {
-    SubmitFrame();
+    SubmitFrame(NULL);
     rg_system_tick(0);
     return 1;
 }
@@ -372,7 +397,7 @@ static void event_handler(int event, void *arg)
 {
     if (event == RG_EVENT_REDRAW)
     {
-        SubmitFrame();
+        SubmitFrame(NULL);
     }
 }
 
@@ -0,0 +1,72 @@
+import os, re, sys
+
+# This script generates the compact opcode tables used by m68kcpu.c when
+# M68K_COMPACT_JUMP_TABLE is enabled. It reads the flat 64K entry tables
+# (m68ki_instruction_jump_table_full.h and m68ki_cycles_full.h) and splits
+# each opcode into its upper 10 bits (operation class) and lower 6 bits
+# (effective address mode + register):
+#
+#   m68ki_opcode_block_index[opcode >> 6]       -> block number
+#   m68ki_opcode_blocks[block][opcode & 0x3f]   -> entry number
+#   m68ki_opcode_entries[entry]                 -> {handler, cycles}
+#
+# Identical blocks are shared and every distinct (handler, cycles) pair is
+# stored once, which brings ~320KB of tables down to ~42KB.
+#
+# Usage: gen_compact_table.py [output directory]
+
+BLOCK_BITS = 6
+BLOCK_SIZE = 1 << BLOCK_BITS
+
+
+def load_array(path):
+    with open(path, "r") as f:
+        body = f.read().split("{", 1)[1].split("}", 1)[0]
+    return [v.strip() for v in body.split(",") if v.strip()]
+
+
+def format_array(values, fmt, per_line, indent="  "):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(fmt % v for v in values[i : i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+src_dir = sys.path[0]
+out_dir = sys.argv[1] if len(sys.argv) > 1 else src_dir
+
+handlers = load_array(os.path.join(src_dir, "m68ki_instruction_jump_table_full.h"))
+cycles = load_array(os.path.join(src_dir, "m68ki_cycles_full.h"))
+assert len(handlers) == 0x10000 and len(cycles) == 0x10000
+
+entries = {}
+opcode_entries = [entries.setdefault(pair, len(entries)) for pair in zip(handlers, cycles)]
+
+blocks = {}
+block_index = []
+for i in range(0, 0x10000, BLOCK_SIZE):
+    block_index.append(blocks.setdefault(tuple(opcode_entries[i : i + BLOCK_SIZE]), len(blocks)))
+
+assert len(blocks) <= 0x100 and len(entries) <= 0x10000
+
+with open(os.path.join(out_dir, "m68ki_opcode_blocks.h"), "w", newline="\r\n") as f:
+    f.write("/* Generated by gen_compact_table.py, do not edit */\n\n")
+    f.write("typedef struct\n{\n")
+    f.write("  void (*handler)(void);       /* handler function */\n")
+    f.write("  unsigned char cycles;        /* cycles the instruction takes */\n")
+    f.write("} m68ki_opcode_entry;\n\n")
+    f.write("/* Defined in m68ki_opcode_entries.h, once the handlers are known */\n")
+    f.write("static const m68ki_opcode_entry m68ki_opcode_entries[%d];\n\n" % len(entries))
+    f.write("static const unsigned char m68ki_opcode_block_index[%d] =\n{\n" % len(block_index))
+    f.write(format_array(block_index, "%3d", 16))
+    f.write("\n};\n\n")
+    f.write("static const unsigned short m68ki_opcode_blocks[%d][%d] =\n{\n" % (len(blocks), BLOCK_SIZE))
+    for block in blocks:
+        f.write("  {\n%s\n  },\n" % format_array(block, "%4d", 16, "    "))
+    f.write("};\n")
+
+with open(os.path.join(out_dir, "m68ki_opcode_entries.h"), "w", newline="\r\n") as f:
+    f.write("/* Generated by gen_compact_table.py, do not edit */\n\n")
+    f.write("static const m68ki_opcode_entry m68ki_opcode_entries[%d] =\n{\n" % len(entries))
+    f.write("\n".join("  {%s, %s}," % pair for pair in entries))
+    f.write("\n};\n")
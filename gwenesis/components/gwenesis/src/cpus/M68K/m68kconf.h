@@ -72,6 +72,19 @@
  */
 #define M68K_CHECK_PC_ADDRESS_ERROR OPT_OFF
 
+/* If ON, opcodes are decoded through a compressed two-level table with the
+ * cycle counts folded into each handler entry (~42KB, see gen_compact_table.py)
+ * instead of the flat 64K entry jump and cycle tables (~320KB). Off by default:
+ * the extra lookup makes dispatch slower (tests/m68k_bench.c).
+ * The flat tables are always used when BUILD_TABLES is defined.
+ */
+#if defined(BUILD_TABLES)
+#undef M68K_COMPACT_JUMP_TABLE
+#define M68K_COMPACT_JUMP_TABLE     OPT_OFF
+#elif !defined(M68K_COMPACT_JUMP_TABLE)
+#define M68K_COMPACT_JUMP_TABLE     OPT_OFF
+#endif
+
 
 /* ----------------------------- COMPATIBILITY ---------------------------- */
 
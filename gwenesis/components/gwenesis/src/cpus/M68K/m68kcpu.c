@@ -11,15 +11,18 @@ extern int vdp_68k_irq_ack(int int_level);
 /* ================================ INCLUDES ============================== */
 /* ======================================================================== */
 
+#include "m68kconf.h"
+
 #ifndef BUILD_TABLES
-  #ifndef TABLES_FULL
+  #if M68K_COMPACT_JUMP_TABLE
+    #include "m68ki_opcode_blocks.h"
+  #elif !defined(TABLES_FULL)
     #include "m68ki_cycles.h"
   #else
     #include "m68ki_cycles_full.h"
   #endif
 #endif
 
-#include "m68kconf.h"
 #include "m68kcpu.h"
 #include "m68kops.h"
 #include "gwenesis_savestate.h"
@@ -235,14 +238,14 @@ void m68k_set_irq_delay(unsigned int int_level)
     if ((REG_IR & 0xF000) != 0x2000)
     {
       /* Finish executing current instruction */
-      USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+      USE_CYCLES(CYC_INSTRUCTION(REG_IR));
 
       /* One instruction delay before interrupt */
       irq_latency = 1;
       m68ki_trace_t1() /* auto-disable (see m68kcpu.h) */
       m68ki_use_data_space() /* auto-disable (see m68kcpu.h) */
       REG_IR = m68ki_read_imm_16();
-      m68ki_instruction_jump_table[REG_IR]();
+      m68ki_instruction_handler(REG_IR)();
       m68ki_exception_if_trace() /* auto-disable (see m68kcpu.h) */
       irq_latency = 0;
     }
@@ -306,11 +309,19 @@ void m68k_run(unsigned int cycles)
     /* Decode next instruction */
     REG_IR = m68ki_read_imm_16();
 
-//    printf("PC=%x IR=%x CYCLES=%d \n",m68k.pc,REG_IR,CYC_INSTRUCTION[REG_IR]);
+//    printf("PC=%x IR=%x CYCLES=%d \n",m68k.pc,REG_IR,CYC_INSTRUCTION(REG_IR));
 
     /* Execute instruction */
+#if M68K_COMPACT_JUMP_TABLE
+    {
+      const m68ki_opcode_entry *op = m68ki_opcode_lookup(REG_IR);
+      op->handler();
+      USE_CYCLES(op->cycles);
+    }
+#else
     m68ki_instruction_jump_table[REG_IR]();
-    USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+    USE_CYCLES(CYC_INSTRUCTION(REG_IR));
+#endif
 
     /* Trace m68k_exception, if necessary */
     m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
@@ -319,7 +330,7 @@ void m68k_run(unsigned int cycles)
 
 int m68k_cycles(void)
 {
-  return CYC_INSTRUCTION[REG_IR];
+  return CYC_INSTRUCTION(REG_IR);
 }
 
 int m68k_cycles_run(void)
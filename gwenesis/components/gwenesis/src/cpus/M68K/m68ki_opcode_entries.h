@@ -0,0 +1,1707 @@
+/* Generated by gen_compact_table.py, do not edit */
+
+static const m68ki_opcode_entry m68ki_opcode_entries[1702] =
+{
+  {m68k_op_ori_8_d, 8*7},
+  {m68k_op_illegal, 0*7},
+  {m68k_op_ori_8_ai, 16*7},
+  {m68k_op_ori_8_pi, 16*7},
+  {m68k_op_ori_8_pi7, 16*7},
+  {m68k_op_ori_8_pd, 18*7},
+  {m68k_op_ori_8_pd7, 18*7},
+  {m68k_op_ori_8_di, 20*7},
+  {m68k_op_ori_8_ix, 22*7},
+  {m68k_op_ori_8_aw, 20*7},
+  {m68k_op_ori_8_al, 24*7},
+  {m68k_op_ori_16_toc, 20*7},
+  {m68k_op_ori_16_d, 8*7},
+  {m68k_op_ori_16_ai, 16*7},
+  {m68k_op_ori_16_pi, 16*7},
+  {m68k_op_ori_16_pd, 18*7},
+  {m68k_op_ori_16_di, 20*7},
+  {m68k_op_ori_16_ix, 22*7},
+  {m68k_op_ori_16_aw, 20*7},
+  {m68k_op_ori_16_al, 24*7},
+  {m68k_op_ori_16_tos, 20*7},
+  {m68k_op_ori_32_d, 16*7},
+  {m68k_op_ori_32_ai, 28*7},
+  {m68k_op_ori_32_pi, 28*7},
+  {m68k_op_ori_32_pd, 30*7},
+  {m68k_op_ori_32_di, 32*7},
+  {m68k_op_ori_32_ix, 34*7},
+  {m68k_op_ori_32_aw, 32*7},
+  {m68k_op_ori_32_al, 36*7},
+  {m68k_op_btst_32_r_d, 6*7},
+  {m68k_op_movep_16_er, 16*7},
+  {m68k_op_btst_8_r_ai, 8*7},
+  {m68k_op_btst_8_r_pi, 8*7},
+  {m68k_op_btst_8_r_pi7, 8*7},
+  {m68k_op_btst_8_r_pd, 10*7},
+  {m68k_op_btst_8_r_pd7, 10*7},
+  {m68k_op_btst_8_r_di, 12*7},
+  {m68k_op_btst_8_r_ix, 14*7},
+  {m68k_op_btst_8_r_aw, 12*7},
+  {m68k_op_btst_8_r_al, 16*7},
+  {m68k_op_btst_8_r_pcdi, 12*7},
+  {m68k_op_btst_8_r_pcix, 14*7},
+  {m68k_op_btst_8_r_i, 10*7},
+  {m68k_op_bchg_32_r_d, 8*7},
+  {m68k_op_movep_32_er, 24*7},
+  {m68k_op_bchg_8_r_ai, 12*7},
+  {m68k_op_bchg_8_r_pi, 12*7},
+  {m68k_op_bchg_8_r_pi7, 12*7},
+  {m68k_op_bchg_8_r_pd, 14*7},
+  {m68k_op_bchg_8_r_pd7, 14*7},
+  {m68k_op_bchg_8_r_di, 16*7},
+  {m68k_op_bchg_8_r_ix, 18*7},
+  {m68k_op_bchg_8_r_aw, 16*7},
+  {m68k_op_bchg_8_r_al, 20*7},
+  {m68k_op_bclr_32_r_d, 10*7},
+  {m68k_op_movep_16_re, 16*7},
+  {m68k_op_bclr_8_r_ai, 12*7},
+  {m68k_op_bclr_8_r_pi, 12*7},
+  {m68k_op_bclr_8_r_pi7, 12*7},
+  {m68k_op_bclr_8_r_pd, 14*7},
+  {m68k_op_bclr_8_r_pd7, 14*7},
+  {m68k_op_bclr_8_r_di, 16*7},
+  {m68k_op_bclr_8_r_ix, 18*7},
+  {m68k_op_bclr_8_r_aw, 16*7},
+  {m68k_op_bclr_8_r_al, 20*7},
+  {m68k_op_bset_32_r_d, 8*7},
+  {m68k_op_movep_32_re, 24*7},
+  {m68k_op_bset_8_r_ai, 12*7},
+  {m68k_op_bset_8_r_pi, 12*7},
+  {m68k_op_bset_8_r_pi7, 12*7},
+  {m68k_op_bset_8_r_pd, 14*7},
+  {m68k_op_bset_8_r_pd7, 14*7},
+  {m68k_op_bset_8_r_di, 16*7},
+  {m68k_op_bset_8_r_ix, 18*7},
+  {m68k_op_bset_8_r_aw, 16*7},
+  {m68k_op_bset_8_r_al, 20*7},
+  {m68k_op_andi_8_d, 8*7},
+  {m68k_op_andi_8_ai, 16*7},
+  {m68k_op_andi_8_pi, 16*7},
+  {m68k_op_andi_8_pi7, 16*7},
+  {m68k_op_andi_8_pd, 18*7},
+  {m68k_op_andi_8_pd7, 18*7},
+  {m68k_op_andi_8_di, 20*7},
+  {m68k_op_andi_8_ix, 22*7},
+  {m68k_op_andi_8_aw, 20*7},
+  {m68k_op_andi_8_al, 24*7},
+  {m68k_op_andi_16_toc, 20*7},
+  {m68k_op_andi_16_d, 8*7},
+  {m68k_op_andi_16_ai, 16*7},
+  {m68k_op_andi_16_pi, 16*7},
+  {m68k_op_andi_16_pd, 18*7},
+  {m68k_op_andi_16_di, 20*7},
+  {m68k_op_andi_16_ix, 22*7},
+  {m68k_op_andi_16_aw, 20*7},
+  {m68k_op_andi_16_al, 24*7},
+  {m68k_op_andi_16_tos, 20*7},
+  {m68k_op_andi_32_d, 16*7},
+  {m68k_op_andi_32_ai, 28*7},
+  {m68k_op_andi_32_pi, 28*7},
+  {m68k_op_andi_32_pd, 30*7},
+  {m68k_op_andi_32_di, 32*7},
+  {m68k_op_andi_32_ix, 34*7},
+  {m68k_op_andi_32_aw, 32*7},
+  {m68k_op_andi_32_al, 36*7},
+  {m68k_op_subi_8_d, 8*7},
+  {m68k_op_subi_8_ai, 16*7},
+  {m68k_op_subi_8_pi, 16*7},
+  {m68k_op_subi_8_pi7, 16*7},
+  {m68k_op_subi_8_pd, 18*7},
+  {m68k_op_subi_8_pd7, 18*7},
+  {m68k_op_subi_8_di, 20*7},
+  {m68k_op_subi_8_ix, 22*7},
+  {m68k_op_subi_8_aw, 20*7},
+  {m68k_op_subi_8_al, 24*7},
+  {m68k_op_subi_16_d, 8*7},
+  {m68k_op_subi_16_ai, 16*7},
+  {m68k_op_subi_16_pi, 16*7},
+  {m68k_op_subi_16_pd, 18*7},
+  {m68k_op_subi_16_di, 20*7},
+  {m68k_op_subi_16_ix, 22*7},
+  {m68k_op_subi_16_aw, 20*7},
+  {m68k_op_subi_16_al, 24*7},
+  {m68k_op_subi_32_d, 16*7},
+  {m68k_op_subi_32_ai, 28*7},
+  {m68k_op_subi_32_pi, 28*7},
+  {m68k_op_subi_32_pd, 30*7},
+  {m68k_op_subi_32_di, 32*7},
+  {m68k_op_subi_32_ix, 34*7},
+  {m68k_op_subi_32_aw, 32*7},
+  {m68k_op_subi_32_al, 36*7},
+  {m68k_op_addi_8_d, 8*7},
+  {m68k_op_addi_8_ai, 16*7},
+  {m68k_op_addi_8_pi, 16*7},
+  {m68k_op_addi_8_pi7, 16*7},
+  {m68k_op_addi_8_pd, 18*7},
+  {m68k_op_addi_8_pd7, 18*7},
+  {m68k_op_addi_8_di, 20*7},
+  {m68k_op_addi_8_ix, 22*7},
+  {m68k_op_addi_8_aw, 20*7},
+  {m68k_op_addi_8_al, 24*7},
+  {m68k_op_addi_16_d, 8*7},
+  {m68k_op_addi_16_ai, 16*7},
+  {m68k_op_addi_16_pi, 16*7},
+  {m68k_op_addi_16_pd, 18*7},
+  {m68k_op_addi_16_di, 20*7},
+  {m68k_op_addi_16_ix, 22*7},
+  {m68k_op_addi_16_aw, 20*7},
+  {m68k_op_addi_16_al, 24*7},
+  {m68k_op_addi_32_d, 16*7},
+  {m68k_op_addi_32_ai, 28*7},
+  {m68k_op_addi_32_pi, 28*7},
+  {m68k_op_addi_32_pd, 30*7},
+  {m68k_op_addi_32_di, 32*7},
+  {m68k_op_addi_32_ix, 34*7},
+  {m68k_op_addi_32_aw, 32*7},
+  {m68k_op_addi_32_al, 36*7},
+  {m68k_op_btst_32_s_d, 10*7},
+  {m68k_op_btst_8_s_ai, 12*7},
+  {m68k_op_btst_8_s_pi, 12*7},
+  {m68k_op_btst_8_s_pi7, 12*7},
+  {m68k_op_btst_8_s_pd, 14*7},
+  {m68k_op_btst_8_s_pd7, 14*7},
+  {m68k_op_btst_8_s_di, 16*7},
+  {m68k_op_btst_8_s_ix, 18*7},
+  {m68k_op_btst_8_s_aw, 16*7},
+  {m68k_op_btst_8_s_al, 20*7},
+  {m68k_op_btst_8_s_pcdi, 16*7},
+  {m68k_op_btst_8_s_pcix, 18*7},
+  {m68k_op_bchg_32_s_d, 12*7},
+  {m68k_op_bchg_8_s_ai, 16*7},
+  {m68k_op_bchg_8_s_pi, 16*7},
+  {m68k_op_bchg_8_s_pi7, 16*7},
+  {m68k_op_bchg_8_s_pd, 18*7},
+  {m68k_op_bchg_8_s_pd7, 18*7},
+  {m68k_op_bchg_8_s_di, 20*7},
+  {m68k_op_bchg_8_s_ix, 22*7},
+  {m68k_op_bchg_8_s_aw, 20*7},
+  {m68k_op_bchg_8_s_al, 24*7},
+  {m68k_op_bclr_32_s_d, 14*7},
+  {m68k_op_bclr_8_s_ai, 16*7},
+  {m68k_op_bclr_8_s_pi, 16*7},
+  {m68k_op_bclr_8_s_pi7, 16*7},
+  {m68k_op_bclr_8_s_pd, 18*7},
+  {m68k_op_bclr_8_s_pd7, 18*7},
+  {m68k_op_bclr_8_s_di, 20*7},
+  {m68k_op_bclr_8_s_ix, 22*7},
+  {m68k_op_bclr_8_s_aw, 20*7},
+  {m68k_op_bclr_8_s_al, 24*7},
+  {m68k_op_bset_32_s_d, 12*7},
+  {m68k_op_bset_8_s_ai, 16*7},
+  {m68k_op_bset_8_s_pi, 16*7},
+  {m68k_op_bset_8_s_pi7, 16*7},
+  {m68k_op_bset_8_s_pd, 18*7},
+  {m68k_op_bset_8_s_pd7, 18*7},
+  {m68k_op_bset_8_s_di, 20*7},
+  {m68k_op_bset_8_s_ix, 22*7},
+  {m68k_op_bset_8_s_aw, 20*7},
+  {m68k_op_bset_8_s_al, 24*7},
+  {m68k_op_eori_8_d, 8*7},
+  {m68k_op_eori_8_ai, 16*7},
+  {m68k_op_eori_8_pi, 16*7},
+  {m68k_op_eori_8_pi7, 16*7},
+  {m68k_op_eori_8_pd, 18*7},
+  {m68k_op_eori_8_pd7, 18*7},
+  {m68k_op_eori_8_di, 20*7},
+  {m68k_op_eori_8_ix, 22*7},
+  {m68k_op_eori_8_aw, 20*7},
+  {m68k_op_eori_8_al, 24*7},
+  {m68k_op_eori_16_toc, 20*7},
+  {m68k_op_eori_16_d, 8*7},
+  {m68k_op_eori_16_ai, 16*7},
+  {m68k_op_eori_16_pi, 16*7},
+  {m68k_op_eori_16_pd, 18*7},
+  {m68k_op_eori_16_di, 20*7},
+  {m68k_op_eori_16_ix, 22*7},
+  {m68k_op_eori_16_aw, 20*7},
+  {m68k_op_eori_16_al, 24*7},
+  {m68k_op_eori_16_tos, 20*7},
+  {m68k_op_eori_32_d, 16*7},
+  {m68k_op_eori_32_ai, 28*7},
+  {m68k_op_eori_32_pi, 28*7},
+  {m68k_op_eori_32_pd, 30*7},
+  {m68k_op_eori_32_di, 32*7},
+  {m68k_op_eori_32_ix, 34*7},
+  {m68k_op_eori_32_aw, 32*7},
+  {m68k_op_eori_32_al, 36*7},
+  {m68k_op_cmpi_8_d, 8*7},
+  {m68k_op_cmpi_8_ai, 12*7},
+  {m68k_op_cmpi_8_pi, 12*7},
+  {m68k_op_cmpi_8_pi7, 12*7},
+  {m68k_op_cmpi_8_pd, 14*7},
+  {m68k_op_cmpi_8_pd7, 14*7},
+  {m68k_op_cmpi_8_di, 16*7},
+  {m68k_op_cmpi_8_ix, 18*7},
+  {m68k_op_cmpi_8_aw, 16*7},
+  {m68k_op_cmpi_8_al, 20*7},
+  {m68k_op_cmpi_16_d, 8*7},
+  {m68k_op_cmpi_16_ai, 12*7},
+  {m68k_op_cmpi_16_pi, 12*7},
+  {m68k_op_cmpi_16_pd, 14*7},
+  {m68k_op_cmpi_16_di, 16*7},
+  {m68k_op_cmpi_16_ix, 18*7},
+  {m68k_op_cmpi_16_aw, 16*7},
+  {m68k_op_cmpi_16_al, 20*7},
+  {m68k_op_cmpi_32_d, 14*7},
+  {m68k_op_cmpi_32_ai, 20*7},
+  {m68k_op_cmpi_32_pi, 20*7},
+  {m68k_op_cmpi_32_pd, 22*7},
+  {m68k_op_cmpi_32_di, 24*7},
+  {m68k_op_cmpi_32_ix, 26*7},
+  {m68k_op_cmpi_32_aw, 24*7},
+  {m68k_op_cmpi_32_al, 28*7},
+  {m68k_op_move_8_d_d, 4*7},
+  {m68k_op_move_8_d_ai, 8*7},
+  {m68k_op_move_8_d_pi, 8*7},
+  {m68k_op_move_8_d_pi7, 8*7},
+  {m68k_op_move_8_d_pd, 10*7},
+  {m68k_op_move_8_d_pd7, 10*7},
+  {m68k_op_move_8_d_di, 12*7},
+  {m68k_op_move_8_d_ix, 14*7},
+  {m68k_op_move_8_d_aw, 12*7},
+  {m68k_op_move_8_d_al, 16*7},
+  {m68k_op_move_8_d_pcdi, 12*7},
+  {m68k_op_move_8_d_pcix, 14*7},
+  {m68k_op_move_8_d_i, 8*7},
+  {m68k_op_move_8_ai_d, 8*7},
+  {m68k_op_move_8_ai_ai, 12*7},
+  {m68k_op_move_8_ai_pi, 12*7},
+  {m68k_op_move_8_ai_pi7, 12*7},
+  {m68k_op_move_8_ai_pd, 14*7},
+  {m68k_op_move_8_ai_pd7, 14*7},
+  {m68k_op_move_8_ai_di, 16*7},
+  {m68k_op_move_8_ai_ix, 18*7},
+  {m68k_op_move_8_ai_aw, 16*7},
+  {m68k_op_move_8_ai_al, 20*7},
+  {m68k_op_move_8_ai_pcdi, 16*7},
+  {m68k_op_move_8_ai_pcix, 18*7},
+  {m68k_op_move_8_ai_i, 12*7},
+  {m68k_op_move_8_pi_d, 8*7},
+  {m68k_op_move_8_pi_ai, 12*7},
+  {m68k_op_move_8_pi_pi, 12*7},
+  {m68k_op_move_8_pi_pi7, 12*7},
+  {m68k_op_move_8_pi_pd, 14*7},
+  {m68k_op_move_8_pi_pd7, 14*7},
+  {m68k_op_move_8_pi_di, 16*7},
+  {m68k_op_move_8_pi_ix, 18*7},
+  {m68k_op_move_8_pi_aw, 16*7},
+  {m68k_op_move_8_pi_al, 20*7},
+  {m68k_op_move_8_pi_pcdi, 16*7},
+  {m68k_op_move_8_pi_pcix, 18*7},
+  {m68k_op_move_8_pi_i, 12*7},
+  {m68k_op_move_8_pd_d, 8*7},
+  {m68k_op_move_8_pd_ai, 12*7},
+  {m68k_op_move_8_pd_pi, 12*7},
+  {m68k_op_move_8_pd_pi7, 12*7},
+  {m68k_op_move_8_pd_pd, 14*7},
+  {m68k_op_move_8_pd_pd7, 14*7},
+  {m68k_op_move_8_pd_di, 16*7},
+  {m68k_op_move_8_pd_ix, 18*7},
+  {m68k_op_move_8_pd_aw, 16*7},
+  {m68k_op_move_8_pd_al, 20*7},
+  {m68k_op_move_8_pd_pcdi, 16*7},
+  {m68k_op_move_8_pd_pcix, 18*7},
+  {m68k_op_move_8_pd_i, 12*7},
+  {m68k_op_move_8_di_d, 12*7},
+  {m68k_op_move_8_di_ai, 16*7},
+  {m68k_op_move_8_di_pi, 16*7},
+  {m68k_op_move_8_di_pi7, 16*7},
+  {m68k_op_move_8_di_pd, 18*7},
+  {m68k_op_move_8_di_pd7, 18*7},
+  {m68k_op_move_8_di_di, 20*7},
+  {m68k_op_move_8_di_ix, 22*7},
+  {m68k_op_move_8_di_aw, 20*7},
+  {m68k_op_move_8_di_al, 24*7},
+  {m68k_op_move_8_di_pcdi, 20*7},
+  {m68k_op_move_8_di_pcix, 22*7},
+  {m68k_op_move_8_di_i, 16*7},
+  {m68k_op_move_8_ix_d, 14*7},
+  {m68k_op_move_8_ix_ai, 18*7},
+  {m68k_op_move_8_ix_pi, 18*7},
+  {m68k_op_move_8_ix_pi7, 18*7},
+  {m68k_op_move_8_ix_pd, 20*7},
+  {m68k_op_move_8_ix_pd7, 20*7},
+  {m68k_op_move_8_ix_di, 22*7},
+  {m68k_op_move_8_ix_ix, 24*7},
+  {m68k_op_move_8_ix_aw, 22*7},
+  {m68k_op_move_8_ix_al, 26*7},
+  {m68k_op_move_8_ix_pcdi, 22*7},
+  {m68k_op_move_8_ix_pcix, 24*7},
+  {m68k_op_move_8_ix_i, 18*7},
+  {m68k_op_move_8_aw_d, 12*7},
+  {m68k_op_move_8_aw_ai, 16*7},
+  {m68k_op_move_8_aw_pi, 16*7},
+  {m68k_op_move_8_aw_pi7, 16*7},
+  {m68k_op_move_8_aw_pd, 18*7},
+  {m68k_op_move_8_aw_pd7, 18*7},
+  {m68k_op_move_8_aw_di, 20*7},
+  {m68k_op_move_8_aw_ix, 22*7},
+  {m68k_op_move_8_aw_aw, 20*7},
+  {m68k_op_move_8_aw_al, 24*7},
+  {m68k_op_move_8_aw_pcdi, 20*7},
+  {m68k_op_move_8_aw_pcix, 22*7},
+  {m68k_op_move_8_aw_i, 16*7},
+  {m68k_op_move_8_al_d, 16*7},
+  {m68k_op_move_8_al_ai, 20*7},
+  {m68k_op_move_8_al_pi, 20*7},
+  {m68k_op_move_8_al_pi7, 20*7},
+  {m68k_op_move_8_al_pd, 22*7},
+  {m68k_op_move_8_al_pd7, 22*7},
+  {m68k_op_move_8_al_di, 24*7},
+  {m68k_op_move_8_al_ix, 26*7},
+  {m68k_op_move_8_al_aw, 24*7},
+  {m68k_op_move_8_al_al, 28*7},
+  {m68k_op_move_8_al_pcdi, 24*7},
+  {m68k_op_move_8_al_pcix, 26*7},
+  {m68k_op_move_8_al_i, 20*7},
+  {m68k_op_move_8_pi7_d, 8*7},
+  {m68k_op_move_8_pi7_ai, 12*7},
+  {m68k_op_move_8_pi7_pi, 12*7},
+  {m68k_op_move_8_pi7_pi7, 12*7},
+  {m68k_op_move_8_pi7_pd, 14*7},
+  {m68k_op_move_8_pi7_pd7, 14*7},
+  {m68k_op_move_8_pi7_di, 16*7},
+  {m68k_op_move_8_pi7_ix, 18*7},
+  {m68k_op_move_8_pi7_aw, 16*7},
+  {m68k_op_move_8_pi7_al, 20*7},
+  {m68k_op_move_8_pi7_pcdi, 16*7},
+  {m68k_op_move_8_pi7_pcix, 18*7},
+  {m68k_op_move_8_pi7_i, 12*7},
+  {m68k_op_move_8_pd7_d, 8*7},
+  {m68k_op_move_8_pd7_ai, 12*7},
+  {m68k_op_move_8_pd7_pi, 12*7},
+  {m68k_op_move_8_pd7_pi7, 12*7},
+  {m68k_op_move_8_pd7_pd, 14*7},
+  {m68k_op_move_8_pd7_pd7, 14*7},
+  {m68k_op_move_8_pd7_di, 16*7},
+  {m68k_op_move_8_pd7_ix, 18*7},
+  {m68k_op_move_8_pd7_aw, 16*7},
+  {m68k_op_move_8_pd7_al, 20*7},
+  {m68k_op_move_8_pd7_pcdi, 16*7},
+  {m68k_op_move_8_pd7_pcix, 18*7},
+  {m68k_op_move_8_pd7_i, 12*7},
+  {m68k_op_move_32_d_d, 4*7},
+  {m68k_op_move_32_d_a, 4*7},
+  {m68k_op_move_32_d_ai, 12*7},
+  {m68k_op_move_32_d_pi, 12*7},
+  {m68k_op_move_32_d_pd, 14*7},
+  {m68k_op_move_32_d_di, 16*7},
+  {m68k_op_move_32_d_ix, 18*7},
+  {m68k_op_move_32_d_aw, 16*7},
+  {m68k_op_move_32_d_al, 20*7},
+  {m68k_op_move_32_d_pcdi, 16*7},
+  {m68k_op_move_32_d_pcix, 18*7},
+  {m68k_op_move_32_d_i, 12*7},
+  {m68k_op_movea_32_d, 4*7},
+  {m68k_op_movea_32_a, 4*7},
+  {m68k_op_movea_32_ai, 12*7},
+  {m68k_op_movea_32_pi, 12*7},
+  {m68k_op_movea_32_pd, 14*7},
+  {m68k_op_movea_32_di, 16*7},
+  {m68k_op_movea_32_ix, 18*7},
+  {m68k_op_movea_32_aw, 16*7},
+  {m68k_op_movea_32_al, 20*7},
+  {m68k_op_movea_32_pcdi, 16*7},
+  {m68k_op_movea_32_pcix, 18*7},
+  {m68k_op_movea_32_i, 12*7},
+  {m68k_op_move_32_ai_d, 12*7},
+  {m68k_op_move_32_ai_a, 12*7},
+  {m68k_op_move_32_ai_ai, 20*7},
+  {m68k_op_move_32_ai_pi, 20*7},
+  {m68k_op_move_32_ai_pd, 22*7},
+  {m68k_op_move_32_ai_di, 24*7},
+  {m68k_op_move_32_ai_ix, 26*7},
+  {m68k_op_move_32_ai_aw, 24*7},
+  {m68k_op_move_32_ai_al, 28*7},
+  {m68k_op_move_32_ai_pcdi, 24*7},
+  {m68k_op_move_32_ai_pcix, 26*7},
+  {m68k_op_move_32_ai_i, 20*7},
+  {m68k_op_move_32_pi_d, 12*7},
+  {m68k_op_move_32_pi_a, 12*7},
+  {m68k_op_move_32_pi_ai, 20*7},
+  {m68k_op_move_32_pi_pi, 20*7},
+  {m68k_op_move_32_pi_pd, 22*7},
+  {m68k_op_move_32_pi_di, 24*7},
+  {m68k_op_move_32_pi_ix, 26*7},
+  {m68k_op_move_32_pi_aw, 24*7},
+  {m68k_op_move_32_pi_al, 28*7},
+  {m68k_op_move_32_pi_pcdi, 24*7},
+  {m68k_op_move_32_pi_pcix, 26*7},
+  {m68k_op_move_32_pi_i, 20*7},
+  {m68k_op_move_32_pd_d, 12*7},
+  {m68k_op_move_32_pd_a, 12*7},
+  {m68k_op_move_32_pd_ai, 20*7},
+  {m68k_op_move_32_pd_pi, 20*7},
+  {m68k_op_move_32_pd_pd, 22*7},
+  {m68k_op_move_32_pd_di, 24*7},
+  {m68k_op_move_32_pd_ix, 26*7},
+  {m68k_op_move_32_pd_aw, 24*7},
+  {m68k_op_move_32_pd_al, 28*7},
+  {m68k_op_move_32_pd_pcdi, 24*7},
+  {m68k_op_move_32_pd_pcix, 26*7},
+  {m68k_op_move_32_pd_i, 20*7},
+  {m68k_op_move_32_di_d, 16*7},
+  {m68k_op_move_32_di_a, 16*7},
+  {m68k_op_move_32_di_ai, 24*7},
+  {m68k_op_move_32_di_pi, 24*7},
+  {m68k_op_move_32_di_pd, 26*7},
+  {m68k_op_move_32_di_di, 28*7},
+  {m68k_op_move_32_di_ix, 30*7},
+  {m68k_op_move_32_di_aw, 28*7},
+  {m68k_op_move_32_di_al, 32*7},
+  {m68k_op_move_32_di_pcdi, 28*7},
+  {m68k_op_move_32_di_pcix, 30*7},
+  {m68k_op_move_32_di_i, 24*7},
+  {m68k_op_move_32_ix_d, 18*7},
+  {m68k_op_move_32_ix_a, 18*7},
+  {m68k_op_move_32_ix_ai, 26*7},
+  {m68k_op_move_32_ix_pi, 26*7},
+  {m68k_op_move_32_ix_pd, 28*7},
+  {m68k_op_move_32_ix_di, 30*7},
+  {m68k_op_move_32_ix_ix, 32*7},
+  {m68k_op_move_32_ix_aw, 30*7},
+  {m68k_op_move_32_ix_al, 34*7},
+  {m68k_op_move_32_ix_pcdi, 30*7},
+  {m68k_op_move_32_ix_pcix, 32*7},
+  {m68k_op_move_32_ix_i, 26*7},
+  {m68k_op_move_32_aw_d, 16*7},
+  {m68k_op_move_32_aw_a, 16*7},
+  {m68k_op_move_32_aw_ai, 24*7},
+  {m68k_op_move_32_aw_pi, 24*7},
+  {m68k_op_move_32_aw_pd, 26*7},
+  {m68k_op_move_32_aw_di, 28*7},
+  {m68k_op_move_32_aw_ix, 30*7},
+  {m68k_op_move_32_aw_aw, 28*7},
+  {m68k_op_move_32_aw_al, 32*7},
+  {m68k_op_move_32_aw_pcdi, 28*7},
+  {m68k_op_move_32_aw_pcix, 30*7},
+  {m68k_op_move_32_aw_i, 24*7},
+  {m68k_op_move_32_al_d, 20*7},
+  {m68k_op_move_32_al_a, 20*7},
+  {m68k_op_move_32_al_ai, 28*7},
+  {m68k_op_move_32_al_pi, 28*7},
+  {m68k_op_move_32_al_pd, 30*7},
+  {m68k_op_move_32_al_di, 32*7},
+  {m68k_op_move_32_al_ix, 34*7},
+  {m68k_op_move_32_al_aw, 32*7},
+  {m68k_op_move_32_al_al, 36*7},
+  {m68k_op_move_32_al_pcdi, 32*7},
+  {m68k_op_move_32_al_pcix, 34*7},
+  {m68k_op_move_32_al_i, 28*7},
+  {m68k_op_move_16_d_d, 4*7},
+  {m68k_op_move_16_d_a, 4*7},
+  {m68k_op_move_16_d_ai, 8*7},
+  {m68k_op_move_16_d_pi, 8*7},
+  {m68k_op_move_16_d_pd, 10*7},
+  {m68k_op_move_16_d_di, 12*7},
+  {m68k_op_move_16_d_ix, 14*7},
+  {m68k_op_move_16_d_aw, 12*7},
+  {m68k_op_move_16_d_al, 16*7},
+  {m68k_op_move_16_d_pcdi, 12*7},
+  {m68k_op_move_16_d_pcix, 14*7},
+  {m68k_op_move_16_d_i, 8*7},
+  {m68k_op_movea_16_d, 4*7},
+  {m68k_op_movea_16_a, 4*7},
+  {m68k_op_movea_16_ai, 8*7},
+  {m68k_op_movea_16_pi, 8*7},
+  {m68k_op_movea_16_pd, 10*7},
+  {m68k_op_movea_16_di, 12*7},
+  {m68k_op_movea_16_ix, 14*7},
+  {m68k_op_movea_16_aw, 12*7},
+  {m68k_op_movea_16_al, 16*7},
+  {m68k_op_movea_16_pcdi, 12*7},
+  {m68k_op_movea_16_pcix, 14*7},
+  {m68k_op_movea_16_i, 8*7},
+  {m68k_op_move_16_ai_d, 8*7},
+  {m68k_op_move_16_ai_a, 8*7},
+  {m68k_op_move_16_ai_ai, 12*7},
+  {m68k_op_move_16_ai_pi, 12*7},
+  {m68k_op_move_16_ai_pd, 14*7},
+  {m68k_op_move_16_ai_di, 16*7},
+  {m68k_op_move_16_ai_ix, 18*7},
+  {m68k_op_move_16_ai_aw, 16*7},
+  {m68k_op_move_16_ai_al, 20*7},
+  {m68k_op_move_16_ai_pcdi, 16*7},
+  {m68k_op_move_16_ai_pcix, 18*7},
+  {m68k_op_move_16_ai_i, 12*7},
+  {m68k_op_move_16_pi_d, 8*7},
+  {m68k_op_move_16_pi_a, 8*7},
+  {m68k_op_move_16_pi_ai, 12*7},
+  {m68k_op_move_16_pi_pi, 12*7},
+  {m68k_op_move_16_pi_pd, 14*7},
+  {m68k_op_move_16_pi_di, 16*7},
+  {m68k_op_move_16_pi_ix, 18*7},
+  {m68k_op_move_16_pi_aw, 16*7},
+  {m68k_op_move_16_pi_al, 20*7},
+  {m68k_op_move_16_pi_pcdi, 16*7},
+  {m68k_op_move_16_pi_pcix, 18*7},
+  {m68k_op_move_16_pi_i, 12*7},
+  {m68k_op_move_16_pd_d, 8*7},
+  {m68k_op_move_16_pd_a, 8*7},
+  {m68k_op_move_16_pd_ai, 12*7},
+  {m68k_op_move_16_pd_pi, 12*7},
+  {m68k_op_move_16_pd_pd, 14*7},
+  {m68k_op_move_16_pd_di, 16*7},
+  {m68k_op_move_16_pd_ix, 18*7},
+  {m68k_op_move_16_pd_aw, 16*7},
+  {m68k_op_move_16_pd_al, 20*7},
+  {m68k_op_move_16_pd_pcdi, 16*7},
+  {m68k_op_move_16_pd_pcix, 18*7},
+  {m68k_op_move_16_pd_i, 12*7},
+  {m68k_op_move_16_di_d, 12*7},
+  {m68k_op_move_16_di_a, 12*7},
+  {m68k_op_move_16_di_ai, 16*7},
+  {m68k_op_move_16_di_pi, 16*7},
+  {m68k_op_move_16_di_pd, 18*7},
+  {m68k_op_move_16_di_di, 20*7},
+  {m68k_op_move_16_di_ix, 22*7},
+  {m68k_op_move_16_di_aw, 20*7},
+  {m68k_op_move_16_di_al, 24*7},
+  {m68k_op_move_16_di_pcdi, 20*7},
+  {m68k_op_move_16_di_pcix, 22*7},
+  {m68k_op_move_16_di_i, 16*7},
+  {m68k_op_move_16_ix_d, 14*7},
+  {m68k_op_move_16_ix_a, 14*7},
+  {m68k_op_move_16_ix_ai, 18*7},
+  {m68k_op_move_16_ix_pi, 18*7},
+  {m68k_op_move_16_ix_pd, 20*7},
+  {m68k_op_move_16_ix_di, 22*7},
+  {m68k_op_move_16_ix_ix, 24*7},
+  {m68k_op_move_16_ix_aw, 22*7},
+  {m68k_op_move_16_ix_al, 26*7},
+  {m68k_op_move_16_ix_pcdi, 22*7},
+  {m68k_op_move_16_ix_pcix, 24*7},
+  {m68k_op_move_16_ix_i, 18*7},
+  {m68k_op_move_16_aw_d, 12*7},
+  {m68k_op_move_16_aw_a, 12*7},
+  {m68k_op_move_16_aw_ai, 16*7},
+  {m68k_op_move_16_aw_pi, 16*7},
+  {m68k_op_move_16_aw_pd, 18*7},
+  {m68k_op_move_16_aw_di, 20*7},
+  {m68k_op_move_16_aw_ix, 22*7},
+  {m68k_op_move_16_aw_aw, 20*7},
+  {m68k_op_move_16_aw_al, 24*7},
+  {m68k_op_move_16_aw_pcdi, 20*7},
+  {m68k_op_move_16_aw_pcix, 22*7},
+  {m68k_op_move_16_aw_i, 16*7},
+  {m68k_op_move_16_al_d, 16*7},
+  {m68k_op_move_16_al_a, 16*7},
+  {m68k_op_move_16_al_ai, 20*7},
+  {m68k_op_move_16_al_pi, 20*7},
+  {m68k_op_move_16_al_pd, 22*7},
+  {m68k_op_move_16_al_di, 24*7},
+  {m68k_op_move_16_al_ix, 26*7},
+  {m68k_op_move_16_al_aw, 24*7},
+  {m68k_op_move_16_al_al, 28*7},
+  {m68k_op_move_16_al_pcdi, 24*7},
+  {m68k_op_move_16_al_pcix, 26*7},
+  {m68k_op_move_16_al_i, 20*7},
+  {m68k_op_negx_8_d, 4*7},
+  {m68k_op_negx_8_ai, 12*7},
+  {m68k_op_negx_8_pi, 12*7},
+  {m68k_op_negx_8_pi7, 12*7},
+  {m68k_op_negx_8_pd, 14*7},
+  {m68k_op_negx_8_pd7, 14*7},
+  {m68k_op_negx_8_di, 16*7},
+  {m68k_op_negx_8_ix, 18*7},
+  {m68k_op_negx_8_aw, 16*7},
+  {m68k_op_negx_8_al, 20*7},
+  {m68k_op_negx_16_d, 4*7},
+  {m68k_op_negx_16_ai, 12*7},
+  {m68k_op_negx_16_pi, 12*7},
+  {m68k_op_negx_16_pd, 14*7},
+  {m68k_op_negx_16_di, 16*7},
+  {m68k_op_negx_16_ix, 18*7},
+  {m68k_op_negx_16_aw, 16*7},
+  {m68k_op_negx_16_al, 20*7},
+  {m68k_op_negx_32_d, 6*7},
+  {m68k_op_negx_32_ai, 20*7},
+  {m68k_op_negx_32_pi, 20*7},
+  {m68k_op_negx_32_pd, 22*7},
+  {m68k_op_negx_32_di, 24*7},
+  {m68k_op_negx_32_ix, 26*7},
+  {m68k_op_negx_32_aw, 24*7},
+  {m68k_op_negx_32_al, 28*7},
+  {m68k_op_move_16_frs_d, 6*7},
+  {m68k_op_move_16_frs_ai, 12*7},
+  {m68k_op_move_16_frs_pi, 12*7},
+  {m68k_op_move_16_frs_pd, 14*7},
+  {m68k_op_move_16_frs_di, 16*7},
+  {m68k_op_move_16_frs_ix, 18*7},
+  {m68k_op_move_16_frs_aw, 16*7},
+  {m68k_op_move_16_frs_al, 20*7},
+  {m68k_op_chk_16_d, 10*7},
+  {m68k_op_chk_16_ai, 14*7},
+  {m68k_op_chk_16_pi, 14*7},
+  {m68k_op_chk_16_pd, 16*7},
+  {m68k_op_chk_16_di, 18*7},
+  {m68k_op_chk_16_ix, 20*7},
+  {m68k_op_chk_16_aw, 18*7},
+  {m68k_op_chk_16_al, 22*7},
+  {m68k_op_chk_16_pcdi, 18*7},
+  {m68k_op_chk_16_pcix, 20*7},
+  {m68k_op_chk_16_i, 14*7},
+  {m68k_op_lea_32_ai, 4*7},
+  {m68k_op_lea_32_di, 8*7},
+  {m68k_op_lea_32_ix, 12*7},
+  {m68k_op_lea_32_aw, 8*7},
+  {m68k_op_lea_32_al, 12*7},
+  {m68k_op_lea_32_pcdi, 8*7},
+  {m68k_op_lea_32_pcix, 12*7},
+  {m68k_op_clr_8_d, 4*7},
+  {m68k_op_clr_8_ai, 12*7},
+  {m68k_op_clr_8_pi, 12*7},
+  {m68k_op_clr_8_pi7, 12*7},
+  {m68k_op_clr_8_pd, 14*7},
+  {m68k_op_clr_8_pd7, 14*7},
+  {m68k_op_clr_8_di, 16*7},
+  {m68k_op_clr_8_ix, 18*7},
+  {m68k_op_clr_8_aw, 16*7},
+  {m68k_op_clr_8_al, 20*7},
+  {m68k_op_clr_16_d, 4*7},
+  {m68k_op_clr_16_ai, 12*7},
+  {m68k_op_clr_16_pi, 12*7},
+  {m68k_op_clr_16_pd, 14*7},
+  {m68k_op_clr_16_di, 16*7},
+  {m68k_op_clr_16_ix, 18*7},
+  {m68k_op_clr_16_aw, 16*7},
+  {m68k_op_clr_16_al, 20*7},
+  {m68k_op_clr_32_d, 6*7},
+  {m68k_op_clr_32_ai, 20*7},
+  {m68k_op_clr_32_pi, 20*7},
+  {m68k_op_clr_32_pd, 22*7},
+  {m68k_op_clr_32_di, 24*7},
+  {m68k_op_clr_32_ix, 26*7},
+  {m68k_op_clr_32_aw, 24*7},
+  {m68k_op_clr_32_al, 28*7},
+  {m68k_op_neg_8_d, 4*7},
+  {m68k_op_neg_8_ai, 12*7},
+  {m68k_op_neg_8_pi, 12*7},
+  {m68k_op_neg_8_pi7, 12*7},
+  {m68k_op_neg_8_pd, 14*7},
+  {m68k_op_neg_8_pd7, 14*7},
+  {m68k_op_neg_8_di, 16*7},
+  {m68k_op_neg_8_ix, 18*7},
+  {m68k_op_neg_8_aw, 16*7},
+  {m68k_op_neg_8_al, 20*7},
+  {m68k_op_neg_16_d, 4*7},
+  {m68k_op_neg_16_ai, 12*7},
+  {m68k_op_neg_16_pi, 12*7},
+  {m68k_op_neg_16_pd, 14*7},
+  {m68k_op_neg_16_di, 16*7},
+  {m68k_op_neg_16_ix, 18*7},
+  {m68k_op_neg_16_aw, 16*7},
+  {m68k_op_neg_16_al, 20*7},
+  {m68k_op_neg_32_d, 6*7},
+  {m68k_op_neg_32_ai, 20*7},
+  {m68k_op_neg_32_pi, 20*7},
+  {m68k_op_neg_32_pd, 22*7},
+  {m68k_op_neg_32_di, 24*7},
+  {m68k_op_neg_32_ix, 26*7},
+  {m68k_op_neg_32_aw, 24*7},
+  {m68k_op_neg_32_al, 28*7},
+  {m68k_op_move_16_toc_d, 12*7},
+  {m68k_op_move_16_toc_ai, 16*7},
+  {m68k_op_move_16_toc_pi, 16*7},
+  {m68k_op_move_16_toc_pd, 18*7},
+  {m68k_op_move_16_toc_di, 20*7},
+  {m68k_op_move_16_toc_ix, 22*7},
+  {m68k_op_move_16_toc_aw, 20*7},
+  {m68k_op_move_16_toc_al, 24*7},
+  {m68k_op_move_16_toc_pcdi, 20*7},
+  {m68k_op_move_16_toc_pcix, 22*7},
+  {m68k_op_move_16_toc_i, 16*7},
+  {m68k_op_not_8_d, 4*7},
+  {m68k_op_not_8_ai, 12*7},
+  {m68k_op_not_8_pi, 12*7},
+  {m68k_op_not_8_pi7, 12*7},
+  {m68k_op_not_8_pd, 14*7},
+  {m68k_op_not_8_pd7, 14*7},
+  {m68k_op_not_8_di, 16*7},
+  {m68k_op_not_8_ix, 18*7},
+  {m68k_op_not_8_aw, 16*7},
+  {m68k_op_not_8_al, 20*7},
+  {m68k_op_not_16_d, 4*7},
+  {m68k_op_not_16_ai, 12*7},
+  {m68k_op_not_16_pi, 12*7},
+  {m68k_op_not_16_pd, 14*7},
+  {m68k_op_not_16_di, 16*7},
+  {m68k_op_not_16_ix, 18*7},
+  {m68k_op_not_16_aw, 16*7},
+  {m68k_op_not_16_al, 20*7},
+  {m68k_op_not_32_d, 6*7},
+  {m68k_op_not_32_ai, 20*7},
+  {m68k_op_not_32_pi, 20*7},
+  {m68k_op_not_32_pd, 22*7},
+  {m68k_op_not_32_di, 24*7},
+  {m68k_op_not_32_ix, 26*7},
+  {m68k_op_not_32_aw, 24*7},
+  {m68k_op_not_32_al, 28*7},
+  {m68k_op_move_16_tos_d, 12*7},
+  {m68k_op_move_16_tos_ai, 16*7},
+  {m68k_op_move_16_tos_pi, 16*7},
+  {m68k_op_move_16_tos_pd, 18*7},
+  {m68k_op_move_16_tos_di, 20*7},
+  {m68k_op_move_16_tos_ix, 22*7},
+  {m68k_op_move_16_tos_aw, 20*7},
+  {m68k_op_move_16_tos_al, 24*7},
+  {m68k_op_move_16_tos_pcdi, 20*7},
+  {m68k_op_move_16_tos_pcix, 22*7},
+  {m68k_op_move_16_tos_i, 16*7},
+  {m68k_op_nbcd_8_d, 6*7},
+  {m68k_op_nbcd_8_ai, 12*7},
+  {m68k_op_nbcd_8_pi, 12*7},
+  {m68k_op_nbcd_8_pi7, 12*7},
+  {m68k_op_nbcd_8_pd, 14*7},
+  {m68k_op_nbcd_8_pd7, 14*7},
+  {m68k_op_nbcd_8_di, 16*7},
+  {m68k_op_nbcd_8_ix, 18*7},
+  {m68k_op_nbcd_8_aw, 16*7},
+  {m68k_op_nbcd_8_al, 20*7},
+  {m68k_op_swap_32, 4*7},
+  {m68k_op_pea_32_ai, 12*7},
+  {m68k_op_pea_32_di, 16*7},
+  {m68k_op_pea_32_ix, 20*7},
+  {m68k_op_pea_32_aw, 16*7},
+  {m68k_op_pea_32_al, 20*7},
+  {m68k_op_pea_32_pcdi, 16*7},
+  {m68k_op_pea_32_pcix, 20*7},
+  {m68k_op_ext_16, 4*7},
+  {m68k_op_movem_16_re_ai, 8*7},
+  {m68k_op_movem_16_re_pd, 8*7},
+  {m68k_op_movem_16_re_di, 12*7},
+  {m68k_op_movem_16_re_ix, 14*7},
+  {m68k_op_movem_16_re_aw, 12*7},
+  {m68k_op_movem_16_re_al, 16*7},
+  {m68k_op_ext_32, 4*7},
+  {m68k_op_movem_32_re_ai, 8*7},
+  {m68k_op_movem_32_re_pd, 8*7},
+  {m68k_op_movem_32_re_di, 12*7},
+  {m68k_op_movem_32_re_ix, 14*7},
+  {m68k_op_movem_32_re_aw, 12*7},
+  {m68k_op_movem_32_re_al, 16*7},
+  {m68k_op_tst_8_d, 4*7},
+  {m68k_op_tst_8_ai, 8*7},
+  {m68k_op_tst_8_pi, 8*7},
+  {m68k_op_tst_8_pi7, 8*7},
+  {m68k_op_tst_8_pd, 10*7},
+  {m68k_op_tst_8_pd7, 10*7},
+  {m68k_op_tst_8_di, 12*7},
+  {m68k_op_tst_8_ix, 14*7},
+  {m68k_op_tst_8_aw, 12*7},
+  {m68k_op_tst_8_al, 16*7},
+  {m68k_op_tst_16_d, 4*7},
+  {m68k_op_tst_16_ai, 8*7},
+  {m68k_op_tst_16_pi, 8*7},
+  {m68k_op_tst_16_pd, 10*7},
+  {m68k_op_tst_16_di, 12*7},
+  {m68k_op_tst_16_ix, 14*7},
+  {m68k_op_tst_16_aw, 12*7},
+  {m68k_op_tst_16_al, 16*7},
+  {m68k_op_tst_32_d, 4*7},
+  {m68k_op_tst_32_ai, 12*7},
+  {m68k_op_tst_32_pi, 12*7},
+  {m68k_op_tst_32_pd, 14*7},
+  {m68k_op_tst_32_di, 16*7},
+  {m68k_op_tst_32_ix, 18*7},
+  {m68k_op_tst_32_aw, 16*7},
+  {m68k_op_tst_32_al, 20*7},
+  {m68k_op_tas_8_d, 4*7},
+  {m68k_op_tas_8_ai, 14*7},
+  {m68k_op_tas_8_pi, 14*7},
+  {m68k_op_tas_8_pi7, 14*7},
+  {m68k_op_tas_8_pd, 16*7},
+  {m68k_op_tas_8_pd7, 16*7},
+  {m68k_op_tas_8_di, 18*7},
+  {m68k_op_tas_8_ix, 20*7},
+  {m68k_op_tas_8_aw, 18*7},
+  {m68k_op_tas_8_al, 22*7},
+  {m68k_op_illegal, 4*7},
+  {m68k_op_movem_16_er_ai, 12*7},
+  {m68k_op_movem_16_er_pi, 12*7},
+  {m68k_op_movem_16_er_di, 16*7},
+  {m68k_op_movem_16_er_ix, 18*7},
+  {m68k_op_movem_16_er_aw, 16*7},
+  {m68k_op_movem_16_er_al, 20*7},
+  {m68k_op_movem_16_er_pcdi, 16*7},
+  {m68k_op_movem_16_er_pcix, 18*7},
+  {m68k_op_movem_32_er_ai, 12*7},
+  {m68k_op_movem_32_er_pi, 12*7},
+  {m68k_op_movem_32_er_di, 16*7},
+  {m68k_op_movem_32_er_ix, 18*7},
+  {m68k_op_movem_32_er_aw, 16*7},
+  {m68k_op_movem_32_er_al, 20*7},
+  {m68k_op_movem_32_er_pcdi, 16*7},
+  {m68k_op_movem_32_er_pcix, 18*7},
+  {m68k_op_trap, 4*7},
+  {m68k_op_link_16, 16*7},
+  {m68k_op_link_16_a7, 16*7},
+  {m68k_op_unlk_32, 12*7},
+  {m68k_op_unlk_32_a7, 12*7},
+  {m68k_op_move_32_tou, 4*7},
+  {m68k_op_move_32_fru, 4*7},
+  {m68k_op_reset, 0*7},
+  {m68k_op_nop, 4*7},
+  {m68k_op_stop, 4*7},
+  {m68k_op_rte_32, 20*7},
+  {m68k_op_rts_32, 16*7},
+  {m68k_op_trapv, 4*7},
+  {m68k_op_rtr_32, 20*7},
+  {m68k_op_jsr_32_ai, 16*7},
+  {m68k_op_jsr_32_di, 18*7},
+  {m68k_op_jsr_32_ix, 22*7},
+  {m68k_op_jsr_32_aw, 18*7},
+  {m68k_op_jsr_32_al, 20*7},
+  {m68k_op_jsr_32_pcdi, 18*7},
+  {m68k_op_jsr_32_pcix, 22*7},
+  {m68k_op_jmp_32_ai, 8*7},
+  {m68k_op_jmp_32_di, 10*7},
+  {m68k_op_jmp_32_ix, 14*7},
+  {m68k_op_jmp_32_aw, 10*7},
+  {m68k_op_jmp_32_al, 12*7},
+  {m68k_op_jmp_32_pcdi, 10*7},
+  {m68k_op_jmp_32_pcix, 14*7},
+  {m68k_op_addq_8_d, 4*7},
+  {m68k_op_addq_8_ai, 12*7},
+  {m68k_op_addq_8_pi, 12*7},
+  {m68k_op_addq_8_pi7, 12*7},
+  {m68k_op_addq_8_pd, 14*7},
+  {m68k_op_addq_8_pd7, 14*7},
+  {m68k_op_addq_8_di, 16*7},
+  {m68k_op_addq_8_ix, 18*7},
+  {m68k_op_addq_8_aw, 16*7},
+  {m68k_op_addq_8_al, 20*7},
+  {m68k_op_addq_16_d, 4*7},
+  {m68k_op_addq_16_a, 8*7},
+  {m68k_op_addq_16_ai, 12*7},
+  {m68k_op_addq_16_pi, 12*7},
+  {m68k_op_addq_16_pd, 14*7},
+  {m68k_op_addq_16_di, 16*7},
+  {m68k_op_addq_16_ix, 18*7},
+  {m68k_op_addq_16_aw, 16*7},
+  {m68k_op_addq_16_al, 20*7},
+  {m68k_op_addq_32_d, 8*7},
+  {m68k_op_addq_32_a, 8*7},
+  {m68k_op_addq_32_ai, 20*7},
+  {m68k_op_addq_32_pi, 20*7},
+  {m68k_op_addq_32_pd, 22*7},
+  {m68k_op_addq_32_di, 24*7},
+  {m68k_op_addq_32_ix, 26*7},
+  {m68k_op_addq_32_aw, 24*7},
+  {m68k_op_addq_32_al, 28*7},
+  {m68k_op_st_8_d, 6*7},
+  {m68k_op_dbt_16, 12*7},
+  {m68k_op_st_8_ai, 12*7},
+  {m68k_op_st_8_pi, 12*7},
+  {m68k_op_st_8_pi7, 12*7},
+  {m68k_op_st_8_pd, 14*7},
+  {m68k_op_st_8_pd7, 14*7},
+  {m68k_op_st_8_di, 16*7},
+  {m68k_op_st_8_ix, 18*7},
+  {m68k_op_st_8_aw, 16*7},
+  {m68k_op_st_8_al, 20*7},
+  {m68k_op_subq_8_d, 4*7},
+  {m68k_op_subq_8_ai, 12*7},
+  {m68k_op_subq_8_pi, 12*7},
+  {m68k_op_subq_8_pi7, 12*7},
+  {m68k_op_subq_8_pd, 14*7},
+  {m68k_op_subq_8_pd7, 14*7},
+  {m68k_op_subq_8_di, 16*7},
+  {m68k_op_subq_8_ix, 18*7},
+  {m68k_op_subq_8_aw, 16*7},
+  {m68k_op_subq_8_al, 20*7},
+  {m68k_op_subq_16_d, 4*7},
+  {m68k_op_subq_16_a, 8*7},
+  {m68k_op_subq_16_ai, 12*7},
+  {m68k_op_subq_16_pi, 12*7},
+  {m68k_op_subq_16_pd, 14*7},
+  {m68k_op_subq_16_di, 16*7},
+  {m68k_op_subq_16_ix, 18*7},
+  {m68k_op_subq_16_aw, 16*7},
+  {m68k_op_subq_16_al, 20*7},
+  {m68k_op_subq_32_d, 8*7},
+  {m68k_op_subq_32_a, 8*7},
+  {m68k_op_subq_32_ai, 20*7},
+  {m68k_op_subq_32_pi, 20*7},
+  {m68k_op_subq_32_pd, 22*7},
+  {m68k_op_subq_32_di, 24*7},
+  {m68k_op_subq_32_ix, 26*7},
+  {m68k_op_subq_32_aw, 24*7},
+  {m68k_op_subq_32_al, 28*7},
+  {m68k_op_sf_8_d, 4*7},
+  {m68k_op_dbf_16, 12*7},
+  {m68k_op_sf_8_ai, 12*7},
+  {m68k_op_sf_8_pi, 12*7},
+  {m68k_op_sf_8_pi7, 12*7},
+  {m68k_op_sf_8_pd, 14*7},
+  {m68k_op_sf_8_pd7, 14*7},
+  {m68k_op_sf_8_di, 16*7},
+  {m68k_op_sf_8_ix, 18*7},
+  {m68k_op_sf_8_aw, 16*7},
+  {m68k_op_sf_8_al, 20*7},
+  {m68k_op_shi_8_d, 4*7},
+  {m68k_op_dbhi_16, 12*7},
+  {m68k_op_shi_8_ai, 12*7},
+  {m68k_op_shi_8_pi, 12*7},
+  {m68k_op_shi_8_pi7, 12*7},
+  {m68k_op_shi_8_pd, 14*7},
+  {m68k_op_shi_8_pd7, 14*7},
+  {m68k_op_shi_8_di, 16*7},
+  {m68k_op_shi_8_ix, 18*7},
+  {m68k_op_shi_8_aw, 16*7},
+  {m68k_op_shi_8_al, 20*7},
+  {m68k_op_sls_8_d, 4*7},
+  {m68k_op_dbls_16, 12*7},
+  {m68k_op_sls_8_ai, 12*7},
+  {m68k_op_sls_8_pi, 12*7},
+  {m68k_op_sls_8_pi7, 12*7},
+  {m68k_op_sls_8_pd, 14*7},
+  {m68k_op_sls_8_pd7, 14*7},
+  {m68k_op_sls_8_di, 16*7},
+  {m68k_op_sls_8_ix, 18*7},
+  {m68k_op_sls_8_aw, 16*7},
+  {m68k_op_sls_8_al, 20*7},
+  {m68k_op_scc_8_d, 4*7},
+  {m68k_op_dbcc_16, 12*7},
+  {m68k_op_scc_8_ai, 12*7},
+  {m68k_op_scc_8_pi, 12*7},
+  {m68k_op_scc_8_pi7, 12*7},
+  {m68k_op_scc_8_pd, 14*7},
+  {m68k_op_scc_8_pd7, 14*7},
+  {m68k_op_scc_8_di, 16*7},
+  {m68k_op_scc_8_ix, 18*7},
+  {m68k_op_scc_8_aw, 16*7},
+  {m68k_op_scc_8_al, 20*7},
+  {m68k_op_scs_8_d, 4*7},
+  {m68k_op_dbcs_16, 12*7},
+  {m68k_op_scs_8_ai, 12*7},
+  {m68k_op_scs_8_pi, 12*7},
+  {m68k_op_scs_8_pi7, 12*7},
+  {m68k_op_scs_8_pd, 14*7},
+  {m68k_op_scs_8_pd7, 14*7},
+  {m68k_op_scs_8_di, 16*7},
+  {m68k_op_scs_8_ix, 18*7},
+  {m68k_op_scs_8_aw, 16*7},
+  {m68k_op_scs_8_al, 20*7},
+  {m68k_op_sne_8_d, 4*7},
+  {m68k_op_dbne_16, 12*7},
+  {m68k_op_sne_8_ai, 12*7},
+  {m68k_op_sne_8_pi, 12*7},
+  {m68k_op_sne_8_pi7, 12*7},
+  {m68k_op_sne_8_pd, 14*7},
+  {m68k_op_sne_8_pd7, 14*7},
+  {m68k_op_sne_8_di, 16*7},
+  {m68k_op_sne_8_ix, 18*7},
+  {m68k_op_sne_8_aw, 16*7},
+  {m68k_op_sne_8_al, 20*7},
+  {m68k_op_seq_8_d, 4*7},
+  {m68k_op_dbeq_16, 12*7},
+  {m68k_op_seq_8_ai, 12*7},
+  {m68k_op_seq_8_pi, 12*7},
+  {m68k_op_seq_8_pi7, 12*7},
+  {m68k_op_seq_8_pd, 14*7},
+  {m68k_op_seq_8_pd7, 14*7},
+  {m68k_op_seq_8_di, 16*7},
+  {m68k_op_seq_8_ix, 18*7},
+  {m68k_op_seq_8_aw, 16*7},
+  {m68k_op_seq_8_al, 20*7},
+  {m68k_op_svc_8_d, 4*7},
+  {m68k_op_dbvc_16, 12*7},
+  {m68k_op_svc_8_ai, 12*7},
+  {m68k_op_svc_8_pi, 12*7},
+  {m68k_op_svc_8_pi7, 12*7},
+  {m68k_op_svc_8_pd, 14*7},
+  {m68k_op_svc_8_pd7, 14*7},
+  {m68k_op_svc_8_di, 16*7},
+  {m68k_op_svc_8_ix, 18*7},
+  {m68k_op_svc_8_aw, 16*7},
+  {m68k_op_svc_8_al, 20*7},
+  {m68k_op_svs_8_d, 4*7},
+  {m68k_op_dbvs_16, 12*7},
+  {m68k_op_svs_8_ai, 12*7},
+  {m68k_op_svs_8_pi, 12*7},
+  {m68k_op_svs_8_pi7, 12*7},
+  {m68k_op_svs_8_pd, 14*7},
+  {m68k_op_svs_8_pd7, 14*7},
+  {m68k_op_svs_8_di, 16*7},
+  {m68k_op_svs_8_ix, 18*7},
+  {m68k_op_svs_8_aw, 16*7},
+  {m68k_op_svs_8_al, 20*7},
+  {m68k_op_spl_8_d, 4*7},
+  {m68k_op_dbpl_16, 12*7},
+  {m68k_op_spl_8_ai, 12*7},
+  {m68k_op_spl_8_pi, 12*7},
+  {m68k_op_spl_8_pi7, 12*7},
+  {m68k_op_spl_8_pd, 14*7},
+  {m68k_op_spl_8_pd7, 14*7},
+  {m68k_op_spl_8_di, 16*7},
+  {m68k_op_spl_8_ix, 18*7},
+  {m68k_op_spl_8_aw, 16*7},
+  {m68k_op_spl_8_al, 20*7},
+  {m68k_op_smi_8_d, 4*7},
+  {m68k_op_dbmi_16, 12*7},
+  {m68k_op_smi_8_ai, 12*7},
+  {m68k_op_smi_8_pi, 12*7},
+  {m68k_op_smi_8_pi7, 12*7},
+  {m68k_op_smi_8_pd, 14*7},
+  {m68k_op_smi_8_pd7, 14*7},
+  {m68k_op_smi_8_di, 16*7},
+  {m68k_op_smi_8_ix, 18*7},
+  {m68k_op_smi_8_aw, 16*7},
+  {m68k_op_smi_8_al, 20*7},
+  {m68k_op_sge_8_d, 4*7},
+  {m68k_op_dbge_16, 12*7},
+  {m68k_op_sge_8_ai, 12*7},
+  {m68k_op_sge_8_pi, 12*7},
+  {m68k_op_sge_8_pi7, 12*7},
+  {m68k_op_sge_8_pd, 14*7},
+  {m68k_op_sge_8_pd7, 14*7},
+  {m68k_op_sge_8_di, 16*7},
+  {m68k_op_sge_8_ix, 18*7},
+  {m68k_op_sge_8_aw, 16*7},
+  {m68k_op_sge_8_al, 20*7},
+  {m68k_op_slt_8_d, 4*7},
+  {m68k_op_dblt_16, 12*7},
+  {m68k_op_slt_8_ai, 12*7},
+  {m68k_op_slt_8_pi, 12*7},
+  {m68k_op_slt_8_pi7, 12*7},
+  {m68k_op_slt_8_pd, 14*7},
+  {m68k_op_slt_8_pd7, 14*7},
+  {m68k_op_slt_8_di, 16*7},
+  {m68k_op_slt_8_ix, 18*7},
+  {m68k_op_slt_8_aw, 16*7},
+  {m68k_op_slt_8_al, 20*7},
+  {m68k_op_sgt_8_d, 4*7},
+  {m68k_op_dbgt_16, 12*7},
+  {m68k_op_sgt_8_ai, 12*7},
+  {m68k_op_sgt_8_pi, 12*7},
+  {m68k_op_sgt_8_pi7, 12*7},
+  {m68k_op_sgt_8_pd, 14*7},
+  {m68k_op_sgt_8_pd7, 14*7},
+  {m68k_op_sgt_8_di, 16*7},
+  {m68k_op_sgt_8_ix, 18*7},
+  {m68k_op_sgt_8_aw, 16*7},
+  {m68k_op_sgt_8_al, 20*7},
+  {m68k_op_sle_8_d, 4*7},
+  {m68k_op_dble_16, 12*7},
+  {m68k_op_sle_8_ai, 12*7},
+  {m68k_op_sle_8_pi, 12*7},
+  {m68k_op_sle_8_pi7, 12*7},
+  {m68k_op_sle_8_pd, 14*7},
+  {m68k_op_sle_8_pd7, 14*7},
+  {m68k_op_sle_8_di, 16*7},
+  {m68k_op_sle_8_ix, 18*7},
+  {m68k_op_sle_8_aw, 16*7},
+  {m68k_op_sle_8_al, 20*7},
+  {m68k_op_bra_16, 10*7},
+  {m68k_op_bra_8, 10*7},
+  {m68k_op_bra_32, 10*7},
+  {m68k_op_bsr_16, 18*7},
+  {m68k_op_bsr_8, 18*7},
+  {m68k_op_bsr_32, 18*7},
+  {m68k_op_bhi_16, 10*7},
+  {m68k_op_bhi_8, 10*7},
+  {m68k_op_bhi_32, 10*7},
+  {m68k_op_bls_16, 10*7},
+  {m68k_op_bls_8, 10*7},
+  {m68k_op_bls_32, 10*7},
+  {m68k_op_bcc_16, 10*7},
+  {m68k_op_bcc_8, 10*7},
+  {m68k_op_bcc_32, 10*7},
+  {m68k_op_bcs_16, 10*7},
+  {m68k_op_bcs_8, 10*7},
+  {m68k_op_bcs_32, 10*7},
+  {m68k_op_bne_16, 10*7},
+  {m68k_op_bne_8, 10*7},
+  {m68k_op_bne_32, 10*7},
+  {m68k_op_beq_16, 10*7},
+  {m68k_op_beq_8, 10*7},
+  {m68k_op_beq_32, 10*7},
+  {m68k_op_bvc_16, 10*7},
+  {m68k_op_bvc_8, 10*7},
+  {m68k_op_bvc_32, 10*7},
+  {m68k_op_bvs_16, 10*7},
+  {m68k_op_bvs_8, 10*7},
+  {m68k_op_bvs_32, 10*7},
+  {m68k_op_bpl_16, 10*7},
+  {m68k_op_bpl_8, 10*7},
+  {m68k_op_bpl_32, 10*7},
+  {m68k_op_bmi_16, 10*7},
+  {m68k_op_bmi_8, 10*7},
+  {m68k_op_bmi_32, 10*7},
+  {m68k_op_bge_16, 10*7},
+  {m68k_op_bge_8, 10*7},
+  {m68k_op_bge_32, 10*7},
+  {m68k_op_blt_16, 10*7},
+  {m68k_op_blt_8, 10*7},
+  {m68k_op_blt_32, 10*7},
+  {m68k_op_bgt_16, 10*7},
+  {m68k_op_bgt_8, 10*7},
+  {m68k_op_bgt_32, 10*7},
+  {m68k_op_ble_16, 10*7},
+  {m68k_op_ble_8, 10*7},
+  {m68k_op_ble_32, 10*7},
+  {m68k_op_moveq_32, 4*7},
+  {m68k_op_or_8_er_d, 4*7},
+  {m68k_op_or_8_er_ai, 8*7},
+  {m68k_op_or_8_er_pi, 8*7},
+  {m68k_op_or_8_er_pi7, 8*7},
+  {m68k_op_or_8_er_pd, 10*7},
+  {m68k_op_or_8_er_pd7, 10*7},
+  {m68k_op_or_8_er_di, 12*7},
+  {m68k_op_or_8_er_ix, 14*7},
+  {m68k_op_or_8_er_aw, 12*7},
+  {m68k_op_or_8_er_al, 16*7},
+  {m68k_op_or_8_er_pcdi, 12*7},
+  {m68k_op_or_8_er_pcix, 14*7},
+  {m68k_op_or_8_er_i, 8*7},
+  {m68k_op_or_16_er_d, 4*7},
+  {m68k_op_or_16_er_ai, 8*7},
+  {m68k_op_or_16_er_pi, 8*7},
+  {m68k_op_or_16_er_pd, 10*7},
+  {m68k_op_or_16_er_di, 12*7},
+  {m68k_op_or_16_er_ix, 14*7},
+  {m68k_op_or_16_er_aw, 12*7},
+  {m68k_op_or_16_er_al, 16*7},
+  {m68k_op_or_16_er_pcdi, 12*7},
+  {m68k_op_or_16_er_pcix, 14*7},
+  {m68k_op_or_16_er_i, 8*7},
+  {m68k_op_or_32_er_d, 8*7},
+  {m68k_op_or_32_er_ai, 14*7},
+  {m68k_op_or_32_er_pi, 14*7},
+  {m68k_op_or_32_er_pd, 16*7},
+  {m68k_op_or_32_er_di, 18*7},
+  {m68k_op_or_32_er_ix, 20*7},
+  {m68k_op_or_32_er_aw, 18*7},
+  {m68k_op_or_32_er_al, 22*7},
+  {m68k_op_or_32_er_pcdi, 18*7},
+  {m68k_op_or_32_er_pcix, 20*7},
+  {m68k_op_or_32_er_i, 16*7},
+  {m68k_op_divu_16_d, 0*7},
+  {m68k_op_divu_16_ai, 4*7},
+  {m68k_op_divu_16_pi, 4*7},
+  {m68k_op_divu_16_pd, 6*7},
+  {m68k_op_divu_16_di, 8*7},
+  {m68k_op_divu_16_ix, 10*7},
+  {m68k_op_divu_16_aw, 8*7},
+  {m68k_op_divu_16_al, 12*7},
+  {m68k_op_divu_16_pcdi, 8*7},
+  {m68k_op_divu_16_pcix, 10*7},
+  {m68k_op_divu_16_i, 4*7},
+  {m68k_op_sbcd_8_rr, 6*7},
+  {m68k_op_sbcd_8_mm, 18*7},
+  {m68k_op_sbcd_8_mm_ay7, 18*7},
+  {m68k_op_or_8_re_ai, 12*7},
+  {m68k_op_or_8_re_pi, 12*7},
+  {m68k_op_or_8_re_pi7, 12*7},
+  {m68k_op_or_8_re_pd, 14*7},
+  {m68k_op_or_8_re_pd7, 14*7},
+  {m68k_op_or_8_re_di, 16*7},
+  {m68k_op_or_8_re_ix, 18*7},
+  {m68k_op_or_8_re_aw, 16*7},
+  {m68k_op_or_8_re_al, 20*7},
+  {m68k_op_or_16_re_ai, 12*7},
+  {m68k_op_or_16_re_pi, 12*7},
+  {m68k_op_or_16_re_pd, 14*7},
+  {m68k_op_or_16_re_di, 16*7},
+  {m68k_op_or_16_re_ix, 18*7},
+  {m68k_op_or_16_re_aw, 16*7},
+  {m68k_op_or_16_re_al, 20*7},
+  {m68k_op_or_32_re_ai, 20*7},
+  {m68k_op_or_32_re_pi, 20*7},
+  {m68k_op_or_32_re_pd, 22*7},
+  {m68k_op_or_32_re_di, 24*7},
+  {m68k_op_or_32_re_ix, 26*7},
+  {m68k_op_or_32_re_aw, 24*7},
+  {m68k_op_or_32_re_al, 28*7},
+  {m68k_op_divs_16_d, 0*7},
+  {m68k_op_divs_16_ai, 4*7},
+  {m68k_op_divs_16_pi, 4*7},
+  {m68k_op_divs_16_pd, 6*7},
+  {m68k_op_divs_16_di, 8*7},
+  {m68k_op_divs_16_ix, 10*7},
+  {m68k_op_divs_16_aw, 8*7},
+  {m68k_op_divs_16_al, 12*7},
+  {m68k_op_divs_16_pcdi, 8*7},
+  {m68k_op_divs_16_pcix, 10*7},
+  {m68k_op_divs_16_i, 4*7},
+  {m68k_op_sbcd_8_mm_ax7, 18*7},
+  {m68k_op_sbcd_8_mm_axy7, 18*7},
+  {m68k_op_sub_8_er_d, 4*7},
+  {m68k_op_sub_8_er_ai, 8*7},
+  {m68k_op_sub_8_er_pi, 8*7},
+  {m68k_op_sub_8_er_pi7, 8*7},
+  {m68k_op_sub_8_er_pd, 10*7},
+  {m68k_op_sub_8_er_pd7, 10*7},
+  {m68k_op_sub_8_er_di, 12*7},
+  {m68k_op_sub_8_er_ix, 14*7},
+  {m68k_op_sub_8_er_aw, 12*7},
+  {m68k_op_sub_8_er_al, 16*7},
+  {m68k_op_sub_8_er_pcdi, 12*7},
+  {m68k_op_sub_8_er_pcix, 14*7},
+  {m68k_op_sub_8_er_i, 8*7},
+  {m68k_op_sub_16_er_d, 4*7},
+  {m68k_op_sub_16_er_a, 4*7},
+  {m68k_op_sub_16_er_ai, 8*7},
+  {m68k_op_sub_16_er_pi, 8*7},
+  {m68k_op_sub_16_er_pd, 10*7},
+  {m68k_op_sub_16_er_di, 12*7},
+  {m68k_op_sub_16_er_ix, 14*7},
+  {m68k_op_sub_16_er_aw, 12*7},
+  {m68k_op_sub_16_er_al, 16*7},
+  {m68k_op_sub_16_er_pcdi, 12*7},
+  {m68k_op_sub_16_er_pcix, 14*7},
+  {m68k_op_sub_16_er_i, 8*7},
+  {m68k_op_sub_32_er_d, 8*7},
+  {m68k_op_sub_32_er_a, 8*7},
+  {m68k_op_sub_32_er_ai, 14*7},
+  {m68k_op_sub_32_er_pi, 14*7},
+  {m68k_op_sub_32_er_pd, 16*7},
+  {m68k_op_sub_32_er_di, 18*7},
+  {m68k_op_sub_32_er_ix, 20*7},
+  {m68k_op_sub_32_er_aw, 18*7},
+  {m68k_op_sub_32_er_al, 22*7},
+  {m68k_op_sub_32_er_pcdi, 18*7},
+  {m68k_op_sub_32_er_pcix, 20*7},
+  {m68k_op_sub_32_er_i, 16*7},
+  {m68k_op_suba_16_d, 8*7},
+  {m68k_op_suba_16_a, 8*7},
+  {m68k_op_suba_16_ai, 12*7},
+  {m68k_op_suba_16_pi, 12*7},
+  {m68k_op_suba_16_pd, 14*7},
+  {m68k_op_suba_16_di, 16*7},
+  {m68k_op_suba_16_ix, 18*7},
+  {m68k_op_suba_16_aw, 16*7},
+  {m68k_op_suba_16_al, 20*7},
+  {m68k_op_suba_16_pcdi, 16*7},
+  {m68k_op_suba_16_pcix, 18*7},
+  {m68k_op_suba_16_i, 12*7},
+  {m68k_op_subx_8_rr, 4*7},
+  {m68k_op_subx_8_mm, 18*7},
+  {m68k_op_subx_8_mm_ay7, 18*7},
+  {m68k_op_sub_8_re_ai, 12*7},
+  {m68k_op_sub_8_re_pi, 12*7},
+  {m68k_op_sub_8_re_pi7, 12*7},
+  {m68k_op_sub_8_re_pd, 14*7},
+  {m68k_op_sub_8_re_pd7, 14*7},
+  {m68k_op_sub_8_re_di, 16*7},
+  {m68k_op_sub_8_re_ix, 18*7},
+  {m68k_op_sub_8_re_aw, 16*7},
+  {m68k_op_sub_8_re_al, 20*7},
+  {m68k_op_subx_16_rr, 4*7},
+  {m68k_op_subx_16_mm, 18*7},
+  {m68k_op_sub_16_re_ai, 12*7},
+  {m68k_op_sub_16_re_pi, 12*7},
+  {m68k_op_sub_16_re_pd, 14*7},
+  {m68k_op_sub_16_re_di, 16*7},
+  {m68k_op_sub_16_re_ix, 18*7},
+  {m68k_op_sub_16_re_aw, 16*7},
+  {m68k_op_sub_16_re_al, 20*7},
+  {m68k_op_subx_32_rr, 8*7},
+  {m68k_op_subx_32_mm, 30*7},
+  {m68k_op_sub_32_re_ai, 20*7},
+  {m68k_op_sub_32_re_pi, 20*7},
+  {m68k_op_sub_32_re_pd, 22*7},
+  {m68k_op_sub_32_re_di, 24*7},
+  {m68k_op_sub_32_re_ix, 26*7},
+  {m68k_op_sub_32_re_aw, 24*7},
+  {m68k_op_sub_32_re_al, 28*7},
+  {m68k_op_suba_32_d, 8*7},
+  {m68k_op_suba_32_a, 8*7},
+  {m68k_op_suba_32_ai, 14*7},
+  {m68k_op_suba_32_pi, 14*7},
+  {m68k_op_suba_32_pd, 16*7},
+  {m68k_op_suba_32_di, 18*7},
+  {m68k_op_suba_32_ix, 20*7},
+  {m68k_op_suba_32_aw, 18*7},
+  {m68k_op_suba_32_al, 22*7},
+  {m68k_op_suba_32_pcdi, 18*7},
+  {m68k_op_suba_32_pcix, 20*7},
+  {m68k_op_suba_32_i, 16*7},
+  {m68k_op_subx_8_mm_ax7, 18*7},
+  {m68k_op_subx_8_mm_axy7, 18*7},
+  {m68k_op_1010, 4*7},
+  {m68k_op_cmp_8_d, 4*7},
+  {m68k_op_cmp_8_ai, 8*7},
+  {m68k_op_cmp_8_pi, 8*7},
+  {m68k_op_cmp_8_pi7, 8*7},
+  {m68k_op_cmp_8_pd, 10*7},
+  {m68k_op_cmp_8_pd7, 10*7},
+  {m68k_op_cmp_8_di, 12*7},
+  {m68k_op_cmp_8_ix, 14*7},
+  {m68k_op_cmp_8_aw, 12*7},
+  {m68k_op_cmp_8_al, 16*7},
+  {m68k_op_cmp_8_pcdi, 12*7},
+  {m68k_op_cmp_8_pcix, 14*7},
+  {m68k_op_cmp_8_i, 8*7},
+  {m68k_op_cmp_16_d, 4*7},
+  {m68k_op_cmp_16_a, 4*7},
+  {m68k_op_cmp_16_ai, 8*7},
+  {m68k_op_cmp_16_pi, 8*7},
+  {m68k_op_cmp_16_pd, 10*7},
+  {m68k_op_cmp_16_di, 12*7},
+  {m68k_op_cmp_16_ix, 14*7},
+  {m68k_op_cmp_16_aw, 12*7},
+  {m68k_op_cmp_16_al, 16*7},
+  {m68k_op_cmp_16_pcdi, 12*7},
+  {m68k_op_cmp_16_pcix, 14*7},
+  {m68k_op_cmp_16_i, 8*7},
+  {m68k_op_cmp_32_d, 6*7},
+  {m68k_op_cmp_32_a, 6*7},
+  {m68k_op_cmp_32_ai, 14*7},
+  {m68k_op_cmp_32_pi, 14*7},
+  {m68k_op_cmp_32_pd, 16*7},
+  {m68k_op_cmp_32_di, 18*7},
+  {m68k_op_cmp_32_ix, 20*7},
+  {m68k_op_cmp_32_aw, 18*7},
+  {m68k_op_cmp_32_al, 22*7},
+  {m68k_op_cmp_32_pcdi, 18*7},
+  {m68k_op_cmp_32_pcix, 20*7},
+  {m68k_op_cmp_32_i, 14*7},
+  {m68k_op_cmpa_16_d, 6*7},
+  {m68k_op_cmpa_16_a, 6*7},
+  {m68k_op_cmpa_16_ai, 10*7},
+  {m68k_op_cmpa_16_pi, 10*7},
+  {m68k_op_cmpa_16_pd, 12*7},
+  {m68k_op_cmpa_16_di, 14*7},
+  {m68k_op_cmpa_16_ix, 16*7},
+  {m68k_op_cmpa_16_aw, 14*7},
+  {m68k_op_cmpa_16_al, 18*7},
+  {m68k_op_cmpa_16_pcdi, 14*7},
+  {m68k_op_cmpa_16_pcix, 16*7},
+  {m68k_op_cmpa_16_i, 10*7},
+  {m68k_op_eor_8_d, 4*7},
+  {m68k_op_cmpm_8, 12*7},
+  {m68k_op_cmpm_8_ay7, 12*7},
+  {m68k_op_eor_8_ai, 12*7},
+  {m68k_op_eor_8_pi, 12*7},
+  {m68k_op_eor_8_pi7, 12*7},
+  {m68k_op_eor_8_pd, 14*7},
+  {m68k_op_eor_8_pd7, 14*7},
+  {m68k_op_eor_8_di, 16*7},
+  {m68k_op_eor_8_ix, 18*7},
+  {m68k_op_eor_8_aw, 16*7},
+  {m68k_op_eor_8_al, 20*7},
+  {m68k_op_eor_16_d, 4*7},
+  {m68k_op_cmpm_16, 12*7},
+  {m68k_op_eor_16_ai, 12*7},
+  {m68k_op_eor_16_pi, 12*7},
+  {m68k_op_eor_16_pd, 14*7},
+  {m68k_op_eor_16_di, 16*7},
+  {m68k_op_eor_16_ix, 18*7},
+  {m68k_op_eor_16_aw, 16*7},
+  {m68k_op_eor_16_al, 20*7},
+  {m68k_op_eor_32_d, 8*7},
+  {m68k_op_cmpm_32, 20*7},
+  {m68k_op_eor_32_ai, 20*7},
+  {m68k_op_eor_32_pi, 20*7},
+  {m68k_op_eor_32_pd, 22*7},
+  {m68k_op_eor_32_di, 24*7},
+  {m68k_op_eor_32_ix, 26*7},
+  {m68k_op_eor_32_aw, 24*7},
+  {m68k_op_eor_32_al, 28*7},
+  {m68k_op_cmpa_32_d, 6*7},
+  {m68k_op_cmpa_32_a, 6*7},
+  {m68k_op_cmpa_32_ai, 14*7},
+  {m68k_op_cmpa_32_pi, 14*7},
+  {m68k_op_cmpa_32_pd, 16*7},
+  {m68k_op_cmpa_32_di, 18*7},
+  {m68k_op_cmpa_32_ix, 20*7},
+  {m68k_op_cmpa_32_aw, 18*7},
+  {m68k_op_cmpa_32_al, 22*7},
+  {m68k_op_cmpa_32_pcdi, 18*7},
+  {m68k_op_cmpa_32_pcix, 20*7},
+  {m68k_op_cmpa_32_i, 14*7},
+  {m68k_op_cmpm_8_ax7, 12*7},
+  {m68k_op_cmpm_8_axy7, 12*7},
+  {m68k_op_and_8_er_d, 4*7},
+  {m68k_op_and_8_er_ai, 8*7},
+  {m68k_op_and_8_er_pi, 8*7},
+  {m68k_op_and_8_er_pi7, 8*7},
+  {m68k_op_and_8_er_pd, 10*7},
+  {m68k_op_and_8_er_pd7, 10*7},
+  {m68k_op_and_8_er_di, 12*7},
+  {m68k_op_and_8_er_ix, 14*7},
+  {m68k_op_and_8_er_aw, 12*7},
+  {m68k_op_and_8_er_al, 16*7},
+  {m68k_op_and_8_er_pcdi, 12*7},
+  {m68k_op_and_8_er_pcix, 14*7},
+  {m68k_op_and_8_er_i, 8*7},
+  {m68k_op_and_16_er_d, 4*7},
+  {m68k_op_and_16_er_ai, 8*7},
+  {m68k_op_and_16_er_pi, 8*7},
+  {m68k_op_and_16_er_pd, 10*7},
+  {m68k_op_and_16_er_di, 12*7},
+  {m68k_op_and_16_er_ix, 14*7},
+  {m68k_op_and_16_er_aw, 12*7},
+  {m68k_op_and_16_er_al, 16*7},
+  {m68k_op_and_16_er_pcdi, 12*7},
+  {m68k_op_and_16_er_pcix, 14*7},
+  {m68k_op_and_16_er_i, 8*7},
+  {m68k_op_and_32_er_d, 8*7},
+  {m68k_op_and_32_er_ai, 14*7},
+  {m68k_op_and_32_er_pi, 14*7},
+  {m68k_op_and_32_er_pd, 16*7},
+  {m68k_op_and_32_er_di, 18*7},
+  {m68k_op_and_32_er_ix, 20*7},
+  {m68k_op_and_32_er_aw, 18*7},
+  {m68k_op_and_32_er_al, 22*7},
+  {m68k_op_and_32_er_pcdi, 18*7},
+  {m68k_op_and_32_er_pcix, 20*7},
+  {m68k_op_and_32_er_i, 16*7},
+  {m68k_op_mulu_16_d, 0*7},
+  {m68k_op_mulu_16_ai, 4*7},
+  {m68k_op_mulu_16_pi, 4*7},
+  {m68k_op_mulu_16_pd, 6*7},
+  {m68k_op_mulu_16_di, 8*7},
+  {m68k_op_mulu_16_ix, 10*7},
+  {m68k_op_mulu_16_aw, 8*7},
+  {m68k_op_mulu_16_al, 12*7},
+  {m68k_op_mulu_16_pcdi, 8*7},
+  {m68k_op_mulu_16_pcix, 10*7},
+  {m68k_op_mulu_16_i, 4*7},
+  {m68k_op_abcd_8_rr, 6*7},
+  {m68k_op_abcd_8_mm, 18*7},
+  {m68k_op_abcd_8_mm_ay7, 18*7},
+  {m68k_op_and_8_re_ai, 12*7},
+  {m68k_op_and_8_re_pi, 12*7},
+  {m68k_op_and_8_re_pi7, 12*7},
+  {m68k_op_and_8_re_pd, 14*7},
+  {m68k_op_and_8_re_pd7, 14*7},
+  {m68k_op_and_8_re_di, 16*7},
+  {m68k_op_and_8_re_ix, 18*7},
+  {m68k_op_and_8_re_aw, 16*7},
+  {m68k_op_and_8_re_al, 20*7},
+  {m68k_op_exg_32_dd, 6*7},
+  {m68k_op_exg_32_aa, 6*7},
+  {m68k_op_and_16_re_ai, 12*7},
+  {m68k_op_and_16_re_pi, 12*7},
+  {m68k_op_and_16_re_pd, 14*7},
+  {m68k_op_and_16_re_di, 16*7},
+  {m68k_op_and_16_re_ix, 18*7},
+  {m68k_op_and_16_re_aw, 16*7},
+  {m68k_op_and_16_re_al, 20*7},
+  {m68k_op_exg_32_da, 6*7},
+  {m68k_op_and_32_re_ai, 20*7},
+  {m68k_op_and_32_re_pi, 20*7},
+  {m68k_op_and_32_re_pd, 22*7},
+  {m68k_op_and_32_re_di, 24*7},
+  {m68k_op_and_32_re_ix, 26*7},
+  {m68k_op_and_32_re_aw, 24*7},
+  {m68k_op_and_32_re_al, 28*7},
+  {m68k_op_muls_16_d, 0*7},
+  {m68k_op_muls_16_ai, 4*7},
+  {m68k_op_muls_16_pi, 4*7},
+  {m68k_op_muls_16_pd, 6*7},
+  {m68k_op_muls_16_di, 8*7},
+  {m68k_op_muls_16_ix, 10*7},
+  {m68k_op_muls_16_aw, 8*7},
+  {m68k_op_muls_16_al, 12*7},
+  {m68k_op_muls_16_pcdi, 8*7},
+  {m68k_op_muls_16_pcix, 10*7},
+  {m68k_op_muls_16_i, 4*7},
+  {m68k_op_abcd_8_mm_ax7, 18*7},
+  {m68k_op_abcd_8_mm_axy7, 18*7},
+  {m68k_op_add_8_er_d, 4*7},
+  {m68k_op_add_8_er_ai, 8*7},
+  {m68k_op_add_8_er_pi, 8*7},
+  {m68k_op_add_8_er_pi7, 8*7},
+  {m68k_op_add_8_er_pd, 10*7},
+  {m68k_op_add_8_er_pd7, 10*7},
+  {m68k_op_add_8_er_di, 12*7},
+  {m68k_op_add_8_er_ix, 14*7},
+  {m68k_op_add_8_er_aw, 12*7},
+  {m68k_op_add_8_er_al, 16*7},
+  {m68k_op_add_8_er_pcdi, 12*7},
+  {m68k_op_add_8_er_pcix, 14*7},
+  {m68k_op_add_8_er_i, 8*7},
+  {m68k_op_add_16_er_d, 4*7},
+  {m68k_op_add_16_er_a, 4*7},
+  {m68k_op_add_16_er_ai, 8*7},
+  {m68k_op_add_16_er_pi, 8*7},
+  {m68k_op_add_16_er_pd, 10*7},
+  {m68k_op_add_16_er_di, 12*7},
+  {m68k_op_add_16_er_ix, 14*7},
+  {m68k_op_add_16_er_aw, 12*7},
+  {m68k_op_add_16_er_al, 16*7},
+  {m68k_op_add_16_er_pcdi, 12*7},
+  {m68k_op_add_16_er_pcix, 14*7},
+  {m68k_op_add_16_er_i, 8*7},
+  {m68k_op_add_32_er_d, 8*7},
+  {m68k_op_add_32_er_a, 8*7},
+  {m68k_op_add_32_er_ai, 14*7},
+  {m68k_op_add_32_er_pi, 14*7},
+  {m68k_op_add_32_er_pd, 16*7},
+  {m68k_op_add_32_er_di, 18*7},
+  {m68k_op_add_32_er_ix, 20*7},
+  {m68k_op_add_32_er_aw, 18*7},
+  {m68k_op_add_32_er_al, 22*7},
+  {m68k_op_add_32_er_pcdi, 18*7},
+  {m68k_op_add_32_er_pcix, 20*7},
+  {m68k_op_add_32_er_i, 16*7},
+  {m68k_op_adda_16_d, 8*7},
+  {m68k_op_adda_16_a, 8*7},
+  {m68k_op_adda_16_ai, 12*7},
+  {m68k_op_adda_16_pi, 12*7},
+  {m68k_op_adda_16_pd, 14*7},
+  {m68k_op_adda_16_di, 16*7},
+  {m68k_op_adda_16_ix, 18*7},
+  {m68k_op_adda_16_aw, 16*7},
+  {m68k_op_adda_16_al, 20*7},
+  {m68k_op_adda_16_pcdi, 16*7},
+  {m68k_op_adda_16_pcix, 18*7},
+  {m68k_op_adda_16_i, 12*7},
+  {m68k_op_addx_8_rr, 4*7},
+  {m68k_op_addx_8_mm, 18*7},
+  {m68k_op_addx_8_mm_ay7, 18*7},
+  {m68k_op_add_8_re_ai, 12*7},
+  {m68k_op_add_8_re_pi, 12*7},
+  {m68k_op_add_8_re_pi7, 12*7},
+  {m68k_op_add_8_re_pd, 14*7},
+  {m68k_op_add_8_re_pd7, 14*7},
+  {m68k_op_add_8_re_di, 16*7},
+  {m68k_op_add_8_re_ix, 18*7},
+  {m68k_op_add_8_re_aw, 16*7},
+  {m68k_op_add_8_re_al, 20*7},
+  {m68k_op_addx_16_rr, 4*7},
+  {m68k_op_addx_16_mm, 18*7},
+  {m68k_op_add_16_re_ai, 12*7},
+  {m68k_op_add_16_re_pi, 12*7},
+  {m68k_op_add_16_re_pd, 14*7},
+  {m68k_op_add_16_re_di, 16*7},
+  {m68k_op_add_16_re_ix, 18*7},
+  {m68k_op_add_16_re_aw, 16*7},
+  {m68k_op_add_16_re_al, 20*7},
+  {m68k_op_addx_32_rr, 8*7},
+  {m68k_op_addx_32_mm, 30*7},
+  {m68k_op_add_32_re_ai, 20*7},
+  {m68k_op_add_32_re_pi, 20*7},
+  {m68k_op_add_32_re_pd, 22*7},
+  {m68k_op_add_32_re_di, 24*7},
+  {m68k_op_add_32_re_ix, 26*7},
+  {m68k_op_add_32_re_aw, 24*7},
+  {m68k_op_add_32_re_al, 28*7},
+  {m68k_op_adda_32_d, 8*7},
+  {m68k_op_adda_32_a, 8*7},
+  {m68k_op_adda_32_ai, 14*7},
+  {m68k_op_adda_32_pi, 14*7},
+  {m68k_op_adda_32_pd, 16*7},
+  {m68k_op_adda_32_di, 18*7},
+  {m68k_op_adda_32_ix, 20*7},
+  {m68k_op_adda_32_aw, 18*7},
+  {m68k_op_adda_32_al, 22*7},
+  {m68k_op_adda_32_pcdi, 18*7},
+  {m68k_op_adda_32_pcix, 20*7},
+  {m68k_op_adda_32_i, 16*7},
+  {m68k_op_addx_8_mm_ax7, 18*7},
+  {m68k_op_addx_8_mm_axy7, 18*7},
+  {m68k_op_asr_8_s, 6*7},
+  {m68k_op_lsr_8_s, 6*7},
+  {m68k_op_roxr_8_s, 6*7},
+  {m68k_op_ror_8_s, 6*7},
+  {m68k_op_asr_8_r, 6*7},
+  {m68k_op_lsr_8_r, 6*7},
+  {m68k_op_roxr_8_r, 6*7},
+  {m68k_op_ror_8_r, 6*7},
+  {m68k_op_asr_16_s, 6*7},
+  {m68k_op_lsr_16_s, 6*7},
+  {m68k_op_roxr_16_s, 6*7},
+  {m68k_op_ror_16_s, 6*7},
+  {m68k_op_asr_16_r, 6*7},
+  {m68k_op_lsr_16_r, 6*7},
+  {m68k_op_roxr_16_r, 6*7},
+  {m68k_op_ror_16_r, 6*7},
+  {m68k_op_asr_32_s, 8*7},
+  {m68k_op_lsr_32_s, 8*7},
+  {m68k_op_roxr_32_s, 8*7},
+  {m68k_op_ror_32_s, 8*7},
+  {m68k_op_asr_32_r, 8*7},
+  {m68k_op_lsr_32_r, 8*7},
+  {m68k_op_roxr_32_r, 8*7},
+  {m68k_op_ror_32_r, 8*7},
+  {m68k_op_asr_16_ai, 12*7},
+  {m68k_op_asr_16_pi, 12*7},
+  {m68k_op_asr_16_pd, 14*7},
+  {m68k_op_asr_16_di, 16*7},
+  {m68k_op_asr_16_ix, 18*7},
+  {m68k_op_asr_16_aw, 16*7},
+  {m68k_op_asr_16_al, 20*7},
+  {m68k_op_asl_8_s, 6*7},
+  {m68k_op_lsl_8_s, 6*7},
+  {m68k_op_roxl_8_s, 6*7},
+  {m68k_op_rol_8_s, 6*7},
+  {m68k_op_asl_8_r, 6*7},
+  {m68k_op_lsl_8_r, 6*7},
+  {m68k_op_roxl_8_r, 6*7},
+  {m68k_op_rol_8_r, 6*7},
+  {m68k_op_asl_16_s, 6*7},
+  {m68k_op_lsl_16_s, 6*7},
+  {m68k_op_roxl_16_s, 6*7},
+  {m68k_op_rol_16_s, 6*7},
+  {m68k_op_asl_16_r, 6*7},
+  {m68k_op_lsl_16_r, 6*7},
+  {m68k_op_roxl_16_r, 6*7},
+  {m68k_op_rol_16_r, 6*7},
+  {m68k_op_asl_32_s, 8*7},
+  {m68k_op_lsl_32_s, 8*7},
+  {m68k_op_roxl_32_s, 8*7},
+  {m68k_op_rol_32_s, 8*7},
+  {m68k_op_asl_32_r, 8*7},
+  {m68k_op_lsl_32_r, 8*7},
+  {m68k_op_roxl_32_r, 8*7},
+  {m68k_op_rol_32_r, 8*7},
+  {m68k_op_asl_16_ai, 12*7},
+  {m68k_op_asl_16_pi, 12*7},
+  {m68k_op_asl_16_pd, 14*7},
+  {m68k_op_asl_16_di, 16*7},
+  {m68k_op_asl_16_ix, 18*7},
+  {m68k_op_asl_16_aw, 16*7},
+  {m68k_op_asl_16_al, 20*7},
+  {m68k_op_lsr_16_ai, 12*7},
+  {m68k_op_lsr_16_pi, 12*7},
+  {m68k_op_lsr_16_pd, 14*7},
+  {m68k_op_lsr_16_di, 16*7},
+  {m68k_op_lsr_16_ix, 18*7},
+  {m68k_op_lsr_16_aw, 16*7},
+  {m68k_op_lsr_16_al, 20*7},
+  {m68k_op_lsl_16_ai, 12*7},
+  {m68k_op_lsl_16_pi, 12*7},
+  {m68k_op_lsl_16_pd, 14*7},
+  {m68k_op_lsl_16_di, 16*7},
+  {m68k_op_lsl_16_ix, 18*7},
+  {m68k_op_lsl_16_aw, 16*7},
+  {m68k_op_lsl_16_al, 20*7},
+  {m68k_op_roxr_16_ai, 12*7},
+  {m68k_op_roxr_16_pi, 12*7},
+  {m68k_op_roxr_16_pd, 14*7},
+  {m68k_op_roxr_16_di, 16*7},
+  {m68k_op_roxr_16_ix, 18*7},
+  {m68k_op_roxr_16_aw, 16*7},
+  {m68k_op_roxr_16_al, 20*7},
+  {m68k_op_roxl_16_ai, 12*7},
+  {m68k_op_roxl_16_pi, 12*7},
+  {m68k_op_roxl_16_pd, 14*7},
+  {m68k_op_roxl_16_di, 16*7},
+  {m68k_op_roxl_16_ix, 18*7},
+  {m68k_op_roxl_16_aw, 16*7},
+  {m68k_op_roxl_16_al, 20*7},
+  {m68k_op_ror_16_ai, 12*7},
+  {m68k_op_ror_16_pi, 12*7},
+  {m68k_op_ror_16_pd, 14*7},
+  {m68k_op_ror_16_di, 16*7},
+  {m68k_op_ror_16_ix, 18*7},
+  {m68k_op_ror_16_aw, 16*7},
+  {m68k_op_ror_16_al, 20*7},
+  {m68k_op_rol_16_ai, 12*7},
+  {m68k_op_rol_16_pi, 12*7},
+  {m68k_op_rol_16_pd, 14*7},
+  {m68k_op_rol_16_di, 16*7},
+  {m68k_op_rol_16_ix, 18*7},
+  {m68k_op_rol_16_aw, 16*7},
+  {m68k_op_rol_16_al, 20*7},
+  {m68k_op_1111, 4*7},
+};
@@ -130,7 +130,7 @@ static void m68k_op_1010(void)
   m68ki_exception_1010();
 }
 
-#ifdef TABLES_FULL
+#if defined(TABLES_FULL) || M68K_COMPACT_JUMP_TABLE
 
 static void m68k_op_1111(void)
 {
@@ -23672,7 +23672,9 @@ static void m68k_op_unlk_32(void)
 
 #ifndef BUILD_TABLES
 
-  #ifndef TABLES_FULL
+  #if M68K_COMPACT_JUMP_TABLE
+    #include "m68ki_opcode_entries.h"
+  #elif !defined(TABLES_FULL)
     #include "m68ki_instruction_jump_table.h"
   #else
     #include "m68ki_instruction_jump_table_full.h"
@@ -0,0 +1,85 @@
+/*
+    Timestamped log of sound chips writes, see gwenesis_audio_log.h
+*/
+
+#include <stdint.h>
+#include "gwenesis_bus.h"
+#include "gwenesis_sn76489.h"
+#include "ym2612.h"
+#include "gwenesis_audio_log.h"
+
+gwenesis_audio_log_t *gwenesis_audio_log = NULL;
+void (*gwenesis_audio_log_full)(gwenesis_audio_log_t *log) = NULL;
+
+void gwenesis_audio_log_start(gwenesis_audio_log_t *log, int ym2612_clock, int sn76489_clock)
+{
+  /* Entering deferred mode, the CPU side timers start from the chip's state */
+  if (gwenesis_audio_log == NULL)
+    YM2612LoadTimers();
+
+  log->count = 0;
+  log->restart = 1;
+  log->ym2612_clock = ym2612_clock;
+  log->sn76489_clock = sn76489_clock;
+  log->end = 0;
+  log->dropped = 0;
+  YM2612StartTimers(ym2612_clock);
+
+  gwenesis_audio_log = log;
+}
+
+void gwenesis_audio_log_push(int chip, int port, int value, int target)
+{
+  gwenesis_audio_log_t *log = gwenesis_audio_log;
+
+  if (log->count == GWENESIS_AUDIO_LOG_SIZE)
+  {
+    if (gwenesis_audio_log_full)
+      gwenesis_audio_log_full(log);
+    if (log->count == GWENESIS_AUDIO_LOG_SIZE)
+    {
+      log->dropped++;
+      return;
+    }
+  }
+
+  gwenesis_audio_event_t *event = &log->events[log->count++];
+  event->target = target;
+  event->chip = chip;
+  event->port = port;
+  event->value = value;
+}
+
+void gwenesis_audio_log_replay(gwenesis_audio_log_t *log, int target)
+{
+  if (log->restart)
+  {
+    ym2612_clock = log->ym2612_clock;
+    ym2612_index = 0;
+    sn76489_clock = log->sn76489_clock;
+    sn76489_index = 0;
+    log->restart = 0;
+  }
+
+  for (int i = 0; i < log->count; i++)
+  {
+    gwenesis_audio_event_t *event = &log->events[i];
+    if (event->chip == AUDIO_LOG_YM2612)
+    {
+      ym2612_run(event->target);
+      YM2612WritePort(event->port, event->value);
+    }
+    else
+    {
+      gwenesis_SN76489_run(event->target);
+      gwenesis_SN76489_WritePort(event->value);
+    }
+  }
+  log->count = 0;
+
+  if (target)
+  {
+    ym2612_run(target);
+    gwenesis_SN76489_run(target);
+  }
+}
@@ -0,0 +1,50 @@
+#ifndef _GWENESIS_AUDIO_LOG_H_
+#define _GWENESIS_AUDIO_LOG_H_
+
+/*
+    Deferred sound chips synthesis.
+
+    When a log is installed with gwenesis_audio_log_start(), YM2612Write() and
+    gwenesis_SN76489_Write() no longer synthesize up to the current cycle. They
+    only append the write and its timestamp to the log, which is replayed later
+    in a single batch (possibly on another core) by gwenesis_audio_log_replay().
+    The YM2612 timers are still emulated on the CPU side so that status reads
+    remain cycle accurate.
+*/
+
+#define GWENESIS_AUDIO_LOG_SIZE 4096
+
+enum {
+    AUDIO_LOG_YM2612,
+    AUDIO_LOG_SN76489,
+};
+
+typedef struct
+{
+    int target;             /* master clock of the write */
+    unsigned char chip;     /* AUDIO_LOG_YM2612 or AUDIO_LOG_SN76489 */
+    unsigned char port;
+    unsigned char value;
+} gwenesis_audio_event_t;
+
+typedef struct
+{
+    int count;
+    int restart;            /* chips clocks must be reset before replaying */
+    int ym2612_clock;       /* ym2612_clock at the start of the frame */
+    int sn76489_clock;      /* sn76489_clock at the start of the frame */
+    int end;                /* master clock at the end of the frame */
+    int dropped;            /* writes lost because the log was full */
+    gwenesis_audio_event_t events[GWENESIS_AUDIO_LOG_SIZE];
+} gwenesis_audio_log_t;
+
+extern gwenesis_audio_log_t *gwenesis_audio_log;
+
+/* Called when the log is full. It must replay it (target 0) or writes will be lost. */
+extern void (*gwenesis_audio_log_full)(gwenesis_audio_log_t *log);
+
+void gwenesis_audio_log_start(gwenesis_audio_log_t *log, int ym2612_clock, int sn76489_clock);
+void gwenesis_audio_log_push(int chip, int port, int value, int target);
+void gwenesis_audio_log_replay(gwenesis_audio_log_t *log, int target);
+
+#endif /* _GWENESIS_AUDIO_LOG_H_ */
@@ -33,6 +33,7 @@
 #include "gwenesis_bus.h"
 #include "gwenesis_sn76489.h"
 #include "gwenesis_savestate.h"
+#include "gwenesis_audio_log.h"
 
 #define NoiseInitialState   0x8000  /* Initial state of shift register */
 #define PSG_CUTOFF          0x6     /* Value below which PSG does not output */
@@ -220,9 +221,20 @@ if ( sn76489_clock >= target) return;
 }
 void gwenesis_SN76489_Write(int data, int target)
 {
+  // Deferred: the write is replayed later
+  if (gwenesis_audio_log) {
+    gwenesis_audio_log_push(AUDIO_LOG_SN76489, 0, data, target);
+    return;
+  }
+
   if (GWENESIS_AUDIO_ACCURATE == 1)
     gwenesis_SN76489_run(target);
 
+  gwenesis_SN76489_WritePort(data);
+}
+
+void gwenesis_SN76489_WritePort(int data)
+{
   if (data & 0x80) {
     /* Latch/data byte  %1 cc t dddd */
     gwenesis_SN76489.LatchedRegister = ((data >> 4) & 0x07);
@@ -139,6 +139,7 @@
 #include "ym2612.h"
 #include "gwenesis_bus.h"
 #include "gwenesis_savestate.h"
+#include "gwenesis_audio_log.h"
 
 typedef uint32_t UINT32;
 typedef uint16_t UINT16;
@@ -665,6 +666,17 @@ static UINT32 bitmask;    /* working channels output bitmasking (DAC quantizatio
 /* mirror of all OPN registers */
 static uint8_t OPNREGS[512];
 
+/* CPU side copy of the timers, used in deferred mode (see gwenesis_audio_log.h) */
+static struct
+{
+  UINT16  address;        /* address register     */
+  UINT8   status;         /* status flag          */
+  UINT32  mode;           /* timer control        */
+  INT32   TA, TAL, TAC;   /* timer a              */
+  INT32   TB, TBL, TBC;   /* timer b              */
+  int     clock;          /* same as ym2612_clock */
+} timers;
+
 INLINE void FM_KEYON(FM_CH *CH , int s )
 {
   FM_SLOT *SLOT = &CH->SLOT[s];
@@ -2148,6 +2160,101 @@ static inline void YM2612Update(int16_t *buffer, int length)
   INTERNAL_TIMER_B(length);
 }
 
+/* Advance the CPU side timers exactly like YM2612Update() would */
+static void ym2612_timers_run(int target)
+{
+  if (timers.clock >= target)
+    return;
+
+  int length = (target - timers.clock) / ym2612.divisor;
+  if (length <= 0)
+    return;
+  timers.clock += length * ym2612.divisor;
+
+  /* timer A counts down once per sample and reloads when it reaches 0 */
+  if (timers.mode & 0x01)
+  {
+    int first = timers.TAC > 0 ? timers.TAC : 1;
+    if (length >= first)
+    {
+      if (timers.mode & 0x04)
+        timers.status |= 0x01;
+      timers.TAC = timers.TAL - (length - first) % timers.TAL;
+    }
+    else
+    {
+      timers.TAC -= length;
+    }
+  }
+
+  /* timer B counts down once per update */
+  if (timers.mode & 0x02)
+  {
+    timers.TBC -= length;
+    if (timers.TBC <= 0)
+    {
+      if (timers.mode & 0x08)
+        timers.status |= 0x02;
+      if (timers.TBL)
+        timers.TBC += timers.TBL;
+      else
+        timers.TBC = timers.TBL;
+    }
+  }
+}
+
+static void ym2612_timers_write(unsigned int a, unsigned int v)
+{
+  if (!(a & 1))
+  {
+    timers.address = v | (a ? 0x100 : 0);
+    return;
+  }
+
+  switch (timers.address)
+  {
+    case 0x24:
+      timers.TA = (timers.TA & 0x03) | (((int)v) << 2);
+      timers.TAL = 1024 - timers.TA;
+      break;
+    case 0x25:
+      timers.TA = (timers.TA & 0x3fc) | (v & 3);
+      timers.TAL = 1024 - timers.TA;
+      break;
+    case 0x26:
+      timers.TB = v;
+      timers.TBL = (256 - v) << 4;
+      break;
+    case 0x27:
+      if ((v & 1) && !(timers.mode & 1))
+        timers.TAC = timers.TAL;
+      if ((v & 2) && !(timers.mode & 2))
+        timers.TBC = timers.TBL;
+      timers.status &= (~v >> 4);
+      timers.mode = v;
+      break;
+  }
+}
+
+/* Copy the chip's timers to the CPU side. The chip must not be running. */
+void YM2612LoadTimers(void)
+{
+  timers.address = ym2612.OPN.ST.address;
+  timers.status = ym2612.OPN.ST.status;
+  timers.mode = ym2612.OPN.ST.mode;
+  timers.TA = ym2612.OPN.ST.TA;
+  timers.TAL = ym2612.OPN.ST.TAL;
+  timers.TAC = ym2612.OPN.ST.TAC;
+  timers.TB = ym2612.OPN.ST.TB;
+  timers.TBL = ym2612.OPN.ST.TBL;
+  timers.TBC = ym2612.OPN.ST.TBC;
+}
+
+void YM2612StartTimers(int clock)
+{
+  timers.clock = clock;
+}
+
 void ym2612_run( int target) {
 
   if ( ym2612_clock >= target) {
@@ -2172,10 +2279,26 @@ void YM2612Write(unsigned int a, unsigned int v,  int target)
 {
   ym_log(__FUNCTION__," %06x : %02x",a,v);
 
+  v &= 0xff;  /* adjust to 8 bit bus */
+
+  // Deferred: only the timers run now, the write is replayed later
+  if (gwenesis_audio_log)
+  {
+    ym2612_timers_run(target);
+    ym2612_timers_write(a, v);
+    gwenesis_audio_log_push(AUDIO_LOG_YM2612, a, v, target);
+    return;
+  }
+
   //Sync
   if (GWENESIS_AUDIO_ACCURATE == 1)
     ym2612_run(target); 
 
+  YM2612WritePort(a, v);
+}
+
+void YM2612WritePort(unsigned int a, unsigned int v)
+{
   v &= 0xff;  /* adjust to 8 bit bus */
 
   switch( a )
@@ -2222,6 +2345,12 @@ void YM2612Write(unsigned int a, unsigned int v,  int target)
 
 unsigned int YM2612Read(int target)
 {
+  if (gwenesis_audio_log)
+  {
+    ym2612_timers_run(target);
+    return timers.status;
+  }
+
   // //Sync
   if (GWENESIS_AUDIO_ACCURATE == 1)
     ym2612_run(target);
@@ -27,6 +27,9 @@ extern void YM2612ResetChip(void);
 extern void YM2612Write(unsigned int a, unsigned int v, int target);
 extern void ym2612_run(int target);
 extern unsigned int YM2612Read(int target);
+extern void YM2612WritePort(unsigned int a, unsigned int v);
+extern void YM2612LoadTimers(void);
+extern void YM2612StartTimers(int clock);
 
 #if 0
 extern int YM2612LoadContext(unsigned char *state);
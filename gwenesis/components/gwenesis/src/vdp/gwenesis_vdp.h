@@ -134,6 +134,22 @@ void gwenesis_vdp_render_line(int line);
 
 void gwenesis_vdp_render_config();
 
+// Pipelined rendering: the registers and VSRAM of a line are captured when the
+// CPUs reach it, and the line is rendered later (possibly by another thread)
+// from that capture. VRAM isn't captured, so when gwenesis_vdp_render_sync is
+// set it is called before any VRAM write or status read (the renderer sets the
+// sprite flags) and must wait for pending lines.
+typedef struct
+{
+    int line;
+    unsigned char regs[REG_SIZE];
+    unsigned short vsram[VSRAM_MAX_SIZE];
+} gwenesis_vdp_line_t;
+
+extern void (*gwenesis_vdp_render_sync)(void);
+void gwenesis_vdp_capture_line(gwenesis_vdp_line_t *out, int line);
+void gwenesis_vdp_render_captured_line(gwenesis_vdp_line_t *captured);
+
 unsigned int gwenesis_vdp_get_status();
 void gwenesis_vdp_get_debug_status(char *s);
 unsigned short gwenesis_vdp_get_cram(int index);
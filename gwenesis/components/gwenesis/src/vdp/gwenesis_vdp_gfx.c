@@ -53,6 +53,17 @@ extern unsigned short CRAM565[];    // CRAM - Palettes
 
 extern unsigned short VSRAM[];        // VSRAM - Scrolling
 
+// The renderer reads the registers and VSRAM through these pointers so that
+// it can work from a captured line (see gwenesis_vdp_render_captured_line)
+static unsigned char *const live_regs = gwenesis_vdp_regs;
+static unsigned short *const live_vsram = VSRAM;
+static unsigned char *render_regs = gwenesis_vdp_regs;
+static unsigned short *render_vsram = VSRAM;
+#define gwenesis_vdp_regs render_regs
+#define VSRAM render_vsram
+
+void (*gwenesis_vdp_render_sync)(void) = NULL;
+
 // Define screen buffers: original and scaled for host RGB
 unsigned char *screen, *scaled_screen;
 
@@ -1159,6 +1170,22 @@ void gwenesis_vdp_render_line(int line)
   #endif
 }
 
+void gwenesis_vdp_capture_line(gwenesis_vdp_line_t *out, int line)
+{
+  out->line = line;
+  memcpy(out->regs, live_regs, sizeof(out->regs));
+  memcpy(out->vsram, live_vsram, sizeof(out->vsram));
+}
+
+void gwenesis_vdp_render_captured_line(gwenesis_vdp_line_t *captured)
+{
+  render_regs = captured->regs;
+  render_vsram = captured->vsram;
+  gwenesis_vdp_render_line(captured->line);
+  render_regs = live_regs;
+  render_vsram = live_vsram;
+}
+
 void gwenesis_vdp_gfx_save_state() {
   /*
   SaveState* state;
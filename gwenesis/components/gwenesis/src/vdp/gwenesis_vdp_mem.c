@@ -373,6 +373,10 @@ unsigned short status_register_r(void)
             status |= STATUS_HBLANK;
     }
 
+    // The sprite flags are set by the renderer, it must have caught up with the CPU
+    if (gwenesis_vdp_render_sync)
+        gwenesis_vdp_render_sync();
+
     if (sprite_overflow)
         status |= STATUS_SPRITEOVERFLOW;
     if (sprite_collision)
@@ -776,6 +780,9 @@ void gwenesis_vdp_control_port_write(unsigned int value)
       if (REG1_DMA_ENABLED == 0)
         return;
 
+      if (gwenesis_vdp_render_sync)
+        gwenesis_vdp_render_sync();
+
       // gwenesis_vdp_status |= 0x2;
       switch (REG23_DMA_TYPE) {
       case 0:
@@ -829,6 +836,10 @@ void gwenesis_vdp_write_data_port_16(unsigned int value)
 
     push_fifo(value);
 
+    // Pending lines must be rendered before VRAM changes under them
+    if (gwenesis_vdp_render_sync && ((code_reg & 0xF) == 0x1 || dma_fill_pending))
+        gwenesis_vdp_render_sync();
+
         switch (code_reg & 0xF)
         {
         case 0x1: /* VRAM write */
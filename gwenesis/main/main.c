@@ -3,6 +3,7 @@
 #include <stdlib.h>
 
 #include <gwenesis.h>
+#include "src/sound/gwenesis_audio_log.h"
 
 #define AUDIO_SAMPLE_RATE (53267)
 #define AUDIO_BUFFER_LENGTH (AUDIO_SAMPLE_RATE / 60 + 1)
@@ -25,6 +26,8 @@ static int savestate_errors = 0;
 static bool yfm_enabled = true;
 static bool z80_enabled = true;
 static bool sn76489_enabled = true;
+static bool vdp_threaded = false;
+static bool audio_threaded = true;
 
 static rg_surface_t *updates[2];
 static rg_surface_t *currentUpdate;
@@ -33,6 +36,20 @@ static rg_app_t *app;
 static const char *SETTING_YFM_EMULATION = "yfm_enable";
 static const char *SETTING_Z80_EMULATION = "z80_enable";
 static const char *SETTING_SN76489_EMULATION = "sn_enable";
+static const char *SETTING_VDP_THREADED = "vdp_threaded";
+static const char *SETTING_AUDIO_THREADED = "audio_threaded";
+
+// Lines captured by the emulation loop, waiting to be rendered by vdp_task
+#define VDP_QUEUE_LENGTH 16
+static gwenesis_vdp_line_t vdp_queue[VDP_QUEUE_LENGTH];
+static unsigned int vdp_queue_head; // Written by the emulation loop only
+static unsigned int vdp_queue_tail; // Written by vdp_task only
+static bool vdp_task_idle;
+static rg_task_t *vdp_task_handle;
+
+// Sound chips writes of the current and previous frames, synthesized by audio_task
+static gwenesis_audio_log_t *audio_logs[2];
+static rg_task_t *audio_task_handle;
 // --- MAIN
 
 typedef struct {
@@ -107,6 +124,55 @@ void gwenesis_io_get_buttons()
 {
 }
 
+static void vdp_task(void *arg)
+{
+    rg_task_msg_t msg;
+
+    while (true)
+    {
+        unsigned int tail = vdp_queue_tail;
+        if (tail != __atomic_load_n(&vdp_queue_head, __ATOMIC_ACQUIRE))
+        {
+            gwenesis_vdp_render_captured_line(&vdp_queue[tail % VDP_QUEUE_LENGTH]);
+            __atomic_store_n(&vdp_queue_tail, tail + 1, __ATOMIC_RELEASE);
+            continue;
+        }
+
+        // Announce that we're about to sleep, then check again in case a line was queued in between.
+        // If the emulation loop already took the idle flag, a wake up message is on its way.
+        __atomic_store_n(&vdp_task_idle, true, __ATOMIC_SEQ_CST);
+        if (tail != __atomic_load_n(&vdp_queue_head, __ATOMIC_SEQ_CST)
+            && __atomic_exchange_n(&vdp_task_idle, false, __ATOMIC_SEQ_CST))
+            continue;
+
+        rg_task_receive(&msg);
+        if (msg.type == RG_TASK_MSG_STOP)
+            break;
+    }
+}
+
+static void vdp_queue_push(int line)
+{
+    unsigned int head = vdp_queue_head;
+
+    // The queue is full, let the renderer catch up
+    while (head - __atomic_load_n(&vdp_queue_tail, __ATOMIC_ACQUIRE) >= VDP_QUEUE_LENGTH)
+        continue;
+
+    gwenesis_vdp_capture_line(&vdp_queue[head % VDP_QUEUE_LENGTH], line);
+    __atomic_store_n(&vdp_queue_head, head + 1, __ATOMIC_SEQ_CST);
+
+    if (__atomic_exchange_n(&vdp_task_idle, false, __ATOMIC_SEQ_CST))
+        rg_task_send(vdp_task_handle, &(rg_task_msg_t){0});
+}
+
+// Wait for all queued lines to be rendered
+static void vdp_queue_sync(void)
+{
+    while (__atomic_load_n(&vdp_queue_tail, __ATOMIC_ACQUIRE) != vdp_queue_head)
+        continue;
+}
+
 
 static rg_gui_event_t yfm_update_cb(rg_gui_option_t *option, rg_gui_event_t event)
 {
@@ -144,6 +210,74 @@ static rg_gui_event_t z80_update_cb(rg_gui_option_t *option, rg_gui_event_t even
     return RG_DIALOG_VOID;
 }
 
+static void audio_task(void *arg)
+{
+    rg_task_msg_t msg;
+
+    while (true)
+    {
+        rg_task_peek(&msg);
+        if (msg.type == RG_TASK_MSG_STOP)
+            break;
+
+        gwenesis_audio_log_t *log = (gwenesis_audio_log_t *)msg.dataPtr;
+        gwenesis_audio_log_replay(log, log->end);
+
+        if (yfm_enabled || z80_enabled) {
+            // TODO: Mix in gwenesis_sn76489_buffer
+            rg_audio_submit((void *)gwenesis_ym2612_buffer, AUDIO_BUFFER_LENGTH >> 1);
+        }
+
+        rg_task_receive(&msg);
+    }
+}
+
+// Wait for audio_task to finish the previous frame
+static void audio_sync(void)
+{
+    while (rg_task_messages_waiting(audio_task_handle) > 0)
+        continue;
+}
+
+// The log of the current frame is full, catch up with the synthesis here
+static void audio_log_full(gwenesis_audio_log_t *log)
+{
+    audio_sync();
+    gwenesis_audio_log_replay(log, 0);
+}
+
+// Go back to synthesizing on the CPU thread (at least until the next frame)
+static void audio_log_stop(void)
+{
+    audio_sync();
+    gwenesis_audio_log = NULL;
+}
+
+static rg_gui_event_t audio_threaded_update_cb(rg_gui_option_t *option, rg_gui_event_t event)
+{
+    if (event == RG_DIALOG_PREV || event == RG_DIALOG_NEXT)
+    {
+        audio_threaded = !audio_threaded;
+        rg_settings_set_number(NS_APP, SETTING_AUDIO_THREADED, audio_threaded);
+    }
+    strcpy(option->value, audio_threaded ? "On " : "Off");
+
+    return RG_DIALOG_VOID;
+}
+
+static rg_gui_event_t vdp_threaded_update_cb(rg_gui_option_t *option, rg_gui_event_t event)
+{
+    if (event == RG_DIALOG_PREV || event == RG_DIALOG_NEXT)
+    {
+        vdp_threaded = !vdp_threaded;
+        rg_settings_set_number(NS_APP, SETTING_VDP_THREADED, vdp_threaded);
+        gwenesis_vdp_render_sync = vdp_threaded ? &vdp_queue_sync : NULL;
+    }
+    strcpy(option->value, vdp_threaded ? "On " : "Off");
+
+    return RG_DIALOG_VOID;
+}
+
 static bool screenshot_handler(const char *filename, int width, int height)
 {
     return rg_surface_save_image_file(currentUpdate, filename, width, height);
@@ -151,6 +285,7 @@ static bool screenshot_handler(const char *filename, int width, int height)
 
 static bool save_state_handler(const char *filename)
 {
+    audio_sync();
     if ((savestate_fp = fopen(filename, "wb")))
     {
         savestate_errors = 0;
@@ -163,6 +298,7 @@ static bool save_state_handler(const char *filename)
 
 static bool load_state_handler(const char *filename)
 {
+    audio_log_stop();
     if ((savestate_fp = fopen(filename, "rb")))
     {
         savestate_errors = 0;
@@ -177,6 +313,7 @@ static bool load_state_handler(const char *filename)
 
 static bool reset_handler(bool hard)
 {
+    audio_log_stop();
     reset_emulation();
     return true;
 }
@@ -202,6 +339,8 @@ void app_main(void)
         {0, "YM2612 audio ", "-", RG_DIALOG_FLAG_NORMAL, &yfm_update_cb},
         {0, "SN76489 audio", "-", RG_DIALOG_FLAG_NORMAL, &sn76489_update_cb},
         {0, "Z80 emulation", "-", RG_DIALOG_FLAG_NORMAL, &z80_update_cb},
+        {0, "Threaded VDP ", "-", RG_DIALOG_FLAG_NORMAL, &vdp_threaded_update_cb},
+        {0, "Threaded FM  ", "-", RG_DIALOG_FLAG_NORMAL, &audio_threaded_update_cb},
         RG_DIALOG_END
     };
 
@@ -210,6 +349,8 @@ void app_main(void)
     yfm_enabled = rg_settings_get_number(NS_APP, SETTING_YFM_EMULATION, 1);
     sn76489_enabled = rg_settings_get_number(NS_APP, SETTING_SN76489_EMULATION, 0);
     z80_enabled = rg_settings_get_number(NS_APP, SETTING_Z80_EMULATION, 1);
+    vdp_threaded = rg_settings_get_number(NS_APP, SETTING_VDP_THREADED, 0);
+    audio_threaded = rg_settings_get_number(NS_APP, SETTING_AUDIO_THREADED, 1);
 
     updates[0] = rg_surface_create(320, 241, RG_PIXEL_PAL565_BE, MEM_FAST);
     // updates[1] = rg_surface_create(320, 241, RG_PIXEL_PAL565_BE, MEM_FAST);
@@ -223,6 +364,16 @@ void app_main(void)
 
     VRAM = rg_alloc(VRAM_MAX_SIZE, MEM_FAST);
 
+    // The renderer runs on the second core while the CPUs emulate the next lines
+    vdp_task_handle = rg_task_create("gen_vdp", &vdp_task, NULL, 3 * 1024, RG_TASK_PRIORITY_2, 1);
+    gwenesis_vdp_render_sync = vdp_threaded ? &vdp_queue_sync : NULL;
+
+    // FM and PSG synthesis of a frame happens on the second core while the next frame is emulated
+    audio_logs[0] = rg_alloc(sizeof(gwenesis_audio_log_t), MEM_SLOW);
+    audio_logs[1] = rg_alloc(sizeof(gwenesis_audio_log_t), MEM_SLOW);
+    audio_task_handle = rg_task_create("gen_audio", &audio_task, NULL, 3 * 1024, RG_TASK_PRIORITY_3, 1);
+    gwenesis_audio_log_full = &audio_log_full;
+
     RG_LOGI("Genesis start\n");
 
     size_t rom_size;
@@ -266,6 +417,7 @@ void app_main(void)
     uint32_t joystick = 0, joystick_old;
 
     int skipFrames = 0;
+    int frame = 0;
 
     RG_LOGI("emulation loop\n");
     while (true)
@@ -275,6 +427,7 @@ void app_main(void)
 
         if (joystick & (RG_KEY_MENU | RG_KEY_OPTION))
         {
+            audio_log_stop();
             if (joystick & RG_KEY_MENU)
                 rg_gui_game_menu();
             else
@@ -308,11 +461,21 @@ void app_main(void)
         system_clock = 0;
         zclk = z80_enabled ? 0 : 0x1000000;
 
-        ym2612_clock = yfm_enabled ? 0 : 0x1000000;
-        ym2612_index = 0;
+        if (audio_threaded && yfm_enabled)
+        {
+            // ym2612_clock/sn76489_clock belong to audio_task now, it resets them when replaying this log
+            gwenesis_audio_log_start(audio_logs[frame++ & 1], 0, sn76489_enabled ? 0 : 0x1000000);
+        }
+        else
+        {
+            audio_log_stop();
 
-        sn76489_clock = sn76489_enabled ? 0 : 0x1000000;
-        sn76489_index = 0;
+            ym2612_clock = yfm_enabled ? 0 : 0x1000000;
+            ym2612_index = 0;
+
+            sn76489_clock = sn76489_enabled ? 0 : 0x1000000;
+            sn76489_index = 0;
+        }
 
         scan_line = 0;
 
@@ -333,7 +496,12 @@ void app_main(void)
 
             /* Video */
             if (drawFrame && scan_line < screen_height)
-                gwenesis_vdp_render_line(scan_line); /* render scan_line */
+            {
+                if (vdp_threaded)
+                    vdp_queue_push(scan_line); /* queue scan_line for vdp_task */
+                else
+                    gwenesis_vdp_render_line(scan_line); /* render scan_line */
+            }
 
             // On these lines, the line counter interrupt is reloaded
             if ((scan_line == 0) || (scan_line > screen_height)) {
@@ -375,7 +543,12 @@ void app_main(void)
         * synchronize YM2612 and SN76489 to system_clock
         * it completes the missing audio sample for accurate audio mode
         */
-        if (GWENESIS_AUDIO_ACCURATE == 1) {
+        if (gwenesis_audio_log) {
+            if (gwenesis_audio_log->dropped)
+                RG_LOGW("Audio log full, %d writes dropped\n", gwenesis_audio_log->dropped);
+            gwenesis_audio_log->end = system_clock;
+            rg_task_send(audio_task_handle, &(rg_task_msg_t){.dataPtr = gwenesis_audio_log});
+        } else if (GWENESIS_AUDIO_ACCURATE == 1) {
             gwenesis_SN76489_run(system_clock);
             ym2612_run(system_clock);
         }
@@ -385,6 +558,7 @@ void app_main(void)
 
         if (drawFrame)
         {
+            vdp_queue_sync();
             for (int i = 0; i < 256; ++i)
                 currentUpdate->palette[i] = (CRAM565[i] << 8) | (CRAM565[i] >> 8);
             slowFrame = !rg_display_sync(false);
@@ -395,7 +569,7 @@ void app_main(void)
 
         rg_system_tick(rg_system_timer() - startTime);
 
-        if (yfm_enabled || z80_enabled) {
+        if ((yfm_enabled || z80_enabled) && !gwenesis_audio_log) {
             // TODO: Mix in gwenesis_sn76489_buffer
             rg_audio_submit((void *)gwenesis_ym2612_buffer, AUDIO_BUFFER_LENGTH >> 1);
         }
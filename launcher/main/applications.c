@@ -74,22 +74,84 @@ static int scan_folder_cb(const rg_scandir_t *entry, void *arg)
     return RG_SCANDIR_CONTINUE;
 }
 
+static size_t file_name_length(const retro_file_t *file)
+{
+    // Files are listed and sorted without their extension
+    const char *ext = file->type == RETRO_TYPE_FILE ? strrchr(file->name, '.') : NULL;
+    return ext ? ext - file->name : strlen(file->name);
+}
+
+static int files_comp(const void *a, const void *b)
+{
+    const retro_file_t *file_a = a, *file_b = b;
+    // Folders are unique strings, grouping them by address is enough to keep each folder contiguous
+    if (file_a->folder != file_b->folder)
+        return file_a->folder < file_b->folder ? -1 : 1;
+    if (file_a->type != file_b->type)
+        return (int)file_a->type - file_b->type;
+    size_t len_a = file_name_length(file_a), len_b = file_name_length(file_b);
+    int ret = strncasecmp(file_a->name, file_b->name, RG_MIN(len_a, len_b));
+    return ret ? ret : ((int)len_a - (int)len_b);
+}
+
+// The index maps file names to their position in app->files, it must be rebuilt after sorting
+static bool files_index_build(retro_app_t *app)
+{
+    size_t size = 64;
+    while (size < app->files_count * 2)
+        size <<= 1;
+
+    free(app->files_index);
+    app->files_index_mask = size - 1;
+    app->files_index = calloc(size, sizeof(uint32_t));
+    if (!app->files_index)
+        return false;
+
+    for (size_t i = 0; i < app->files_count; i++)
+    {
+        const char *name = app->files[i].name;
+        size_t slot = rg_hash(name, strlen(name)) & app->files_index_mask;
+        while (app->files_index[slot])
+            slot = (slot + 1) & app->files_index_mask;
+        app->files_index[slot] = i + 1;
+    }
+    return true;
+}
+
+static retro_file_t *files_index_find(const retro_app_t *app, const char *folder, const char *name, size_t len)
+{
+    if (!app->files_index)
+        return NULL;
+    size_t slot = rg_hash(name, len) & app->files_index_mask;
+    while (app->files_index[slot])
+    {
+        retro_file_t *file = &app->files[app->files_index[slot] - 1];
+        if ((!folder || file->folder == folder) && strncmp(file->name, name, len) == 0 && file->name[len] == 0)
+            return file;
+        slot = (slot + 1) & app->files_index_mask;
+    }
+    return NULL;
+}
+
 static int scan_saves_cb(const rg_scandir_t *entry, void *arg)
 {
     if (entry->is_file && rg_extension_match(entry->basename, "sav"))
     {
-        retro_app_t *app = (retro_app_t *)arg;
-        for (size_t i = 0; i < app->files_count; i++)
+        const retro_app_t *app = (const retro_app_t *)arg;
+        // Saves are the rom name with `.sav` or `-0.sav` appended.
+        const char *name = entry->basename;
+        size_t len = strlen(name) - 4;
+        retro_file_t *file = files_index_find(app, NULL, name, len);
+        if (!file)
         {
-            retro_file_t *file = &app->files[i];
-            // Saves are the rom name with possibly `.sav` or `-0.sav` appended.
-            if (strncmp(entry->basename, file->name, strlen(file->name)) == 0)
-            {
-                // FIXME: Check if folder matches first
-                file->saves++;
-                break;
-            }
+            while (len > 0 && name[len - 1] >= '0' && name[len - 1] <= '9')
+                len--;
+            if (len > 1 && name[len - 1] == '-')
+                file = files_index_find(app, NULL, name, len - 1);
         }
+        // FIXME: Check if folder matches first
+        if (file)
+            file->saves++;
     }
     return RG_SCANDIR_CONTINUE;
 }
@@ -106,7 +168,12 @@ static void application_init(retro_app_t *app)
     rg_storage_mkdir(app->paths.roms);
 
     rg_storage_scandir(app->paths.roms, scan_folder_cb, app, RG_SCANDIR_RECURSIVE);
-    rg_storage_scandir(app->paths.saves, scan_saves_cb, app, RG_SCANDIR_RECURSIVE);
+    // Sorting once here means that every folder's list comes out already sorted in tab_refresh
+    qsort(app->files, app->files_count, sizeof(retro_file_t), files_comp);
+    if (files_index_build(app))
+        rg_storage_scandir(app->paths.saves, scan_saves_cb, app, RG_SCANDIR_RECURSIVE);
+    else
+        RG_LOGE("Out of memory, saves won't be listed");
     // rg_storage_scandir(app->paths.covers, scan_folder_cb3, app, RG_SCANDIR_RECURSIVE);
 
     app->use_crc_covers = rg_storage_exists(strcat(app->paths.covers, "/0"));
@@ -313,6 +380,14 @@ void crc_cache_prebuild(void)
     crc_cache_save();
 }
 
+static void format_item(const listbox_item_t *item, char *buffer, size_t buffer_size)
+{
+    if (item->group == 1)
+        snprintf(buffer, buffer_size, "[%.40s]", item->text);
+    else
+        snprintf(buffer, buffer_size, "%.*s", item->text_len, item->text);
+}
+
 static void tab_refresh(tab_t *tab, const char *selected)
 {
     retro_app_t *app = (retro_app_t *)tab->arg;
@@ -322,7 +397,6 @@ static void tab_refresh(tab_t *tab, const char *selected)
     const char *basepath = rg_unique_string(app->paths.roms);
     const char *folder = rg_unique_string(tab->navpath ?: basepath);
     size_t items_count = 0;
-    char *ext = NULL;
 
     if (folder == basepath)
         tab->navpath = NULL;
@@ -338,24 +412,22 @@ static void tab_refresh(tab_t *tab, const char *selected)
             if (file->type == RETRO_TYPE_INVALID || !file->name)
                 continue;
 
-            if (file->folder != folder && strcmp(file->folder, folder) != 0)
-                continue;
-
-            if (file->type == RETRO_TYPE_FOLDER)
+            // Both are unique strings and the files are grouped by folder (see files_comp)
+            if (file->folder != folder)
             {
-                listbox_item_t *item = &tab->listbox.items[items_count++];
-                snprintf(item->text, sizeof(item->text), "[%.40s]", file->name);
-                item->group = 1;
-                item->arg = file;
+                if (items_count > 0)
+                    break;
+                continue;
             }
-            else if (file->type == RETRO_TYPE_FILE)
+
+            if (file->type == RETRO_TYPE_FOLDER || file->type == RETRO_TYPE_FILE)
             {
-                listbox_item_t *item = &tab->listbox.items[items_count++];
-                snprintf(item->text, sizeof(item->text), "%s", file->name);
-                if ((ext = strrchr(item->text, '.')))
-                    *ext = 0;
-                item->group = 2;
-                item->arg = file;
+                tab->listbox.items[items_count++] = (listbox_item_t){
+                    .text = file->name,
+                    .text_len = file_name_length(file),
+                    .group = file->type == RETRO_TYPE_FOLDER ? 1 : 2,
+                    .arg = file,
+                };
             }
         }
     }
@@ -365,14 +437,9 @@ static void tab_refresh(tab_t *tab, const char *selected)
 
     if (items_count == 0)
     {
-        gui_resize_list(tab, 6);
-        sprintf(tab->listbox.items[0].text, "Welcome to Retro-Go!");
-        sprintf(tab->listbox.items[1].text, " ");
-        sprintf(tab->listbox.items[2].text, "Place roms in folder: %s", rg_relpath(app->paths.roms));
-        sprintf(tab->listbox.items[3].text, "With file extension: %s", app->extensions);
-        sprintf(tab->listbox.items[4].text, " ");
-        sprintf(tab->listbox.items[5].text, "You can hide this tab in the menu");
-        tab->listbox.cursor = 4;
+        gui_set_list_message(tab, 4, "Welcome to Retro-Go!\n \nPlace roms in folder: %s\n"
+                             "With file extension: %s\n \nYou can hide this tab in the menu",
+                             rg_relpath(app->paths.roms), app->extensions);
     }
     else if (selected)
     {
@@ -402,6 +469,8 @@ static void event_handler(gui_event_t event, tab_t *tab)
         {
             for (size_t i = 0; i < app->files_count; ++i)
                 free((char *)app->files[i].name);
+            free(app->files_index);
+            app->files_index = NULL;
             app->files_count = 0;
             app->initialized = false;
         }
@@ -413,15 +482,8 @@ static void event_handler(gui_event_t event, tab_t *tab)
         if (selected) // && !rg_storage_exists(get_file_path(selected)))
         {
             // rg_storage_exists can take a long time on large folders (200ms), this is much faster
-            for (size_t i = 0; i < app->files_count; ++i)
-            {
-                retro_file_t *file = &app->files[i];
-                if (selected->folder == file->folder && strcmp(selected->name, file->name) == 0)
-                {
-                    tab->navpath = file->folder;
-                    break;
-                }
-            }
+            if (application_find_file(app, selected->folder, selected->name))
+                tab->navpath = selected->folder;
         }
 
         tab_refresh(tab, selected ? selected->name : NULL);
@@ -474,6 +536,13 @@ static void event_handler(gui_event_t event, tab_t *tab)
     }
 }
 
+retro_file_t *application_find_file(retro_app_t *app, const char *folder, const char *name)
+{
+    RG_ASSERT_ARG(app && name);
+    retro_file_t *file = files_index_find(app, rg_unique_string(folder), name, strlen(name));
+    return (file && file->type != RETRO_TYPE_INVALID) ? file : NULL;
+}
+
 bool application_path_to_file(const char *path, retro_file_t *file)
 {
     RG_ASSERT_ARG(path && file);
@@ -490,6 +559,14 @@ bool application_path_to_file(const char *path, retro_file_t *file)
                 .type = RETRO_TYPE_FILE,
                 .app = apps[i],
             };
+            // If the application was already scanned we know everything about the file
+            const retro_file_t *known = application_find_file(apps[i], file->folder, file->name);
+            if (known)
+            {
+                file->checksum = known->checksum;
+                file->missing_cover = known->missing_cover;
+                file->saves = known->saves;
+            }
             return true;
         }
     }
@@ -678,7 +755,8 @@ static void application(const char *desc, const char *name, const char *exts, co
     app->files_capacity = 100;
     app->crc_offset = crc_offset;
 
-    gui_add_tab(app->short_name, app->description, app, event_handler);
+    tab_t *tab = gui_add_tab(app->short_name, app->description, app, event_handler);
+    tab->listbox.format = format_item;
 }
 
 void applications_init(void)
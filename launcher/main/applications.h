@@ -40,6 +40,8 @@ typedef struct retro_app_s
     retro_file_t *files;
     size_t files_capacity;
     size_t files_count;
+    uint32_t *files_index; // Hash table of files by name, see application_find_file()
+    size_t files_index_mask;
     bool use_crc_covers;
     bool initialized;
     bool available;
@@ -51,4 +53,5 @@ void applications_init(void);
 void application_show_file_menu(retro_file_t *file, bool simplified);
 bool application_get_file_crc32(retro_file_t *file);
 bool application_path_to_file(const char *path, retro_file_t *out_file);
+retro_file_t *application_find_file(retro_app_t *app, const char *folder, const char *name);
 void crc_cache_prebuild(void);
@@ -6,6 +6,29 @@
 #include "bookmarks.h"
 #include "gui.h"
 
+// Books are stored as a log of add/remove records, replayed at load time. Updates only append a
+// record, the file is compacted (rewritten with only the current items) when it grows too much.
+#define BOOK_FILE_MAGIC   0x4B4F4F42 // "BOOK"
+#define BOOK_FILE_VERSION 1
+
+enum {BOOK_OP_ADD = 1, BOOK_OP_REMOVE = 2};
+
+typedef struct __attribute__((__packed__))
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+} book_header_t;
+
+typedef struct __attribute__((__packed__))
+{
+    uint32_t crc;    // Of everything that follows, including the path
+    uint32_t hash;   // rg_hash() of the path
+    uint16_t length; // Of the path, which follows the record and isn't NUL terminated
+    uint8_t op;
+    uint8_t reserved;
+} book_record_t;
+
 static book_t books[BOOK_TYPE_COUNT];
 
 
@@ -68,7 +91,9 @@ static void tab_refresh(book_t *book)
             {
                 listbox_item_t *listitem = &tab->listbox.items[items_count++];
                 const char *type = file->app ? file->app->short_name : "n/a";
-                snprintf(listitem->text, sizeof(listitem->text), "[%-3s] %.40s", type, file->name);
+                snprintf(book->labels[i], sizeof(book->labels[i]), "[%-3s] %.40s", type, file->name);
+                listitem->text = book->labels[i];
+                listitem->text_len = strlen(book->labels[i]);
                 listitem->arg = file;
                 listitem->order = i;
             }
@@ -80,13 +105,8 @@ static void tab_refresh(book_t *book)
 
     if (items_count == 0)
     {
-        gui_resize_list(tab, 6);
-        sprintf(tab->listbox.items[0].text, "Welcome to Retro-Go!");
-        sprintf(tab->listbox.items[1].text, " ");
-        sprintf(tab->listbox.items[2].text, "You have no %s games", book->name);
-        sprintf(tab->listbox.items[3].text, " ");
-        sprintf(tab->listbox.items[4].text, "You can hide this tab in the menu");
-        tab->listbox.cursor = 3;
+        gui_set_list_message(tab, 3, "Welcome to Retro-Go!\n \nYou have no %s games\n \n"
+                             "You can hide this tab in the menu", book->name);
     }
 }
 
@@ -100,13 +120,25 @@ static void book_repack(book_t *book)
         if (item->type == RETRO_TYPE_INVALID)
             continue;
         if (book->count != i)
+        {
             book->items[book->count] = *item;
+            book->hashes[book->count] = book->hashes[i];
+            item->type = RETRO_TYPE_INVALID;
+        }
         book->count++;
     }
 }
 
-static void book_append(book_t *book, const retro_file_t *new_item)
+static uint32_t book_path_hash(const retro_file_t *file, char *path)
+{
+    size_t len = snprintf(path, RG_PATH_MAX + 1, "%s/%s", file->folder, file->name);
+    return rg_hash(path, RG_MIN(len, RG_PATH_MAX));
+}
+
+static void book_append(book_t *book, const retro_file_t *new_item, uint32_t hash)
 {
+    if (book->count >= book->capacity)
+        book_repack(book);
     // Remove the oldest item if we need the space
     while (book->count >= book->capacity)
     {
@@ -115,6 +147,7 @@ static void book_append(book_t *book, const retro_file_t *new_item)
     }
     book->items[book->count] = *new_item;
     book->items[book->count].type = RETRO_TYPE_FILE;
+    book->hashes[book->count] = hash;
     book->count++;
 }
 
@@ -134,17 +167,146 @@ static retro_file_t *book_find(book_t *book, const retro_file_t *file)
     return NULL;
 }
 
-static void book_load(book_t *book)
+static size_t book_encode(uint8_t *buffer, int op, const retro_file_t *file)
+{
+    book_record_t *record = (book_record_t *)buffer;
+    char *path = (char *)(record + 1);
+    uint32_t hash = book_path_hash(file, path);
+    *record = (book_record_t){
+        .hash = hash,
+        .length = strlen(path),
+        .op = op,
+    };
+    record->crc = rg_crc32(0, buffer + 4, sizeof(book_record_t) - 4 + record->length);
+    return sizeof(book_record_t) + record->length;
+}
+
+static bool book_save(book_t *book)
+{
+    uint8_t buffer[sizeof(book_record_t) + RG_PATH_MAX + 1];
+    book_header_t header = {BOOK_FILE_MAGIC, BOOK_FILE_VERSION, 0};
+    bool success = false;
+
+    FILE *fp = fopen(book->path, "wb");
+    if (!fp && rg_storage_mkdir(rg_dirname(book->path)))
+    {
+        fp = fopen(book->path, "wb");
+    }
+    if (fp)
+    {
+        fwrite(&header, sizeof(header), 1, fp);
+        for (size_t i = 0; i < book->capacity; i++)
+        {
+            if (book->items[i].type != RETRO_TYPE_INVALID)
+                fwrite(buffer, book_encode(buffer, BOOK_OP_ADD, &book->items[i]), 1, fp);
+        }
+        success = !ferror(fp);
+        fclose(fp);
+    }
+
+    book->records = book->count;
+    book->rewrite = !success;
+    return success;
+}
+
+static bool book_log(book_t *book, int op, const retro_file_t *file)
+{
+    uint8_t buffer[sizeof(book_record_t) + RG_PATH_MAX + 1];
+    size_t buffer_len;
+    FILE *fp;
+
+    // Compacting once the log holds mostly dead records keeps the file (and load time) bounded.
+    // book_replay() looks up each record in the hashes array, so a load costs records * capacity
+    // uint32 compares. With records <= 2 * count + 32 that only depends on the book's own size,
+    // and even a full favourites book (2000 items) replays in about 8 million compares, not worth
+    // an index that would have to be rebuilt on every load.
+    if (book->rewrite || book->records > book->count * 2 + 32)
+        return book_save(book);
+
+    buffer_len = book_encode(buffer, op, file);
+    if (!(fp = fopen(book->path, "ab")))
+        return book_save(book);
+    bool success = fwrite(buffer, buffer_len, 1, fp) == 1;
+    fclose(fp);
+
+    book->records++;
+    book->rewrite = !success;
+    return success;
+}
+
+static retro_file_t *book_find_hash(book_t *book, uint32_t hash, const char *path)
+{
+    char item_path[RG_PATH_MAX + 1];
+    for (size_t i = 0; i < book->capacity; i++)
+    {
+        retro_file_t *entry = &book->items[i];
+        if (entry->type == RETRO_TYPE_INVALID || book->hashes[i] != hash)
+            continue;
+        if (book_path_hash(entry, item_path) == hash && strcmp(item_path, path) == 0)
+            return entry;
+    }
+    return NULL;
+}
+
+static bool book_replay(book_t *book, const uint8_t *data, size_t data_len)
+{
+    const book_header_t *header = (const book_header_t *)data;
+    size_t offset = sizeof(book_header_t);
+    retro_file_t tmp_file;
+
+    if (data_len < sizeof(book_header_t) || header->magic != BOOK_FILE_MAGIC || header->version != BOOK_FILE_VERSION)
+    {
+        RG_LOGW("Invalid or unsupported file: '%s'", book->path);
+        return false;
+    }
+
+    while (offset < data_len)
+    {
+        const book_record_t *record = (const book_record_t *)(data + offset);
+        char path[RG_PATH_MAX + 1];
+
+        // A truncated or damaged record means the end of the usable log, keep what we have so far
+        if (data_len - offset < sizeof(book_record_t) || record->length > RG_PATH_MAX
+            || data_len - offset - sizeof(book_record_t) < record->length
+            || rg_crc32(0, (const uint8_t *)record + 4, sizeof(book_record_t) - 4 + record->length) != record->crc)
+        {
+            book_repack(book);
+            RG_LOGW("Damaged record at offset %d in '%s', %d items recovered",
+                    (int)offset, book->path, (int)book->count);
+            return false;
+        }
+
+        memcpy(path, record + 1, record->length);
+        path[record->length] = 0;
+        offset += sizeof(book_record_t) + record->length;
+        book->records++;
+
+        for (retro_file_t *item; (item = book_find_hash(book, record->hash, path));)
+            item->type = RETRO_TYPE_INVALID;
+
+        if (record->op == BOOK_OP_ADD)
+        {
+            if (application_path_to_file(path, &tmp_file))
+                book_append(book, &tmp_file, record->hash);
+            else
+                RG_LOGW("Unknown path form: '%s'", path);
+        }
+    }
+
+    book_repack(book);
+    return true;
+}
+
+static void book_load_legacy(book_t *book, const char *path)
 {
     retro_file_t tmp_file;
     char line_buffer[169] = {0};
+    char file_path[RG_PATH_MAX + 1];
 
-    // FIXME: We should leverage cJSON here instead...
-    FILE *fp = fopen(book->path, "r");
+    FILE *fp = fopen(path, "r");
     if (fp)
     {
-        book->count = 0;
-
+        RG_LOGI("Importing '%s'", path);
         while (fgets(line_buffer, sizeof(line_buffer) - 1, fp))
         {
             size_t len = strlen(line_buffer);
@@ -155,7 +317,7 @@ static void book_load(book_t *book)
             }
 
             if (application_path_to_file(line_buffer, &tmp_file))
-                book_append(book, &tmp_file);
+                book_append(book, &tmp_file, book_path_hash(&tmp_file, file_path));
             else
                 RG_LOGW("Unknown path form: '%s'\n", line_buffer);
         }
@@ -163,24 +325,27 @@ static void book_load(book_t *book)
     }
 }
 
-static void book_save(book_t *book)
+static void book_load(book_t *book, const char *legacy_path)
 {
-    // FIXME: We should leverage cJSON here instead...
-    FILE *fp = fopen(book->path, "w");
-    if (!fp && rg_storage_mkdir(rg_dirname(book->path)))
+    void *data = NULL;
+    size_t data_len = 0;
+
+    book->count = 0;
+    book->records = 0;
+
+    if (rg_storage_read_file(book->path, &data, &data_len, 0))
     {
-        fp = fopen(book->path, "w");
+        book->rewrite = !book_replay(book, data, data_len);
+        free(data);
     }
-    if (fp)
+    else
     {
-        for (size_t i = 0; i < book->capacity; i++)
-        {
-            retro_file_t *file = &book->items[i];
-            if (file->type != RETRO_TYPE_INVALID)
-                fprintf(fp, "%s/%s\n", file->folder, file->name);
-        }
-        fclose(fp);
+        book_load_legacy(book, legacy_path);
+        book->rewrite = true;
     }
+
+    if (book->rewrite && (book->count > 0 || book->records > 0))
+        book_save(book);
 }
 
 static void book_init(book_type_t book_type, const char *name, const char *desc, size_t capacity)
@@ -188,13 +353,15 @@ static void book_init(book_type_t book_type, const char *name, const char *desc,
     book_t *book = &books[book_type];
     char path[RG_PATH_MAX + 1];
 
-    sprintf(path, "%s/%s.txt", RG_BASE_PATH_CONFIG, name);
+    sprintf(path, "%s/%s.bin", RG_BASE_PATH_CONFIG, name);
 
     book->name = strdup(name);
     book->path = strdup(path);
     book->capacity = capacity;
     book->count = 0;
     book->items = calloc(capacity + 1, sizeof(retro_file_t));
+    book->hashes = calloc(capacity + 1, sizeof(uint32_t));
+    book->labels = calloc(capacity + 1, sizeof(*book->labels));
     book->tab = gui_add_tab(name, desc, book, event_handler);
     book->initialized = true;
 
@@ -204,7 +371,8 @@ static void book_init(book_type_t book_type, const char *name, const char *desc,
         book->tab->listbox.cursor = 0;
     }
 
-    book_load(book);
+    sprintf(path, "%s/%s.txt", RG_BASE_PATH_CONFIG, name);
+    book_load(book, path);
     tab_refresh(book);
 }
 
@@ -241,12 +409,13 @@ bool bookmark_add(book_type_t book_type, const retro_file_t *file)
     RG_ASSERT_ARG(book_type < BOOK_TYPE_COUNT && file != NULL);
 
     book_t *book = &books[book_type];
+    char path[RG_PATH_MAX + 1];
 
     for (retro_file_t *item; (item = book_find(book, file));)
         item->type = RETRO_TYPE_INVALID;
 
-    book_append(book, file);
-    book_save(book);
+    book_append(book, file, book_path_hash(file, path));
+    book_log(book, BOOK_OP_ADD, file);
     tab_refresh(book);
 
     return true;
@@ -269,7 +438,7 @@ bool bookmark_remove(book_type_t book_type, const retro_file_t *file)
         return false;
 
     book_repack(book);
-    book_save(book);
+    book_log(book, BOOK_OP_REMOVE, file);
     tab_refresh(book);
 
     return true;
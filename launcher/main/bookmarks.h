@@ -16,6 +16,10 @@ typedef struct
     size_t capacity;
     size_t count;
     retro_file_t *items;
+    uint32_t *hashes;   // Hash of each item's path, as stored in the file
+    size_t records;     // Records in the file, see book_log()
+    bool rewrite;       // The file must be rewritten before records can be appended
+    char (*labels)[48]; // List text of each item, books are small enough to format them all
     tab_t *tab;
     bool initialized;
 } book_t;
@@ -1,6 +1,7 @@
 #include <rg_system.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stdarg.h>
 
 #include "applications.h"
 #include "gui.h"
@@ -235,14 +236,20 @@ listbox_item_t *gui_get_selected_item(tab_t *tab)
     return NULL;
 }
 
+static int list_comp_text(const listbox_item_t *a, const listbox_item_t *b)
+{
+    int ret = strncasecmp(a->text, b->text, RG_MIN(a->text_len, b->text_len));
+    return ret ? ret : ((int)a->text_len - b->text_len);
+}
+
 static int list_comp_text_asc(const listbox_item_t *a, const listbox_item_t *b)
 {
-    return a->group == b->group ? strcasecmp(a->text, b->text) : ((int)a->group - b->group);
+    return a->group == b->group ? list_comp_text(a, b) : ((int)a->group - b->group);
 }
 
 static int list_comp_text_desc(const listbox_item_t *a, const listbox_item_t *b)
 {
-    return a->group == b->group ? strcasecmp(b->text, a->text) : ((int)a->group - b->group);
+    return a->group == b->group ? list_comp_text(b, a) : ((int)a->group - b->group);
 }
 
 static int list_comp_id_asc(const listbox_item_t *a, const listbox_item_t *b)
@@ -257,13 +264,41 @@ static int list_comp_id_desc(const listbox_item_t *a, const listbox_item_t *b)
 
 void gui_sort_list(tab_t *tab)
 {
-    void *comp[] = {&list_comp_id_asc, &list_comp_id_desc, &list_comp_text_asc, &list_comp_text_desc};
+    int (*comp[])(const listbox_item_t *, const listbox_item_t *) = {
+        &list_comp_id_asc, &list_comp_id_desc, &list_comp_text_asc, &list_comp_text_desc};
     size_t sort_mode = tab->listbox.sort_mode - 1;
+    listbox_t *list = &tab->listbox;
 
-    if (!tab->listbox.length || sort_mode > RG_COUNT(comp) - 1)
+    if (!list->length || sort_mode > RG_COUNT(comp) - 1)
         return;
 
-    qsort((void*)tab->listbox.items, tab->listbox.length, sizeof(listbox_item_t), comp[sort_mode]);
+    // Lists are usually built from sources that are already in order (see applications.c), or in
+    // the reverse order. Checking that is much cheaper than sorting again.
+    int ordered = 0, reversed = 0;
+    for (int i = 1; i < list->length; i++)
+    {
+        int ret = comp[sort_mode](&list->items[i - 1], &list->items[i]);
+        if (ret > 0)
+            reversed++;
+        else if (ret < 0)
+            ordered++;
+        if (reversed && ordered)
+            break;
+    }
+
+    if (reversed && !ordered)
+    {
+        for (int i = 0, j = list->length - 1; i < j; i++, j--)
+        {
+            listbox_item_t temp = list->items[i];
+            list->items[i] = list->items[j];
+            list->items[j] = temp;
+        }
+    }
+    else if (reversed)
+    {
+        qsort((void*)list->items, list->length, sizeof(listbox_item_t), (void *)comp[sort_mode]);
+    }
 }
 
 void gui_resize_list(tab_t *tab, int new_size)
@@ -291,6 +326,48 @@ void gui_resize_list(tab_t *tab, int new_size)
         list->cursor = new_size ? new_size - 1 : 0;
 }
 
+void gui_set_list_message(tab_t *tab, int cursor, const char *format, ...)
+{
+    listbox_t *list = &tab->listbox;
+    char buffer[512];
+    va_list args;
+
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    free(list->message);
+    list->message = strdup(buffer);
+
+    int lines = 1;
+    for (const char *ptr = buffer; *ptr; ptr++)
+        lines += (*ptr == '\n');
+
+    gui_resize_list(tab, lines);
+
+    char *line = list->message;
+    for (int i = 0; i < lines; i++)
+    {
+        char *end = strchr(line, '\n');
+        if (end)
+            *end = 0;
+        list->items[i] = (listbox_item_t){.text = line, .text_len = strlen(line)};
+        line = end + 1;
+    }
+
+    list->cursor = RG_MIN(cursor, lines - 1);
+}
+
+void gui_format_item(const listbox_t *list, int index, char *buffer, size_t buffer_size)
+{
+    if (index < 0 || index >= list->length)
+        buffer[0] = 0;
+    else if (list->format && list->items[index].arg)
+        list->format(&list->items[index], buffer, buffer_size);
+    else
+        snprintf(buffer, buffer_size, "%.*s", list->items[index].text_len, list->items[index].text);
+}
+
 void gui_scroll_list(tab_t *tab, scroll_whence_t mode, int arg)
 {
     listbox_t *list = &tab->listbox;
@@ -487,11 +564,13 @@ void gui_draw_list(tab_t *tab)
         line_offset = list->cursor - (lines / 2);
     }
 
+    // Only the visible window is formatted and drawn, the list itself may hold thousands of items
     for (int i = 0; i < lines; i++)
     {
         int idx = line_offset + i;
         int selected = idx == list->cursor;
-        char *label = (idx >= 0 && idx < list->length) ? list->items[idx].text : "";
+        char label[96];
+        gui_format_item(list, idx, label, sizeof(label));
         top += rg_gui_draw_text(0, top, gui.width, label, fg[selected], bg[selected], 0).height;
     }
 }
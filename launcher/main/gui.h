@@ -64,13 +64,17 @@ typedef struct {
 } theme_t;
 
 typedef struct {
-    char text[92];
+    const char *text;  // Not copied, must remain valid while in the list. Also the sort key.
+    uint16_t text_len; // Length of text to sort and display (eg without the file extension)
     int16_t order;
     uint8_t group;
     uint8_t unused; // icon, enabled
     void *arg;
 } listbox_item_t;
 
+// Items are only formatted when they become visible. Without a formatter the text is shown as is.
+typedef void (*listbox_format_t)(const listbox_item_t *item, char *buffer, size_t buffer_size);
+
 typedef struct {
     // listbox_item_t **items;
     listbox_item_t *items;
@@ -78,6 +82,8 @@ typedef struct {
     int length;
     int cursor;
     int sort_mode;
+    listbox_format_t format;
+    char *message; // Text storage for gui_set_list_message()
 } listbox_t;
 
 typedef struct {
@@ -150,6 +156,8 @@ rg_image_t *gui_get_image(const char *type, const char *subtype);
 void gui_sort_list(tab_t *tab);
 void gui_scroll_list(tab_t *tab, scroll_whence_t mode, int arg);
 void gui_resize_list(tab_t *tab, int new_size);
+void gui_set_list_message(tab_t *tab, int cursor, const char *format, ...) __attribute__((format(printf,3,4)));
+void gui_format_item(const listbox_t *list, int index, char *buffer, size_t buffer_size);
 listbox_item_t *gui_get_selected_item(tab_t *tab);
 
 void gui_init(bool cold_boot);
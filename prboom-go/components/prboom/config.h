@@ -9,6 +9,11 @@
    INSTRUMENTED is also defined. */
 /* #undef HEAPDUMP */
 
+/* Define to memory map WAD files, on platforms that have mmap() */
+#if !defined(ESP_PLATFORM) && !defined(_WIN32)
+#define HAVE_MMAP
+#endif
+
 /* Define on targets supporting 386 assembly */
 /* #undef I386_ASM */
 
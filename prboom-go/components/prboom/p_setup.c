@@ -52,6 +52,7 @@
 #include "v_video.h"
 #include "r_demo.h"
 #include "r_fps.h"
+#include "i_system.h"
 
 //
 // MAP related Lookup tables.
@@ -1485,9 +1486,13 @@ void P_SetupLevel(int episode, int map, int playermask, skill_t skill)
 
   char  gl_lumpname[9];
   int   gl_lumpnum;
+  int   start_time = I_GetTimeMS();
 
   R_StopAllInterpolations();
 
+  // Lumps read while playing are hitches, report those of the previous level
+  W_LogCacheStats("in game");
+
   totallive = totalkills = totalitems = totalsecret = wminfo.maxfrags = 0;
   wminfo.partime = 180;
 
@@ -1641,6 +1646,9 @@ void P_SetupLevel(int episode, int map, int playermask, skill_t skill)
     R_PrecacheLevel();
 
   R_SmoothPlaying_Reset(NULL); // e6y
+
+  W_LogCacheStats("level load");
+  lprintf(LO_INFO, "P_SetupLevel: %s loaded in %dms\n", lumpname, I_GetTimeMS() - start_time);
 }
 
 //
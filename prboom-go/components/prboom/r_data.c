@@ -43,6 +43,7 @@
 #include "p_tick.h"
 #include "lprintf.h"  // jff 08/03/98 - declaration of lprintf
 #include "p_tick.h"
+#include <rg_system.h>
 
 //
 // Graphics.
@@ -446,6 +447,46 @@ int tran_filter_pct = 66;       // filter percent
 
 #define TSC 12        /* number of fixed point digits in filter percent */
 
+typedef struct PACKEDATTR {byte r, g, b;} tran_rgb_t;
+
+static void R_GenerateTranMap(const tran_rgb_t *pal, byte *tp)
+{
+  int w1 = (tran_filter_pct << TSC) / 100;
+  int w2 = (1 << TSC) - w1;
+  int total[256];
+
+  for (int i = 0; i < 256; ++i)
+  {
+    int r = pal[i].r;
+    int g = pal[i].g;
+    int b = pal[i].b;
+    total[i] = (r * r + g * g + b * b) << (TSC-1);
+  }
+
+  // Next, compute all entries using minimum arithmetic.
+  for (int i = 0; i < 256; ++i)
+    {
+      int r1 = pal[i].r * w2;
+      int g1 = pal[i].g * w2;
+      int b1 = pal[i].b * w2;
+
+      for (int j = 0; j < 256; j++)
+        {
+          int r = r1 + (pal[j].r * w1);
+          int g = g1 + (pal[j].g * w1);
+          int b = b1 + (pal[j].b * w1);
+          int bc = 0, best = INT_MAX;
+          for (int color = 255; color >= 0; --color)
+            {
+              int err = total[color] - pal[color].r*r - pal[color].g*g - pal[color].b*b;
+              if (err < best)
+                best = err, bc = color;
+            }
+            *tp++ = bc;
+        }
+    }
+}
+
 void R_InitTranMap(int progress)
 {
   int lump;
@@ -459,51 +500,34 @@ void R_InitTranMap(int progress)
   // Compose a default transparent filter map based on PLAYPAL.
   else if ((lump = W_CheckNumForName("PLAYPAL")) != -1)
     {
-      lprintf(LO_INFO, "R_InitTranMap: Gen from PLAYPAL(%d)...\n", lump);
-
-      const struct PACKEDATTR {byte r, g, b;} *pal = W_CacheLumpNum(lump);
+      const tran_rgb_t *pal = W_CacheLumpNum(lump);
       byte *my_tranmap = Z_Malloc(256*256, PU_STATIC, 0);
-      int w1 = (tran_filter_pct << TSC) / 100;
-      int w2 = (1 << TSC) - w1;
-      int total[256];
-
-      for (int i = 0; i < 256; ++i)
-      {
-        int r = pal[i].r;
-        int g = pal[i].g;
-        int b = pal[i].b;
-        total[i] = (r * r + g * g + b * b) << (TSC-1);
-      }
-
-      // Next, compute all entries using minimum arithmetic.
-      byte *tp = my_tranmap;
-      for (int i = 0; i < 256; ++i)
+      void *cache_data = my_tranmap;
+      size_t cache_size = 256*256;
+      char cache_path[RG_PATH_MAX];
+
+      // Generating takes several seconds on the ESP32, so the result is kept in the cache
+      // folder. The key covers everything the map depends on: the palette and filter percent.
+      snprintf(cache_path, sizeof(cache_path), RG_BASE_PATH_CACHE "/doom_tranmap_%08X.bin",
+               (unsigned)rg_crc32(tran_filter_pct, (const uint8_t *)pal, 256 * sizeof(*pal)));
+
+      if (rg_storage_exists(cache_path)
+          && rg_storage_read_file(cache_path, &cache_data, &cache_size, RG_FILE_USER_BUFFER)
+          && cache_size == 256*256)
         {
-          int r1 = pal[i].r * w2;
-          int g1 = pal[i].g * w2;
-          int b1 = pal[i].b * w2;
-
-          for (int j = 0; j < 256; j++)
-            {
-              int r = r1 + (pal[j].r * w1);
-              int g = g1 + (pal[j].g * w1);
-              int b = b1 + (pal[j].b * w1);
-              int bc = 0, best = INT_MAX;
-              for (int color = 255; color >= 0; --color)
-                {
-                  int err = total[color] - pal[color].r*r - pal[color].g*g - pal[color].b*b;
-                  if (err < best)
-                    best = err, bc = color;
-                }
-                *tp++ = bc;
-            }
+          lprintf(LO_INFO, "R_InitTranMap: Loaded from %s\n", cache_path);
+        }
+      else
+        {
+          lprintf(LO_INFO, "R_InitTranMap: Gen from PLAYPAL(%d)...\n", lump);
+          R_GenerateTranMap(pal, my_tranmap);
+          rg_storage_write_file(cache_path, my_tranmap, 256*256, 0);
+          lprintf(LO_INFO, "done.\n");
         }
 
       main_tranmap = my_tranmap;
 
       W_UnlockLumpName("PLAYPAL");
-
-      lprintf(LO_INFO, "done.\n");
     }
 }
 
@@ -602,6 +626,10 @@ int PUREFUNC R_SafeTextureNumForName(const char *name, int snum)
 // Totally rewritten by Lee Killough to use less memory,
 // to avoid using alloca(), and to improve performance.
 // cph - new wad lump handling, calls cache functions but acquires no locks
+//
+// Textures and sprites are drawn from their converted patches, so those are
+// built here rather than just reading the lumps, or the conversion would
+// still happen during play the first time each one is seen.
 
 static inline void precache_lump(int l)
 {
@@ -613,7 +641,8 @@ void R_PrecacheLevel(void)
   if (demoplayback)
     return;
 
-  size_t maxitems = MAX(numtextures, MAX(numflats, numsprites));
+  int start_time = I_GetTimeMS();
+  size_t maxitems = MAX(numtextures, MAX(numflats, numspritelumps));
   byte hitlist[maxitems];
   size_t count = 0;
 
@@ -654,12 +683,9 @@ void R_PrecacheLevel(void)
   for (int i = numtextures; --i >= 0; )
     if (hitlist[i])
       {
-        texture_t *texture = textures[i];
-        for (int j = texture->patchcount; --j >= 0; )
-        {
-          precache_lump(texture->patches[j].patch);
-          count++;
-        }
+        R_CacheTextureCompositePatchNum(i);
+        R_UnlockTextureCompositePatchNum(i);
+        count++;
       }
 
   lprintf(LO_INFO, "R_PrecacheLevel: pre-cached %d textures\n", count);
@@ -669,26 +695,28 @@ void R_PrecacheLevel(void)
   memset(hitlist, 0, maxitems);
   count = 0;
 
+  // Rotations often share a lump, so mark the lumps rather than the sprites
   thinker_t *th = NULL;
   while ((th = P_NextThinker(th,th_all)))
     if (th->function == P_MobjThinker)
-      hitlist[((mobj_t *)th)->sprite] = 1;
+      {
+        spritedef_t *sprite = &sprites[((mobj_t *)th)->sprite];
+        for (int j = sprite->numframes; --j >= 0; )
+          for (int k = 8; --k >= 0; )
+            if (sprite->spriteframes[j].lump[k] >= 0)
+              hitlist[sprite->spriteframes[j].lump[k]] = 1;
+      }
 
-  for (int i = numsprites; --i >= 0; )
+  for (int i = numspritelumps; --i >= 0; )
     if (hitlist[i])
       {
-        for (int j = sprites[i].numframes; --j >= 0; )
-          {
-            short *sflump = sprites[i].spriteframes[j].lump;
-            for (int k = 7; --k >= 0; )
-            {
-              precache_lump(firstspritelump + sflump[k]);
-              count++;
-            }
-          }
+        R_CachePatchNum(firstspritelump + i);
+        R_UnlockPatchNum(firstspritelump + i);
+        count++;
       }
 
   lprintf(LO_INFO, "R_PrecacheLevel: pre-cached %d sprites\n", count);
+  lprintf(LO_INFO, "R_PrecacheLevel: done in %dms\n", I_GetTimeMS() - start_time);
 }
 
 // Proff - Added for OpenGL
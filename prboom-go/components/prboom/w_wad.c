@@ -37,6 +37,13 @@
 #include "config.h"
 #endif
 
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
+#ifdef RETRO_GO
+#include <rg_system.h>
+#endif
+
 #include "doomstat.h"
 #include "d_net.h"
 #include "doomtype.h"
@@ -56,6 +63,15 @@ size_t numwadfiles = 0;
 lumpinfo_t *lumpinfo;
 size_t      numlumps;
 
+// Cached lumps that aren't locked, least recently used first
+static int cache_head = -1, cache_tail = -1;
+static size_t cache_size, cache_limit;
+static unsigned cache_purges; // Z_PurgeCount() when purged lumps were last pruned
+static struct {
+  unsigned hits, misses, evictions;
+  size_t read;
+} cache_stats;
+
 void ExtractFileBase (const char *path, char *dest)
 {
   const char *src = path + strlen(path) - 1;
@@ -135,6 +151,16 @@ static void W_AddFile(wadfile_info_t *wadfile)
     {
       fseek(wadfile->handle, 0, SEEK_END);
       wadfile->size = ftell(wadfile->handle);
+#ifdef HAVE_MMAP
+      // A mapped file is used in place, its lumps never go through the cache
+      void *data = mmap(NULL, wadfile->size, PROT_READ, MAP_SHARED, fileno(wadfile->handle), 0);
+      if (data != MAP_FAILED)
+      {
+        fclose(wadfile->handle);
+        wadfile->handle = NULL;
+        wadfile->data = data;
+      }
+#endif
     }
   }
 
@@ -175,7 +201,9 @@ static void W_AddFile(wadfile_info_t *wadfile)
     lump_p->li_namespace = ns_global;              // killough 4/17/98
     lump_p->locks = 0;
     lump_p->ptr = NULL;
-    memcpy(lump_p->name, fileinfo->name, 8);
+    // Uppercase and zero pad the name, so that lookups can compare it as is
+    for (int j = 0, end = 0; j < 8; j++)
+      lump_p->name[j] = (end = end || !fileinfo->name[j]) ? 0 : toupper((unsigned char)fileinfo->name[j]);
   }
 
   free(lumpindex);
@@ -299,11 +327,17 @@ unsigned W_LumpNameHash(const char *s)
 
 int W_CheckNumForNameNs(register const char *name, register int li_namespace)
 {
+  // Directory names are stored uppercased and zero padded, so converting
+  // the name once makes every comparison along the chain a plain memcmp.
+  char upper[8];
+  for (int j = 0, end = 0; j < 8; j++)
+    upper[j] = (end = end || !name[j]) ? 0 : toupper((unsigned char)name[j]);
+
   // Hash function maps the name to one of possibly numlump chains.
   // It has been tuned so that the average chain length never exceeds 2.
 
   // proff 2001/09/07 - check numlumps==0, this happens when called before WAD loaded
-  register int i = (numlumps==0)?(-1):(lumpinfo[W_LumpNameHash(name) % (unsigned) numlumps].index);
+  register int i = (numlumps==0)?(-1):(lumpinfo[W_LumpNameHash(upper) % (unsigned) numlumps].index);
 
   // We search along the chain until end, looking for case-insensitive
   // matches which also match a namespace tag. Separate hash tables are
@@ -311,7 +345,7 @@ int W_CheckNumForNameNs(register const char *name, register int li_namespace)
   // worth the overhead, considering namespace collisions are rare in
   // Doom wads.
 
-  while (i >= 0 && (strncasecmp(lumpinfo[i].name, name, 8) ||
+  while (i >= 0 && (memcmp(lumpinfo[i].name, upper, 8) ||
                     lumpinfo[i].li_namespace != li_namespace))
     i = lumpinfo[i].next;
 
@@ -385,6 +419,7 @@ void W_Init(void)
   W_CoalesceMarkedResource("C_START", "C_END", ns_colormaps);
 
   W_HashLumps();
+  W_InitCache();
 }
 
 //
@@ -440,6 +475,111 @@ void W_ReadLump(void *dest, int lump)
   }
 }
 
+//
+// Lump cache
+// Unlocked lumps stay in memory as PU_CACHE blocks, the zone can still take
+// them back when it runs out of memory. They are also kept under cache_limit
+// so that they don't crowd out level data in the first place.
+//
+
+static int W_CacheLinked(int lump)
+{
+  return cache_head == lump || lumpinfo[lump].cache_prev >= 0;
+}
+
+static void W_CacheUnlink(int lump)
+{
+  lumpinfo_t *l = &lumpinfo[lump];
+
+  if (l->cache_prev >= 0)
+    lumpinfo[l->cache_prev].cache_next = l->cache_next;
+  else
+    cache_head = l->cache_next;
+  if (l->cache_next >= 0)
+    lumpinfo[l->cache_next].cache_prev = l->cache_prev;
+  else
+    cache_tail = l->cache_prev;
+  l->cache_prev = l->cache_next = -1;
+  cache_size -= l->size;
+}
+
+static void W_CacheLink(int lump)
+{
+  lumpinfo_t *l = &lumpinfo[lump];
+
+  l->cache_prev = cache_tail;
+  l->cache_next = -1;
+  if (cache_tail >= 0)
+    lumpinfo[cache_tail].cache_next = lump;
+  else
+    cache_head = lump;
+  cache_tail = lump;
+  cache_size += l->size;
+}
+
+// Forgets the lumps the zone purged since the last call, so that cache_size
+// only counts lumps that are still in memory
+static void W_CachePrune(void)
+{
+  int lump, next;
+
+  if (cache_purges == Z_PurgeCount())
+    return;
+  cache_purges = Z_PurgeCount();
+
+  for (lump = cache_head; lump >= 0; lump = next)
+  {
+    next = lumpinfo[lump].cache_next;
+    if (!lumpinfo[lump].ptr)
+      W_CacheUnlink(lump);
+  }
+}
+
+// Drops least recently used lumps until the cache fits in limit
+static void W_CacheTrim(size_t limit)
+{
+  W_CachePrune();
+  while (cache_size > limit && cache_head >= 0)
+  {
+    lumpinfo_t *l = &lumpinfo[cache_head];
+    W_CacheUnlink(cache_head);
+    Z_Free(l->ptr);
+    cache_stats.evictions++;
+  }
+}
+
+void W_InitCache(void)
+{
+#ifdef RETRO_GO
+  rg_stats_t stats = rg_system_get_counters();
+  cache_limit = MAX(stats.totalMemoryExt ? stats.totalMemoryExt / 8 : stats.totalMemoryInt / 4, 256 * 1024);
+#else
+  cache_limit = 8 * 1024 * 1024;
+#endif
+
+  for (size_t i = 0; i < numlumps; i++)
+    lumpinfo[i].cache_prev = lumpinfo[i].cache_next = -1;
+  cache_head = cache_tail = -1;
+  cache_size = 0;
+  cache_purges = Z_PurgeCount();
+
+  lprintf(LO_INFO, "W_InitCache: %dKB lump cache\n", (int)(cache_limit / 1024));
+}
+
+void W_DoneCache(void)
+{
+  W_CacheTrim(0);
+}
+
+void W_LogCacheStats(const char *label)
+{
+  W_CachePrune();
+  lprintf(LO_INFO, "W_LogCacheStats: %s: %u lumps read (%dKB), %u hits, %u evicted, %dKB cached\n",
+    label, cache_stats.misses, (int)(cache_stats.read / 1024), cache_stats.hits,
+    cache_stats.evictions, (int)(cache_size / 1024));
+  memset(&cache_stats, 0, sizeof(cache_stats));
+}
+
 //
 // W_CacheLumpNum
 //
@@ -455,12 +595,23 @@ const void *W_CacheLumpNum(int lump)
     // Bypass caching if we have the WAD mapped in memory
     if (l->wadfile && l->wadfile->data)
       return l->wadfile->data + l->position;
-    W_ReadLump(Z_Malloc(W_LumpLength(lump), PU_STATIC, &l->ptr), lump);
+    if (W_CacheLinked(lump)) // Purged by the zone while unlocked
+      W_CacheUnlink(lump);
+    // Allocated in the zone's cache arena, where it will live once unlocked
+    Z_Malloc(W_LumpLength(lump), PU_CACHE, &l->ptr);
+    Z_ChangeTag(l->ptr, PU_STATIC);
+    W_ReadLump(l->ptr, lump);
     l->locks = 0;
+    cache_stats.misses++;
+    cache_stats.read += l->size;
   }
+  else
+    cache_stats.hits++;
 
   if (++l->locks == 1)
   {
+    if (W_CacheLinked(lump))
+      W_CacheUnlink(lump);
     Z_ChangeTag(l->ptr, PU_STATIC);
     l->locks = 1;
   }
@@ -478,5 +629,10 @@ void W_UnlockLumpNum(int lump)
 
   lumpinfo_t *l = &lumpinfo[lump];
   if (l->ptr && l->locks && --l->locks == 0)
+  {
     Z_ChangeTag(l->ptr, PU_CACHE);
+    W_CacheLink(lump);
+    if (cache_size > cache_limit)
+      W_CacheTrim(cache_limit);
+  }
 }
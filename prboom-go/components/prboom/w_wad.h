@@ -75,6 +75,7 @@ typedef struct
   short  li_namespace:5;  // lump namespace
   short  locks:11;        // ptr locks
   short  index, next;     // Index in lumpinfo[]
+  short  cache_prev, cache_next; // Lump cache LRU links, -1 if none
   size_t size;            // lump size
   size_t position;        // position in wadfile
   wadfile_info_t *wadfile;// source file
@@ -101,6 +102,7 @@ void    W_InitCache(void);
 void    W_DoneCache(void);
 const void* W_CacheLumpNum(int lump);
 void    W_UnlockLumpNum(int lump);
+void    W_LogCacheStats(const char *label);
 
 // CPhipps - convenience macros
 #define W_CheckNumForName(name) W_CheckNumForNameNs(name, ns_global)
@@ -56,14 +56,34 @@
 #define CHUNK_SIZE 4        // Minimum chunk size at which blocks are allocated
 #define ZONEID  0x931d4a11  // signature for block header
 
+/* Small blocks are carved out of fixed size slabs, one set of slabs per size
+ * class and per arena. Arenas keep blocks of different lifetimes apart so
+ * that level data doesn't pin down slabs full of long lived static data (and
+ * vice versa), which is what used to fragment the heap between levels.
+ * Larger blocks still come straight from the system heap.
+ */
+#define SLAB_SIZE 4096      // Size of one slab, including its header
+#define SMALL_MAX 512       // Largest block served from slabs
+#define SLAB_CLASSES 10     // Number of size classes up to SMALL_MAX
+
+enum {
+  ARENA_STATIC = 0,
+  ARENA_LEVEL,
+  ARENA_CACHE,
+  ARENA_MAX,
+};
+
+struct memslab;
+
 typedef struct memblock
 {
   uint32_t zoneid;
-  uint32_t tag: 10;
-  uint32_t size:22;
+  uint32_t tag: 4;
+  uint32_t size:28;
 
   struct memblock *next,*prev;
   void **user;
+  struct memslab *slab;       // NULL if the block came from the system heap
 
 #ifdef INSTRUMENTED
   const char *file;
@@ -72,13 +92,74 @@ typedef struct memblock
 
 } memblock_t;
 
+typedef struct memslab
+{
+  struct memslab *next,*prev;
+  memblock_t *free;           // Released blocks, linked through next
+  uint16_t used;              // Blocks currently handed out
+  uint16_t carved;            // Blocks carved so far, the rest is untouched
+  uint16_t capacity;
+  uint16_t stride;
+  uint8_t arena;
+  uint8_t sclass;
+} memslab_t;
+
+typedef struct
+{
+  memslab_t *partial[SLAB_CLASSES];     // Slabs with room left, per size class
+  memslab_t *full[SLAB_CLASSES];
+  size_t live;                // Blocks handed out from this arena
+  size_t slabs;
+} memarena_t;
+
 /* size of block header
  * cph - base on sizeof(memblock_t), which can be larger than CHUNK_SIZE on
  * 64bit architectures */
 static const size_t HEADER_SIZE = (sizeof(memblock_t)+CHUNK_SIZE-1) & ~(CHUNK_SIZE-1);
+static const size_t SLAB_HEADER_SIZE = (sizeof(memslab_t)+7) & ~7;
+
+static const uint16_t zone_classes[SLAB_CLASSES] = {16, 32, 48, 64, 96, 128, 192, 256, 384, 512};
+
+// Size class of a block of size n, indexed by (n - 1) >> 4
+static const uint8_t zone_class_of[SMALL_MAX >> 4] = {
+  0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7,
+  8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9,
+};
+
+static const uint8_t zone_tag_arena[PU_MAX] = {
+  [PU_FREE]    = ARENA_STATIC,
+  [PU_STATIC]  = ARENA_STATIC,
+  [PU_SOUND]   = ARENA_STATIC,
+  [PU_MUSIC]   = ARENA_STATIC,
+  [PU_LEVEL]   = ARENA_LEVEL,
+  [PU_LEVSPEC] = ARENA_LEVEL,
+  [PU_CACHE]   = ARENA_CACHE,
+};
+
+static memarena_t arenas[ARENA_MAX];
 
 static memblock_t *blockbytag[PU_MAX];
 
+/* Level blocks without an owner don't need any attention when they are
+ * purged, so they are kept apart. If they're all that is left in the level
+ * arena, Z_FreeTags drops the arena's slabs without visiting the blocks.
+ */
+static memblock_t *dropbytag[PU_MAX];
+static size_t dropcount[PU_MAX];
+
+/* PU_CACHE blocks always have an owner, but when they are all the cache arena
+ * holds, a full purge only has to clear the owners and can release the slabs
+ * as a whole. cachecount is the number of PU_CACHE blocks in the cache arena.
+ * Blocks allocated as PU_CACHE and then raised to another tag, like locked
+ * lumps, count in live but not in cachecount. A single one of those sends the
+ * purge down the block by block path, on purpose: the arena can't be released
+ * under it.
+ */
+static size_t cachecount;
+
+// Number of Z_FreeTags calls that covered PU_CACHE, see Z_PurgeCount
+static unsigned purges;
+
 #ifdef INSTRUMENTED
 
 // statistics for evaluating performance
@@ -118,14 +199,15 @@ void Z_DumpMemory(void)
   char buf[PATH_MAX + 1];
   FILE* fp;
   size_t total_cache = 0, total_free = 0, total_malloc = 0;
-  int tag;
+  int tag, list;
 
   sprintf(buf, "%s/memdump.%d", HEAPDUMP_DIR, dump++);
   fp = fopen(buf, "w");
   for (tag = PU_FREE; tag < PU_MAX; tag++)
+  for (list = 0; list < 2; list++)
   {
     memblock_t* end_block, *block;
-    block = blockbytag[tag];
+    block = list ? dropbytag[tag] : blockbytag[tag];
     if (!block)
       continue;
     end_block = block->prev;
@@ -166,13 +248,185 @@ void Z_DumpMemory(void)
 #endif
 #endif
 
+static void Z_SlabUnlink(memslab_t *slab, memslab_t **head)
+{
+  if (slab->prev)
+    slab->prev->next = slab->next;
+  else
+    *head = slab->next;
+  if (slab->next)
+    slab->next->prev = slab->prev;
+}
+
+static void Z_SlabPush(memslab_t *slab, memslab_t **head)
+{
+  slab->prev = NULL;
+  slab->next = *head;
+  if (*head)
+    (*head)->prev = slab;
+  *head = slab;
+}
+
+static memblock_t *Z_SlabAlloc(int arena_id, int sclass)
+{
+  memarena_t *arena = &arenas[arena_id];
+  memslab_t *slab = arena->partial[sclass];
+  memblock_t *block;
+
+  if (!slab)
+  {
+    size_t stride = (HEADER_SIZE + zone_classes[sclass] + 7) & ~7;
+
+    if (!(slab = (malloc)(SLAB_SIZE)))
+      return NULL;
+
+    slab->free = NULL;
+    slab->used = 0;
+    slab->carved = 0;
+    slab->capacity = (SLAB_SIZE - SLAB_HEADER_SIZE) / stride;
+    slab->stride = stride;
+    slab->arena = arena_id;
+    slab->sclass = sclass;
+    Z_SlabPush(slab, &arena->partial[sclass]);
+    arena->slabs++;
+  }
+
+  if ((block = slab->free))
+    slab->free = block->next;
+  else
+    block = (memblock_t *)((char *)slab + SLAB_HEADER_SIZE + slab->carved++ * slab->stride);
+
+  if (++slab->used == slab->capacity)
+  {
+    Z_SlabUnlink(slab, &arena->partial[sclass]);
+    Z_SlabPush(slab, &arena->full[sclass]);
+  }
+
+  arena->live++;
+  block->slab = slab;
+  return block;
+}
+
+static void Z_SlabFree(memblock_t *block)
+{
+  memslab_t *slab = block->slab;
+  memarena_t *arena = &arenas[slab->arena];
+
+  block->next = slab->free;
+  slab->free = block;
+  arena->live--;
+
+  if (slab->used-- == slab->capacity)
+  {
+    Z_SlabUnlink(slab, &arena->full[slab->sclass]);
+    Z_SlabPush(slab, &arena->partial[slab->sclass]);
+  }
+
+  // Keep the last slab of a class around, or a single block going back and
+  // forth would allocate and release a slab every time.
+  if (!slab->used && (slab->next || slab->prev))
+  {
+    Z_SlabUnlink(slab, &arena->partial[slab->sclass]);
+    arena->slabs--;
+    (free)(slab);
+  }
+}
+
+// Releases all the slabs of an arena, whatever blocks they still hold
+static void Z_DropArena(memarena_t *arena)
+{
+  int i;
+
+  for (i = 0; i < SLAB_CLASSES; i++)
+  {
+    memslab_t *lists[2] = {arena->partial[i], arena->full[i]};
+    int list;
+
+    for (list = 0; list < 2; list++)
+      while (lists[list])
+      {
+        memslab_t *next = lists[list]->next;
+        (free)(lists[list]);
+        lists[list] = next;
+      }
+    arena->partial[i] = arena->full[i] = NULL;
+  }
+  arena->live = 0;
+  arena->slabs = 0;
+}
+
+static memblock_t *Z_AllocBlock(size_t size, int tag)
+{
+  memblock_t *block;
+
+  if (size <= SMALL_MAX)
+    return Z_SlabAlloc(zone_tag_arena[tag], zone_class_of[(size - 1) >> 4]);
+
+  if ((block = (malloc)(size + HEADER_SIZE)))
+    block->slab = NULL;
+  return block;
+}
+
+static memblock_t **Z_ListHead(memblock_t *block)
+{
+  if (block->slab && block->slab->arena == ARENA_LEVEL && !block->user)
+    return &dropbytag[block->tag];
+  return &blockbytag[block->tag];
+}
+
+static void Z_Link(memblock_t *block)
+{
+  memblock_t **head = Z_ListHead(block);
+
+  if (!*head)
+  {
+    *head = block;
+    block->next = block->prev = block;
+  }
+  else
+  {
+    (*head)->prev->next = block;
+    block->prev = (*head)->prev;
+    block->next = *head;
+    (*head)->prev = block;
+  }
+
+  if (head == &dropbytag[block->tag])
+    dropcount[block->tag]++;
+  else if (block->tag == PU_CACHE && block->slab && block->slab->arena == ARENA_CACHE)
+    cachecount++;
+}
+
+static void Z_Unlink(memblock_t *block)
+{
+  memblock_t **head = Z_ListHead(block);
+
+  if (block == block->next)
+    *head = NULL;
+  else
+    if (*head == block)
+      *head = block->next;
+  block->prev->next = block->next;
+  block->next->prev = block->prev;
+
+  if (head == &dropbytag[block->tag])
+    dropcount[block->tag]--;
+  else if (block->tag == PU_CACHE && block->slab && block->slab->arena == ARENA_CACHE)
+    cachecount--;
+}
+
 void Z_Close(void)
 {
+  int i;
+
 #ifdef INSTRUMENTED
   Z_DumpMemory();
 #endif
   // Release everything
   Z_FreeTags(PU_FREE, PU_MAX);
+
+  for (i = 0; i < ARENA_MAX; i++)
+    Z_DropArena(&arenas[i]);
 }
 
 void Z_Init(void)
@@ -202,8 +456,8 @@ void *(Z_Malloc)(size_t size, int tag, void **user DA(const char *file, int line
 
   size = (size+CHUNK_SIZE-1) & ~(CHUNK_SIZE-1);  // round to chunk size
 
-  while (!(block = (malloc)(size + HEADER_SIZE))) {
-    if (!blockbytag[PU_CACHE])
+  while (!(block = Z_AllocBlock(size, tag))) {
+    if (!blockbytag[PU_CACHE] && !dropbytag[PU_CACHE])
       I_Error ("Z_Malloc: Failure trying to allocate %lu bytes"
 #ifdef INSTRUMENTED
                "\nSource: %s:%d"
@@ -214,20 +468,7 @@ void *(Z_Malloc)(size_t size, int tag, void **user DA(const char *file, int line
 #endif
       );
     // RG: Don't nuke the whole cache at once!
-    (Z_FreeTags)(PU_CACHE, PU_CACHE, 2);
-  }
-
-  if (!blockbytag[tag])
-  {
-    blockbytag[tag] = block;
-    block->next = block->prev = block;
-  }
-  else
-  {
-    blockbytag[tag]->prev->next = block;
-    block->prev = blockbytag[tag]->prev;
-    block->next = blockbytag[tag];
-    blockbytag[tag]->prev = block;
+    (Z_FreeTags)(PU_CACHE, PU_CACHE, 2 DA(file, line));
   }
 
   block->size = size;
@@ -247,6 +488,7 @@ void *(Z_Malloc)(size_t size, int tag, void **user DA(const char *file, int line
   block->zoneid = ZONEID;     // signature required in block header
   block->tag = tag;           // tag
   block->user = user;         // user
+  Z_Link(block);
   block = (memblock_t *)((char *) block + HEADER_SIZE);
   if (user)                   // if there is a user
     *user = block;            // set user to point to new block
@@ -262,7 +504,7 @@ void *(Z_Malloc)(size_t size, int tag, void **user DA(const char *file, int line
 
 void (Z_Free)(void *p DA(const char *file, int line))
 {
-  memblock_t *block = (memblock_t *)((char *) p - HEADER_SIZE);
+  memblock_t *block;
 
 #ifdef INSTRUMENTED
 #ifdef CHECKHEAP
@@ -273,6 +515,8 @@ void (Z_Free)(void *p DA(const char *file, int line))
   if (!p)
     return;
 
+  block = (memblock_t *)((char *) p - HEADER_SIZE);
+
   if (block->zoneid != ZONEID)
     I_Error("Z_Free: freed a pointer without ZONEID"
 #ifdef INSTRUMENTED
@@ -283,17 +527,11 @@ void (Z_Free)(void *p DA(const char *file, int line))
            );
   block->zoneid = 0;          // Nullify id so another free fails
 
+  Z_Unlink(block);
+
   if (block->user)            // Nullify user if one exists
     *block->user = NULL;
 
-  if (block == block->next)
-    blockbytag[block->tag] = NULL;
-  else
-    if (blockbytag[block->tag] == block)
-      blockbytag[block->tag] = block->next;
-  block->prev->next = block->next;
-  block->next->prev = block->prev;
-
 #ifdef INSTRUMENTED
   if (block->tag >= PU_PURGELEVEL)
     purgable_memory -= block->size;
@@ -301,18 +539,66 @@ void (Z_Free)(void *p DA(const char *file, int line))
     active_memory -= block->size;
 
   /* scramble memory -- weed out any bugs */
-  memset(block, gametic & 0xff, block->size + HEADER_SIZE);
+  memset((char *) block + HEADER_SIZE, gametic & 0xff, block->size);
 #endif
 
-  (free)(block);
+  if (block->slab)
+    Z_SlabFree(block);
+  else
+    (free)(block);
 
 #ifdef INSTRUMENTED
       Z_DrawStats();           // print memory allocation stats
 #endif
 }
 
+// Frees up to max blocks from a list (max < 0 means no limit), returns what's left of max
+static int Z_FreeList(memblock_t **head, int max DA(const char *file, int line))
+{
+  while (*head && max)
+  {
+    (Z_Free)((char *) *head + HEADER_SIZE DA(file, line));
+    if (max > 0)
+      max--;
+  }
+  return max;
+}
+
+#ifndef INSTRUMENTED
+// Purges all of PU_CACHE at once if nothing else lives in the cache arena.
+// Each owner still has to be cleared, but the slabs go back to the heap as a
+// whole instead of one block at a time.
+static void Z_DropCache(void)
+{
+  memblock_t *block = blockbytag[PU_CACHE], *next;
+
+  if (!block || cachecount != arenas[ARENA_CACHE].live)
+    return;
+
+  block->prev->next = NULL;
+  for (; block; block = next)
+  {
+    next = block->next;
+    block->zoneid = 0;
+    if (block->user)
+      *block->user = NULL;
+    // Large blocks and blocks retagged from another arena go one by one
+    if (!block->slab)
+      (free)(block);
+    else if (block->slab->arena != ARENA_CACHE)
+      Z_SlabFree(block);
+  }
+
+  blockbytag[PU_CACHE] = NULL;
+  cachecount = 0;
+  Z_DropArena(&arenas[ARENA_CACHE]);
+}
+#endif
+
 void (Z_FreeTags)(int lowtag, int hightag, int max DA(const char *file, int line))
 {
+  int tag;
+
 #ifdef HEAPDUMP
   Z_DumpMemory();
 #endif
@@ -320,32 +606,58 @@ void (Z_FreeTags)(int lowtag, int hightag, int max DA(const char *file, int line
   lowtag = MAX(lowtag, PU_FREE+1);
   hightag = MIN(hightag, PU_MAX-1);
 
-  for (;lowtag <= hightag; hightag--)
+  if (lowtag <= PU_CACHE && hightag >= PU_CACHE)
+    purges++;
+
+#ifndef INSTRUMENTED
+  if (max < 0 && lowtag <= PU_CACHE && hightag >= PU_CACHE)
+    Z_DropCache();
+#endif
+
+  for (tag = hightag; tag >= lowtag; tag--)
+    max = Z_FreeList(&blockbytag[tag], max DA(file, line));
+
+#ifndef INSTRUMENTED
+  // If the unowned level blocks in range are all that's left of the level
+  // arena, there is nothing to do but to release its slabs.
+  if (max < 0)
   {
-    if (!blockbytag[hightag])
-      continue;
-    memblock_t *block = blockbytag[hightag];
-    memblock_t *end_block = block->prev;
-    while (max--)
+    size_t count = 0;
+
+    for (tag = hightag; tag >= lowtag; tag--)
+      count += dropcount[tag];
+
+    if (count && count == arenas[ARENA_LEVEL].live)
     {
-      memblock_t *next = block->next;
-#ifdef INSTRUMENTED
-      (Z_Free)((char *) block + HEADER_SIZE, file, line);
-#else
-      (Z_Free)((char *) block + HEADER_SIZE);
-#endif
-      if (block == end_block)
-        break;
-      block = next;               // Advance to next block
+      for (tag = hightag; tag >= lowtag; tag--)
+      {
+        dropbytag[tag] = NULL;
+        dropcount[tag] = 0;
+      }
+      Z_DropArena(&arenas[ARENA_LEVEL]);
+      return;
     }
   }
+#endif
+
+  for (tag = hightag; tag >= lowtag; tag--)
+    max = Z_FreeList(&dropbytag[tag], max DA(file, line));
+}
+
+unsigned (Z_PurgeCount)(void)
+{
+  return purges;
 }
 
 void (Z_ChangeTag)(void *ptr, int tag DA(const char *file, int line))
 {
-  memblock_t *block = (memblock_t *)((char *) ptr - HEADER_SIZE);
+  memblock_t *block;
+
+  if (!ptr)
+    return;
 
-  if (!ptr || tag == block->tag)
+  block = (memblock_t *)((char *) ptr - HEADER_SIZE);
+  if (tag == block->tag)
     return;
 
 #ifdef INSTRUMENTED
@@ -372,26 +684,7 @@ void (Z_ChangeTag)(void *ptr, int tag DA(const char *file, int line))
 #endif
             );
 
-  if (block == block->next)
-    blockbytag[block->tag] = NULL;
-  else
-    if (blockbytag[block->tag] == block)
-      blockbytag[block->tag] = block->next;
-  block->prev->next = block->next;
-  block->next->prev = block->prev;
-
-  if (!blockbytag[tag])
-  {
-    blockbytag[tag] = block;
-    block->next = block->prev = block;
-  }
-  else
-  {
-    blockbytag[tag]->prev->next = block;
-    block->prev = blockbytag[tag]->prev;
-    block->next = blockbytag[tag];
-    blockbytag[tag]->prev = block;
-  }
+  Z_Unlink(block);
 
 #ifdef INSTRUMENTED
   if (block->tag < PU_PURGELEVEL && tag >= PU_PURGELEVEL)
@@ -408,11 +701,33 @@ void (Z_ChangeTag)(void *ptr, int tag DA(const char *file, int line))
 #endif
 
   block->tag = tag;
+  Z_Link(block);
 }
 
 void *(Z_Realloc)(void *ptr, size_t n, int tag, void **user DA(const char *file, int line))
 {
-  void *p = (Z_Malloc)(n, tag, user DA(file, line));
+  void *p;
+
+  if (ptr && n)
+    {
+      memblock_t *block = (memblock_t *)((char *) ptr - HEADER_SIZE);
+      // Still fits in the same slab block, nothing needs to move
+      if (block->zoneid == ZONEID && block->slab && n <= zone_classes[block->slab->sclass]
+          && tag == block->tag && user == block->user)
+        {
+          size_t size = (n+CHUNK_SIZE-1) & ~(CHUNK_SIZE-1);
+#ifdef INSTRUMENTED
+          if (tag >= PU_PURGELEVEL)
+            purgable_memory += size - block->size;
+          else
+            active_memory += size - block->size;
+#endif
+          block->size = size;
+          return ptr;
+        }
+    }
+
+  p = (Z_Malloc)(n, tag, user DA(file, line));
   if (ptr)
     {
       memblock_t *block = (memblock_t *)((char *) ptr - HEADER_SIZE);
@@ -86,6 +86,7 @@ void *(Z_Malloc)(size_t size, int tag, void **ptr DA(const char *, int));
 void *(Z_Calloc)(size_t n, size_t n2, int tag, void **user DA(const char *, int));
 void *(Z_Realloc)(void *p, size_t n, int tag, void **user DA(const char *, int));
 char *(Z_Strdup)(const char *s, int tag, void **user DA(const char *, int));
+unsigned (Z_PurgeCount)(void); // Changes whenever PU_CACHE blocks may have been purged
 
 #ifdef INSTRUMENTED
 /* cph - save space if not debugging, don't require file
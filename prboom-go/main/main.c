@@ -35,6 +35,8 @@
 #include <m_misc.h>
 #include <r_draw.h>
 #include <r_fps.h>
+#include <r_main.h>
+#include <r_state.h>
 #include <s_sound.h>
 #include <st_stuff.h>
 #include <mus2mid.h>
@@ -50,7 +52,14 @@
 #define AUDIO_BUFFER_LENGTH (AUDIO_SAMPLE_RATE / TICRATE + 1)
 #define NUM_MIX_CHANNELS 8
 
-static rg_surface_t *update;
+static rg_surface_t *screen; // Doom draws into this one (screens[0])
+static rg_surface_t *update; // The last finished frame, owned by the display task
+static bool screen_stale;    // screen still holds the frame before update
+static bool screen_wiping;
+
+extern boolean inhelpscreens;
+extern boolean setsizeneeded;
+
 static rg_app_t *app;
 
 static const char *doom_argv[10];
@@ -137,14 +146,64 @@ void I_UpdateNoBlit(void)
     //
 }
 
+// Bring screen up to date with the frame on display. A level frame repaints the whole view
+// window, so only the border, status bar and messages around it have to be carried over.
+static void I_CatchUpScreen(void)
+{
+    bool view_repainted = gamestate == GS_LEVEL && gamestate == wipegamestate && gametic != basetic
+        && !setsizeneeded && !inhelpscreens && (!(automapmode & am_active) || (automapmode & am_overlay));
+    const byte *src = update->data;
+    byte *dst = screen->data;
+
+    if (!view_repainted)
+    {
+        memcpy(dst, src, SCREENWIDTH * SCREENHEIGHT);
+        return;
+    }
+
+    int top = viewwindowy * SCREENWIDTH;
+    int bottom = (viewwindowy + viewheight) * SCREENWIDTH;
+    int right = viewwindowx + scaledviewwidth;
+
+    memcpy(dst, src, top);
+    memcpy(dst + bottom, src + bottom, SCREENWIDTH * SCREENHEIGHT - bottom);
+    if (scaledviewwidth < SCREENWIDTH)
+    {
+        for (int y = top; y < bottom; y += SCREENWIDTH)
+        {
+            memcpy(dst + y, src + y, viewwindowx);
+            memcpy(dst + y + right, src + y + right, SCREENWIDTH - right);
+        }
+    }
+}
+
 void I_FinishUpdate(void)
 {
-    rg_display_submit(update, 0);
-    rg_display_sync(true); // Wait for update->buffer to be released
+    // The display queue holds a single frame: once this returns, the previous frame is released
+    // and its buffer becomes the one Doom draws into.
+    rg_display_submit(screen, 0);
+
+    rg_surface_t *temp = update;
+    update = screen;
+    screen = temp;
+
+    memcpy(screen->palette, update->palette, 256 * sizeof(uint16_t));
+    screens[0].data = screen->data;
+    R_InitBuffer(scaledviewwidth, viewheight); // drawvars point into screens[0]
+
+    // The melt only redraws the columns that moved, it can't wait for I_StartDisplay
+    if (screen_wiping)
+        memcpy(screen->data, update->data, SCREENWIDTH * SCREENHEIGHT);
+    else
+        screen_stale = true;
 }
 
 bool I_StartDisplay(void)
 {
+    if (screen_stale)
+        I_CatchUpScreen();
+    screen_stale = false;
+    screen_wiping = gamestate != wipegamestate;
     return true;
 }
 
@@ -157,7 +216,7 @@ void I_SetPalette(int pal)
 {
     uint16_t *palette = V_BuildPalette(pal, 16);
     for (int i = 0; i < 256; i++)
-        update->palette[i] = palette[i] << 8 | palette[i] >> 8;
+        screen->palette[i] = palette[i] << 8 | palette[i] >> 8;
     Z_Free(palette);
     current_palette = pal;
 }
@@ -173,7 +232,7 @@ void I_InitGraphics(void)
     }
 
     // Main screen uses internal ram for speed
-    screens[0].data = update->data;
+    screens[0].data = screen->data;
     screens[0].not_on_heap = true;
 
     // statusbar
@@ -508,6 +567,8 @@ static void event_handler(int event, void *arg)
     }
     else if (event == RG_EVENT_REDRAW)
     {
+        rg_display_sync(true);
+        memcpy(update->palette, screen->palette, 256 * sizeof(uint16_t)); // Gamma may have changed
         rg_display_submit(update, 0);
     }
 }
@@ -545,6 +606,7 @@ void app_main()
     SCREENWIDTH = RG_MIN(display->screen.width, MAX_SCREENWIDTH);
     SCREENHEIGHT = RG_MIN(display->screen.height, MAX_SCREENHEIGHT);
 
+    screen = rg_surface_create(SCREENWIDTH, SCREENHEIGHT, RG_PIXEL_PAL565_BE, MEM_FAST);
     update = rg_surface_create(SCREENWIDTH, SCREENHEIGHT, RG_PIXEL_PAL565_BE, MEM_FAST);
 
     const char *iwad = NULL;
@@ -70,6 +70,7 @@ static uint8_t JPEG_Buffer[JPEG_BUFFER_SIZE] __attribute__((aligned(4)));
 
 #define GW_ROM_SIZE_MAX 400000U
 unsigned char *GW_ROM;
+unsigned int GW_ROM_SIZE;
 
 unsigned short *gw_background = NULL;
 unsigned char *gw_segments = NULL;
@@ -130,8 +131,64 @@ keyboard[9] is B   (8 bits lsb)
 */
 // unsigned int gw_keyboard[10];
 
+/* Check the header of the unpacked ROM image in GW_ROM and set up the
+pointers to its objects, they all point straight into GW_ROM */
+static bool gw_romloader_map(unsigned int rom_size)
+{
+   unsigned int rom_size_dest;
+
+   /* Read in the ROM header */
+   memcpy(&gw_head, GW_ROM, sizeof(gw_head));
+
+   /* check size */
+   /*Check if the data size matches. based on the last object in the ROM header (keyboard) */
+   rom_size_dest = gw_head.keyboard + gw_head.keyboard_size;
+
+   if (rom_size != rom_size_dest)
+   {
+      printf("CPU_name=%s\n", gw_head.cpu_name);
+      printf("signature:%s\n", gw_head.rom_signature);
+      printf("ROM ERROR,size=%u,expected=%u\n", rom_size, rom_size_dest);
+      return false;
+   }
+   else
+   {
+      printf("ROM size: OK\n");
+   }
+
+   /* Manage the background */
+
+   // check if there is a uncompressed background inside
+   if (gw_head.background_pixel_size != 0)
+   {
+      printf("RGB565 background\n");
+      gw_background = (unsigned short *)&GW_ROM[gw_head.background_pixel];
+   }
+
+   /* Set up pointers to objects base */
+   gw_segments = (unsigned char *)&GW_ROM[gw_head.segments_pixel];
+
+   gw_segments_x = (unsigned short *)&GW_ROM[gw_head.segments_x];
+   gw_segments_y = (unsigned short *)&GW_ROM[gw_head.segments_y];
+   gw_segments_width = (unsigned short *)&GW_ROM[gw_head.segments_width];
+   gw_segments_height = (unsigned short *)&GW_ROM[gw_head.segments_height];
+   gw_segments_offset = (unsigned int *)&GW_ROM[gw_head.segments_offset];
+
+   gw_program = (unsigned char *)&GW_ROM[gw_head.program];
+
+   if (gw_head.melody_size != 0)
+      gw_melody = (unsigned char *)&GW_ROM[gw_head.melody];
+
+   gw_keyboard = (unsigned int *)&GW_ROM[gw_head.keyboard];
+
+   GW_ROM_SIZE = rom_size;
+
+   return true;
+}
+
 bool gw_romloader_rom2ram()
 {
+   free(GW_ROM);
    GW_ROM = malloc(GW_ROM_SIZE_MAX);
 
    /* src pointer to the ROM data in the external flash (raw or LZ4) */
@@ -140,9 +197,8 @@ bool gw_romloader_rom2ram()
    /* dest pointer to the ROM data in the internal RAM (raw) */
    unsigned char *dest = (unsigned char *)GW_ROM;
 
-   /* variable used to compare the size to detect error, uncompressed  */
+   /* uncompressed size, checked against the header by gw_romloader_map() */
    unsigned int rom_size_src  = ROM_DATA_LENGTH;
-   unsigned int rom_size_dest = ROM_DATA_LENGTH;
 
    /* 1st part on FLASH before JPEG */
    unsigned int rom_size_compressed_src  = ROM_DATA_LENGTH;
@@ -242,38 +298,14 @@ bool gw_romloader_rom2ram()
       return false;
    }
 
-   /* Read in the ROM header */
-   memcpy(&gw_head, dest, sizeof(gw_head));
-
-   /* check size */
-   /*Check if the data size matches. based on the last object in the ROM header (keyboard) */
-   rom_size_dest = gw_head.keyboard + gw_head.keyboard_size;
-
-   if (rom_size_src != rom_size_dest)
-   {
-      printf("CPU_name=%s\n", gw_head.cpu_name);
-      printf("signature:%s\n", gw_head.rom_signature);
-      printf("ROM ERROR,size=%u,expected=%u\n", rom_size_src, rom_size_dest);
+   if (!gw_romloader_map(rom_size_src))
       return false;
-   }
-   else
-   {
-      printf("ROM size: OK\n");
-   }
 
-   /* Manage the background */
+   (void)rom_size_compressed_src; // unused without JPEG
 
-   // check if there is a uncompressed background inside
-   if (gw_head.background_pixel_size != 0)
-   {
-      printf("RGB565 background\n");
-      gw_background = (unsigned short *)&GW_ROM[gw_head.background_pixel];
-
-      (void)rom_size_compressed_src; // unused
-   }
 #ifdef GW_JPEG_SUPPORT
    // otherwise we get the background from JPEG file
-   else if((rom_size_compressed_src+8) != ROM_DATA_LENGTH)
+   if (gw_background == NULL && (rom_size_compressed_src+8) != ROM_DATA_LENGTH)
    {
       printf("JPEG background?\n");
 
@@ -309,22 +341,6 @@ bool gw_romloader_rom2ram()
       gw_background = (unsigned short *)(FrameDst);
    }
 #endif
-   /* Set up pointers to objects base */
-   gw_segments = (unsigned char *)&GW_ROM[gw_head.segments_pixel];
-
-   gw_segments_x = (unsigned short *)&GW_ROM[gw_head.segments_x];
-   gw_segments_y = (unsigned short *)&GW_ROM[gw_head.segments_y];
-   gw_segments_width = (unsigned short *)&GW_ROM[gw_head.segments_width];
-   gw_segments_height = (unsigned short *)&GW_ROM[gw_head.segments_height];
-   gw_segments_offset = (unsigned int *)&GW_ROM[gw_head.segments_offset];
-
-   gw_program = (unsigned char *)&GW_ROM[gw_head.program];
-
-   if (gw_head.melody_size != 0)
-      gw_melody = (unsigned char *)&GW_ROM[gw_head.melody];
-
-   gw_keyboard = (unsigned int *)&GW_ROM[gw_head.keyboard];
-
    return true;
 }
 
@@ -340,4 +356,19 @@ bool gw_romloader()
       assert(false);
 
    return rom_status;
+}
+
+/* Use an already unpacked ROM image (GW_ROM_SIZE bytes of GW_ROM from a previous
+load), typically kept in a cache file. The buffer is owned by the loader after that */
+bool gw_romloader_unpacked(unsigned char *rom, unsigned int size)
+{
+   printf("gw_romloader_unpacked\n");
+
+   if (size < sizeof(gw_head) || memcmp(rom, ROM_CPU_SM510, 3) != 0)
+      return false;
+
+   free(GW_ROM);
+   GW_ROM = rom;
+
+   return gw_romloader_map(size);
 }
\ No newline at end of file
@@ -65,6 +65,7 @@ __license__ = "GPLv3"
 /* ADD ROM SUPPORT */
 /* Large memory to store all objects from external flash */
 extern unsigned char *GW_ROM;
+extern unsigned int GW_ROM_SIZE;
 
 /* ROM in RAM : objects pointers */
 extern unsigned char  *gw_rom_base;
@@ -147,5 +148,6 @@ typedef struct gwromheader_s
 extern gwromheader_t gw_head;
 
 bool gw_romloader();
+bool gw_romloader_unpacked(unsigned char *rom, unsigned int size);
 
 #endif /* _GW_ROMLOADER_H_ */
@@ -341,6 +341,89 @@ bool CSusie::ContextLoad(LSS_FILE *fp)
    return 1;
 }
 
+//
+// Fast path for the common sprites that are unscaled and don't collide. The
+// line is decoded a packet at a time and written straight to video RAM, with
+// packed runs turned into byte fills. Pen 0 is transparent unless opaque is
+// set. Behaves exactly like the generic pixel loop when SPRHSIZ is 0x100, it
+// returns TRUE if any pixel landed on screen.
+//
+bool CSusie::PaintLineFast(int hoff,int hsign,bool opaque)
+{
+   bool onscreen=FALSE;
+   bool offscreen=FALSE;
+   ULONG tmp,count,pixel=0;
+
+   for(;;) {
+      bool literal=TRUE;
+
+      // Fetch the next packet
+      if(mLineType==line_abs_literal) {
+         if(!mLineRepeatCount) break;
+         count=mLineRepeatCount;
+         mLineRepeatCount=0;
+      } else {
+         MY_GET_BITS(tmp,1)
+         mLineType=tmp?line_literal:line_packed;
+         literal=tmp;
+         MY_GET_BITS(count,4)
+         if(!literal) {
+            if(!count) break;
+            MY_GET_BITS(tmp,mSPRCTL0_PixelBits)
+            pixel=mPenIndex[tmp];
+         }
+         count++;
+      }
+
+      if(literal) {
+         // Literal pixels still have to be read one by one, even if they
+         // end up off screen
+         while(count--) {
+            MY_GET_BITS(tmp,mSPRCTL0_PixelBits)
+            // Check the special case of a zero in the last pixel
+            if(mLineType==line_abs_literal && !count && !tmp) return onscreen;
+            if(offscreen) continue;
+            pixel=mPenIndex[tmp];
+            if(hoff>=0 && hoff<HANDY_SCREEN_WIDTH) {
+               if(opaque || pixel) WritePixel(hoff,pixel);
+               onscreen=TRUE;
+            } else if(onscreen) {
+               offscreen=TRUE;
+               continue;
+            }
+            hoff+=hsign;
+         }
+      } else if(!offscreen) {
+         // Skip the part of the run before the screen edge
+         int skip=(hsign==1)?-hoff:hoff-(HANDY_SCREEN_WIDTH-1);
+         if(skip>0) {
+            if(skip>=(int)count) {
+               hoff+=hsign*(int)count;
+               continue;
+            }
+            hoff+=hsign*skip;
+            count-=skip;
+         }
+         // Then the visible part
+         int visible=(hsign==1)?HANDY_SCREEN_WIDTH-hoff:hoff+1;
+         if(visible>(int)count) visible=count;
+         if(visible>0) {
+            if(opaque || pixel) WritePixels((hsign==1)?hoff:hoff-visible+1,visible,pixel);
+            onscreen=TRUE;
+            hoff+=hsign*visible;
+            count-=visible;
+         }
+         // And whatever goes past the other edge
+         if(count) {
+            if(onscreen) offscreen=TRUE;
+            else hoff+=hsign*(int)count;
+         }
+      }
+   }
+
+   return onscreen;
+}
+
 ULONG CSusie::PaintSprites(void)
 {
    int	sprcount=0;
@@ -552,6 +635,29 @@ ULONG CSusie::PaintSprites(void)
          TRACE_SUSIE2("PaintSprites() screen_v_start $%04x screen_v_end $%04x",screen_v_start,screen_v_end);
          TRACE_SUSIE2("PaintSprites() world_h_mid    $%04x world_v_mid  $%04x",world_h_mid,world_v_mid);
 
+         // Sprites that only write video RAM can use PaintLineFast(), 1 when
+         // pen 0 is transparent and 2 when it is drawn
+         int fastline=0;
+         bool collide=!mSPRCOLL_Collide && !mSPRSYS_NoCollide;
+
+         switch(mSPRCTL0_Type) {
+            case sprite_background_shadow:
+               if(!collide) fastline=2;
+               break;
+            case sprite_background_noncollide:
+               fastline=2;
+               break;
+            case sprite_normal:
+            case sprite_shadow:
+               if(!collide) fastline=1;
+               break;
+            case sprite_noncollide:
+               fastline=1;
+               break;
+            default:
+               break;
+         }
+
          bool superclip=FALSE;
          int quadrant=0;
          int hsign,vsign;
@@ -742,7 +848,11 @@ ULONG CSusie::PaintSprites(void)
                         onscreen=FALSE;
 
                         ULONG pixel = mLinePixel; // Much faster
-                        switch(mSPRCTL0_Type)
+                        if(fastline && mSPRHSIZ.Word==0x100 && (hsign==-1 || !mHSIZOFF.Byte.High))
+                        {
+                           if(PaintLineFast(hoff,hsign,fastline==2)) everonscreen=TRUE;
+                        }
+                        else switch(mSPRCTL0_Type)
                         {
                               case sprite_background_shadow:
                                  #undef PROCESS_PIXEL
@@ -380,6 +380,8 @@ class CSusie : public CLynxBase
       ULONG	PaintSprites(void);
 
    private:
+      bool	PaintLineFast(int hoff,int hsign,bool opaque);
+
       inline ULONG LineInit(ULONG voff) {
          //   TRACE_SUSIE0("LineInit()");
          mLineShiftReg=0;
@@ -451,6 +453,22 @@ class CSusie : public CLynxBase
       mCycles+=2*SPR_RDWR_CYC;
    }
 
+   inline void WritePixels(int hoff,int count,ULONG pixel) {
+      // Same as count calls to WritePixel() going right from hoff, but
+      // whole bytes are filled at once
+      if(hoff&0x01) {
+         WritePixel(hoff++,pixel);
+         count--;
+      }
+      if(count>1) {
+         memset(&mRamPointer[mLineBaseAddress+(hoff>>1)],pixel*0x11,count>>1);
+         mCycles+=(count&~1)*2*SPR_RDWR_CYC;
+      }
+      if(count&0x01) {
+         WritePixel(hoff+count-1,pixel);
+      }
+   }
+
    inline ULONG ReadPixel(ULONG hoff) {
       UBYTE data=RAM_PEEK(mLineBaseAddress+(hoff>>1));
 
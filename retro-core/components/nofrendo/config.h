@@ -7,6 +7,18 @@
 /* Uncomment to enable live dissassembler */
 // #define NES6502_DISASM
 
+/* Dispatch 6502 opcodes with computed gotos instead of a switch. It is
+   slightly faster on hosts but the bigger nes6502_execute must fit in IRAM
+   on the ESP32, so there it's left to the switch unless enabled here. */
+#ifdef RG_TARGET_SDL2
+#define NES6502_JUMPTABLE
+#endif
+
+/* Uncomment to run PRG code from pre-decoded basic blocks. On x86-64 it is
+   5-10% slower than plain dispatch (tests/nes6502_bench.c), it may still
+   pay off where PRG-ROM sits in slow external RAM. Costs ~19KB of heap. */
+// #define NES6502_BLOCKCACHE
+
 /* Uncomment to save/load a game's SRAM to disk */
 // #define USE_SRAM_FILE
 
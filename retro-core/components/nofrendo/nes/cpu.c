@@ -26,7 +26,6 @@
 /* internal CPU context */
 static nes6502_t cpu;
 
-// #define NES6502_JUMPTABLE
 #define NES6502_FASTMEM
 
 
@@ -53,13 +52,14 @@ static nes6502_t cpu;
 /* Immediate */
 #define IMMEDIATE_BYTE(value) \
 { \
-   value = fast_readbyte(PC++); \
+   value = OPERAND_BYTE(); \
+   PC++; \
 }
 
 /* Absolute */
 #define ABSOLUTE_ADDR(address) \
 { \
-   address = fast_readword(PC); \
+   address = OPERAND_WORD(); \
    PC += 2; \
 }
 
@@ -614,7 +614,7 @@ static nes6502_t cpu;
 
 #define JMP_INDIRECT() \
 { \
-   temp = fast_readword(PC); \
+   temp = OPERAND_WORD(); \
    /* bug in crossing page boundaries */ \
    if (0xFF == (temp & 0xFF)) \
       PC = (readbyte(temp & 0xFF00) << 8) | readbyte(temp); \
@@ -625,16 +625,17 @@ static nes6502_t cpu;
 
 #define JMP_ABSOLUTE() \
 { \
-   JUMP(PC); \
+   PC = OPERAND_WORD(); \
    ADD_CYCLES(3); \
 }
 
 #define JSR() \
 { \
+   temp = OPERAND_WORD(); \
    PC++; \
    PUSH(PC >> 8); \
    PUSH(PC & 0xFF); \
-   JUMP(PC - 1); \
+   PC = temp; \
    ADD_CYCLES(6); \
 }
 
@@ -1062,17 +1063,73 @@ static nes6502_t cpu;
 
 #define fast_readbyte(a) ({uint16 _a = (a); cpu.pages[_a >> MEM_PAGESHIFT][_a];})
 #define fast_readword(a) ({uint16 _a = (a); ((_a & MEM_PAGEMASK) != MEM_PAGEMASK) ? PAGE_READWORD(cpu.pages[_a >> MEM_PAGESHIFT], _a) : mem_getword(_a);})
-#define writebyte(a, v)  {uint16 _a = (a), _v = (v); if (_a < 0x2000) cpu.pages[0][_a & 0x7FF] = _v; else mem_putbyte(_a, _v);}
+#define writebyte(a, v)  {uint16 _a = (a), _v = (v); if (_a < 0x2000) cpu.pages[0][_a & 0x7FF] = _v; else { mem_putbyte(_a, _v); BLOCK_WRITE(_a); }}
 
 #else /* !NES6502_FASTMEM */
 
 #define fast_readbyte(a) mem_getbyte(a)
 #define fast_readword(a) mem_getword(a)
-#define writebyte(a, v) mem_putbyte(a, v)
+#define writebyte(a, v) {uint16 _a = (a); mem_putbyte(_a, v); BLOCK_WRITE(_a);}
 
 #endif /* !NES6502_FASTMEM */
 
 
+/*
+** Pre-decoded basic blocks
+**
+** Straight-line code at $6000 and up is decoded once into an array of
+** opcode/operand pairs, so dispatch doesn't go through cpu.pages for every
+** byte. A block stops at the first instruction that can change PC or the
+** interrupt state, and never crosses a 2KB page. Blocks are tagged with
+** their page's generation, bumped by nes6502_invalidate() when mem_setpage
+** maps another bank or when PRG-RAM is written. A write above $401F ends
+** the running block so that the next fetch re-validates its tag.
+*/
+
+#ifdef NES6502_BLOCKCACHE
+
+#define BLOCK_COUNT     256   /* Must be a power of two */
+#define BLOCK_MAX_OPS   16
+#define BLOCK_MIN_PC    0x6000
+
+#define OPERAND_BYTE() ((uint8) operand)
+#define OPERAND_WORD() (operand)
+
+#define BLOCK_WRITE(a) \
+{ \
+   if ((a) >= 0x4020) \
+      op_end = op; \
+}
+
+#define FETCH_OPCODE() ({ \
+   uint8 _op; \
+   if (op == op_end) \
+      op = block_fetch(PC, &op_end); \
+   if (op) \
+   { \
+      _op = op->opcode; \
+      operand = op->operand; \
+      op++; \
+   } \
+   else \
+   { \
+      _op = fast_readbyte(PC); \
+      operand = fast_readbyte(PC + 1) | (fast_readbyte(PC + 2) << 8); \
+   } \
+   PC++; \
+   _op; \
+})
+
+#else /* !NES6502_BLOCKCACHE */
+
+#define OPERAND_BYTE() fast_readbyte(PC)
+#define OPERAND_WORD() fast_readword(PC)
+#define BLOCK_WRITE(a)
+#define FETCH_OPCODE() fast_readbyte(PC++)
+
+#endif /* !NES6502_BLOCKCACHE */
+
+
 #ifdef NES6502_DISASM
 #define DISASSEMBLE MESSAGE_INFO(nes6502_disasm(PC, COMBINE_FLAGS(), A, X, Y, S));
 #else
@@ -1086,19 +1143,138 @@ static nes6502_t cpu;
 #define OPCODE_NEXT \
    if (remaining_cycles <= 0) break; \
    DISASSEMBLE; \
-   goto *opcode_table[fast_readbyte(PC++)];
+   goto *opcode_table[FETCH_OPCODE()];
 
 #else /* !NES6502_JUMPTABLE */
 
 #define OPCODE(xx, x...)  case xx: x; break;
 #define OPCODE_NEXT \
    DISASSEMBLE;  \
-   switch (fast_readbyte(PC++))
+   switch (FETCH_OPCODE())
 
 #endif /* !NES6502_JUMPTABLE */
 
 /* End of macros */
 
+#ifdef NES6502_BLOCKCACHE
+
+typedef struct
+{
+   uint8 opcode;
+   uint16 operand;
+} block_op_t;
+
+typedef struct
+{
+   uint32 pc;
+   uint32 gen;
+   uint32 count;
+   block_op_t ops[BLOCK_MAX_OPS];
+} block_t;
+
+/* Instruction length, and 0x80 if it ends a basic block */
+static const uint8 block_opinfo[256] =
+{
+   0x82, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03,
+   0x82, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03,
+   0x83, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03,
+   0x82, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03,
+   0x81, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x83, 0x03, 0x03, 0x03,
+   0x82, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x81, 0x03, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03,
+   0x81, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x83, 0x03, 0x03, 0x03,
+   0x82, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03,
+   0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03,
+   0x82, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03,
+   0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03,
+   0x82, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03,
+   0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03,
+   0x82, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03,
+   0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03,
+   0x82, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03,
+};
+
+static block_t *blocks;
+static uint32 block_gen[MEM_PAGECOUNT];
+
+/* Decode the block starting at pc, which must be at or above BLOCK_MIN_PC */
+IRAM_ATTR static block_t *block_decode(block_t *block, uint32 pc)
+{
+   const uint8 *page = cpu.pages[pc >> MEM_PAGESHIFT];
+   uint32 end = (pc | MEM_PAGEMASK) + 1;
+   uint32 count = 0;
+
+   block->pc = pc;
+   block->gen = block_gen[pc >> MEM_PAGESHIFT];
+
+   while (count < BLOCK_MAX_OPS)
+   {
+      uint8 opcode = page[pc];
+      uint8 info = block_opinfo[opcode];
+      uint8 length = info & 0x7F;
+
+      if (pc + length > end)
+         break;
+
+      block->ops[count].opcode = opcode;
+      block->ops[count].operand = (length > 1 ? page[pc + 1] : 0) | (length > 2 ? page[pc + 2] << 8 : 0);
+      count++;
+      pc += length;
+
+      if (info & 0x80)
+         break;
+   }
+
+   block->count = count;
+
+   /* First instruction straddles the page, leave it to the interpreter */
+   if (count == 0)
+   {
+      block->pc = 0;
+      return NULL;
+   }
+
+   return block;
+}
+
+/* Look up or decode the block at pc, NULL if it has to be interpreted */
+static inline const block_op_t *block_fetch(uint32 pc, const block_op_t **end)
+{
+   block_t *block = &blocks[(pc ^ (pc >> 7)) & (BLOCK_COUNT - 1)];
+
+   *end = NULL;
+
+   if (pc < BLOCK_MIN_PC)
+      return NULL;
+
+   if (block->pc != pc || block->gen != block_gen[pc >> MEM_PAGESHIFT])
+   {
+      if (!block_decode(block, pc))
+         return NULL;
+   }
+
+   *end = block->ops + block->count;
+
+   return block->ops;
+}
+
+#endif /* NES6502_BLOCKCACHE */
+
+/* Drop the pre-decoded code of a 2KB page, or of all pages if page < 0 */
+void nes6502_invalidate(int page)
+{
+#ifdef NES6502_BLOCKCACHE
+   if (page < 0)
+   {
+      for (int i = 0; i < MEM_PAGECOUNT; i++)
+         block_gen[i]++;
+   }
+   else if (page < MEM_PAGECOUNT)
+   {
+      block_gen[page]++;
+   }
+#endif
+}
+
 
 /* set the current context */
 void nes6502_setcontext(const nes6502_t *src)
@@ -1129,12 +1305,17 @@ IRAM_ATTR int nes6502_execute(int cycles)
    uint8 btemp, baddr; /* for macros */
    uint8 data;
 
+#ifdef NES6502_BLOCKCACHE
+   const block_op_t *op = NULL, *op_end = NULL;
+   uint32 operand;
+#endif
+
    DECLARE_LOCAL_REGS();
    GET_GLOBAL_REGS();
 
 #ifdef NES6502_JUMPTABLE
 
-   static const void *opcode_table[256] =
+   static const void *const opcode_table[256] =
    {
       &&op0x00, &&op0x01, &&op0x02, &&op0x03, &&op0x04, &&op0x05, &&op0x06, &&op0x07,
       &&op0x08, &&op0x09, &&op0x0A, &&op0x0B, &&op0x0C, &&op0x0D, &&op0x0E, &&op0x0F,
@@ -1528,6 +1709,7 @@ void nes6502_reset(void)
    cpu.int_pending = false;               /* No pending interrupts */
    cpu.jammed = false;
    cpu.burn_cycles = RESET_CYCLES;
+   nes6502_invalidate(-1);
 }
 
 /* Create a nes6502 object */
@@ -1536,11 +1718,19 @@ nes6502_t *nes6502_init(uint8 **memmap)
    memset(&cpu, 0, sizeof(nes6502_t));
    cpu.pages = memmap;
 
+#ifdef NES6502_BLOCKCACHE
+   if (!blocks && !(blocks = calloc(BLOCK_COUNT, sizeof(block_t))))
+      return NULL;
+#endif
+
    return &cpu;
 }
 
 /* Destroy a nes6502 object */
 void nes6502_shutdown(void)
 {
-   //
+#ifdef NES6502_BLOCKCACHE
+   free(blocks);
+   blocks = NULL;
+#endif
 }
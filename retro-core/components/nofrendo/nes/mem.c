@@ -61,6 +61,8 @@ void mem_setpage(uint32 page, uint8 *ptr)
       return;
    }
 
+   nes6502_invalidate(page);
+
    if (ptr == MEM_PAGE_NOT_MAPPED)
    {
       mem.pages[page] = mem.dummy - (page * MEM_PAGESIZE);
@@ -133,6 +135,9 @@ void mem_putbyte(uint32 address, uint8 value)
    if (flags & MEM_PAGE_HAS_MEMORY)
    {
       mem.pages[address >> MEM_PAGESHIFT][address] = value;
+#ifdef NES6502_BLOCKCACHE
+      nes6502_invalidate(address >> MEM_PAGESHIFT);
+#endif
       return;
    }
 
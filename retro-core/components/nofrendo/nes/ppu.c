@@ -81,6 +81,10 @@ void ppu_setpage(uint32 page, uint8 *location)
       MESSAGE_ERROR("Invalid PPU page #%d!\n", (int)page);
       return;
    }
+   /* Pattern page now points to different data, its decoded tiles are stale */
+   if (page < 8 && ppu.page[page] != location - (page << PPU_PAGESHIFT))
+      ppu.patcache_valid[page] = 0;
+
    ppu.page[page] = location - (page << PPU_PAGESHIFT);
 
    /* Setup mirror if required (8-11 <=> 12-15) */
@@ -100,6 +104,27 @@ uint8 *ppu_getpage(uint32 page)
    return ppu.page[page] + (page << PPU_PAGESHIFT);
 }
 
+/* Must be called when CHR data is modified other than through ppu_write (eg state load) */
+void ppu_invalidatechr(void)
+{
+   memset(ppu.patcache_valid, 0, sizeof(ppu.patcache_valid));
+}
+
+INLINE void ppu_writechr(uint32 addr, uint8 value)
+{
+   const uint8 *location = ppu.page[addr >> PPU_PAGESHIFT] + (addr & ~PPU_PAGEMASK);
+   uint64 tile_mask = 1ULL << ((addr >> 4) & 63);
+
+   /* The same bank can be mapped in more than one page */
+   for (int page = 0; page < 8; page++)
+   {
+      if (ppu.page[page] + (page << PPU_PAGESHIFT) == location)
+         ppu.patcache_valid[page] &= ~tile_mask;
+   }
+
+   PPU_MEM_WRITE(addr, value);
+}
+
 void ppu_setnametable(uint8 index, uint8 table)
 {
    index &= 3;
@@ -295,7 +320,10 @@ void ppu_write(uint32 address, uint8 value)
          {
             MESSAGE_DEBUG("VRAM write to $%04X, scanline %d\n",
                            ppu.vaddr, nes_getptr()->scanline);
-            PPU_MEM_WRITE(ppu.vaddr, 0xFF); /* corrupt */
+            if (ppu.vaddr < 0x2000)
+               ppu_writechr(ppu.vaddr, 0xFF); /* corrupt */
+            else
+               PPU_MEM_WRITE(ppu.vaddr, 0xFF); /* corrupt */
          }
          else
          {
@@ -304,7 +332,10 @@ void ppu_write(uint32 address, uint8 value)
             if (false == ppu.vram_present && addr >= 0x3000)
                ppu.vaddr -= 0x1000;
 
-            PPU_MEM_WRITE(addr, value);
+            if (addr < 0x2000)
+               ppu_writechr(addr, value);
+            else
+               PPU_MEM_WRITE(addr, value);
          }
       }
       else
@@ -357,59 +388,59 @@ void ppu_setvreadfunc(ppu_vreadfunc_t func)
 }
 
 /* rendering routines */
-INLINE uint32 get_patpix(uint32 tile_addr)
+static void decode_tile(uint32 tile_addr)
 {
-   uint32 pat1 = PPU_MEM_READ(tile_addr);
-   uint32 pat2 = PPU_MEM_READ(tile_addr + 8);
-   return ((pat2 & 0xAA) << 8) | ((pat2 & 0x55) << 1)
-        | ((pat1 & 0xAA) << 7) | ((pat1 & 0x55) << 0);
-}
+   uint32 page = tile_addr >> PPU_PAGESHIFT;
+   uint32 tile = (tile_addr >> 4) & 63;
+   uint8 (*rows)[2][8] = ppu.patcache[tile_addr >> 4];
 
-INLINE void build_tile_colors(bool flip, uint32 pattern, uint8 *colors)
-{
-   /* swap pixels around if our tile is flipped */
-   if (flip)
-   {
-      colors[7] = (pattern >> 14) & 3;
-      colors[6] = (pattern >> 6) & 3;
-      colors[5] = (pattern >> 12) & 3;
-      colors[4] = (pattern >> 4) & 3;
-      colors[3] = (pattern >> 10) & 3;
-      colors[2] = (pattern >> 2) & 3;
-      colors[1] = (pattern >> 8) & 3;
-      colors[0] = pattern & 3;
-   }
-   else
+   tile_addr &= ~0xF;
+
+   for (int y = 0; y < 8; y++)
    {
-      colors[0] = (pattern >> 14) & 3;
-      colors[1] = (pattern >> 6) & 3;
-      colors[2] = (pattern >> 12) & 3;
-      colors[3] = (pattern >> 4) & 3;
-      colors[4] = (pattern >> 10) & 3;
-      colors[5] = (pattern >> 2) & 3;
-      colors[6] = (pattern >> 8) & 3;
-      colors[7] = pattern & 3;
+      uint32 pat1 = PPU_MEM_READ(tile_addr + y);
+      uint32 pat2 = PPU_MEM_READ(tile_addr + y + 8);
+
+      for (int x = 0; x < 8; x++)
+      {
+         uint8 color = ((pat1 >> (7 - x)) & 1) | (((pat2 >> (7 - x)) & 1) << 1);
+         rows[y][0][x] = color;
+         rows[y][1][7 - x] = color;
+      }
    }
+
+   ppu.patcache_valid[page] |= 1ULL << tile;
+}
+
+/* Returns the 8 pixels (0-3) of a tile row, pre-flipped if requested */
+INLINE const uint8 *get_patrow(uint32 tile_addr, bool flip)
+{
+   if (!(ppu.patcache_valid[tile_addr >> PPU_PAGESHIFT] & (1ULL << ((tile_addr >> 4) & 63))))
+      decode_tile(tile_addr);
+   return ppu.patcache[tile_addr >> 4][tile_addr & 7][flip ? 1 : 0];
+}
+
+INLINE bool patrow_empty(const uint8 *row)
+{
+   uint64 bits;
+   memcpy(&bits, row, sizeof(bits));
+   return bits == 0;
 }
 
 /* we render a scanline of graphics first so we know exactly
 ** where the sprite 0 strike is going to occur (in terms of
 ** cpu cycles), using the relation that 3 pixels == 1 cpu cycle
 */
-INLINE void check_strike(uint8 *surface, uint8 attrib, uint32 pattern)
+INLINE void check_strike(uint8 *surface, const uint8 *colors)
 {
-   uint8 colors[8];
-
    /* Flag already set */
    if (ppu.strikeflag)
       return;
 
    /* sprite is 100% transparent */
-   if (0 == pattern)
+   if (patrow_empty(colors))
       return;
 
-   build_tile_colors(attrib & OAMF_HFLIP, pattern, colors);
-
    for (int i = 0; i < 8; i++)
    {
       if (colors[i] && (!surface || BG_SOLID(surface[i])))
@@ -422,28 +453,24 @@ INLINE void check_strike(uint8 *surface, uint8 attrib, uint32 pattern)
    }
 }
 
-INLINE void draw_bgtile(uint8 *surface, uint32 pattern, const uint8 *colors)
+INLINE void draw_bgtile(uint8 *surface, const uint8 *row, const uint8 *colors)
 {
-   *surface++ = colors[(pattern >> 14) & 3];
-   *surface++ = colors[(pattern >> 6) & 3];
-   *surface++ = colors[(pattern >> 12) & 3];
-   *surface++ = colors[(pattern >> 4) & 3];
-   *surface++ = colors[(pattern >> 10) & 3];
-   *surface++ = colors[(pattern >> 2) & 3];
-   *surface++ = colors[(pattern >> 8) & 3];
-   *surface   = colors[pattern & 3];
+   surface[0] = colors[row[0]];
+   surface[1] = colors[row[1]];
+   surface[2] = colors[row[2]];
+   surface[3] = colors[row[3]];
+   surface[4] = colors[row[4]];
+   surface[5] = colors[row[5]];
+   surface[6] = colors[row[6]];
+   surface[7] = colors[row[7]];
 }
 
-INLINE void draw_oamtile(uint8 *surface, uint8 attrib, uint32 pattern, const uint8 *col_tbl)
+INLINE void draw_oamtile(uint8 *surface, uint8 attrib, const uint8 *colors, const uint8 *col_tbl)
 {
-   uint8 colors[8];
-
    /* sprite is 100% transparent */
-   if (0 == pattern)
+   if (patrow_empty(colors))
       return;
 
-   build_tile_colors(attrib & OAMF_HFLIP, pattern, colors);
-
    /* draw the character */
    if (attrib & OAMF_BEHIND)
    {
@@ -499,7 +526,7 @@ INLINE void ppu_renderbg(uint8 *vidbuf)
          ppu.latchfunc(ppu.bg_base, tile_index);
 
       /* Fetch tile and draw it */
-      draw_bgtile(bmp_ptr, get_patpix(bg_offset + (tile_index << 4)), ppu.palette + col_high);
+      draw_bgtile(bmp_ptr, get_patrow(bg_offset + (tile_index << 4), false), ppu.palette + col_high);
       bmp_ptr += 8;
 
       x_tile++;
@@ -594,7 +621,7 @@ INLINE void ppu_renderoam(uint8 *vidbuf, int scanline, bool draw)
       /* Check for a strike on sprite 0 if strike flag isn't set */
       if (sprite_num == 0 && !ppu.strikeflag)
       {
-         check_strike(draw ? vidbuf + sprite->x_loc : NULL, sprite->attr, get_patpix(tile_addr));
+         check_strike(draw ? vidbuf + sprite->x_loc : NULL, get_patrow(tile_addr, sprite->attr & OAMF_HFLIP));
       }
 
       /* If we don't draw to buffer then we're done after sprite 0 */
@@ -605,7 +632,7 @@ INLINE void ppu_renderoam(uint8 *vidbuf, int scanline, bool draw)
       draw_oamtile(
          vidbuf + sprite->x_loc,
          sprite->attr,
-         get_patpix(tile_addr),
+         get_patrow(tile_addr, sprite->attr & OAMF_HFLIP),
          ppu.palette + 16 + ((sprite->attr & 3) << 2));
 
       /* maximum of 8 sprites per scanline */
@@ -714,6 +741,7 @@ void ppu_reset(void)
    ppu.latch = 0;
    ppu.vram_accessible = true;
    ppu.scanlines = nes_getptr()->scanlines_per_frame;
+   ppu_invalidatechr();
 }
 
 ppu_t *ppu_init(void)
@@ -721,7 +749,8 @@ ppu_t *ppu_init(void)
    memset(&ppu, 0, sizeof(ppu_t));
 
    ppu.nametab = malloc(0x400 * 4);
-   if (!ppu.nametab)
+   ppu.patcache = malloc(PPU_PATCACHE_TILES * sizeof(*ppu.patcache));
+   if (!ppu.nametab || !ppu.patcache)
       return NULL;
 
    ppu_setopt(PPU_DRAW_BACKGROUND, true);
@@ -735,6 +764,8 @@ void ppu_shutdown(void)
 {
    free(ppu.nametab);
    ppu.nametab = NULL;
+   free(ppu.patcache);
+   ppu.patcache = NULL;
 }
 
 
@@ -812,7 +843,7 @@ static void draw_sprite(uint8 *bmp, int x, int y, uint8 tile_num, uint8 attrib)
       if (line == 8)
          tile_addr += 8;
 
-      draw_bgtile(vid, get_patpix(tile_addr), ppu.palette + 16 + col_high);
+      draw_bgtile(vid, get_patrow(tile_addr, false), ppu.palette + 16 + col_high);
       //draw_oamtile(vid, attrib, data_ptr[0], data_ptr[8], ppu.palette + 16 + col_high);
 
       tile_addr++;
@@ -66,6 +66,9 @@
 #define  OAMF_HFLIP           0x40
 #define  OAMF_BEHIND          0x20
 
+/* Decoded pattern cache: 512 tiles * 8 rows * (normal, hflipped) * 8 pixels */
+#define  PPU_PATCACHE_TILES   (0x2000 / 16)
+
 /* Maximum number of sprites per horizontal scanline */
 #define  PPU_MAXSPRITE        8
 
@@ -125,6 +128,10 @@ typedef struct
    /* VRAM (CHR RAM/ROM) paging */
    uint8 *page[PPU_PAGECOUNT];
 
+   /* Pattern tables decoded to one byte per pixel, filled lazily per tile */
+   uint8 (*patcache)[8][2][8]; // [PPU_PATCACHE_TILES]
+   uint64 patcache_valid[8];   // One bit per tile, per pattern page
+
    /* Hardware registers */
    uint8 ctrl0, ctrl1, stat, oam_addr, nametab_base;
    uint8 latch, vdata_latch, tile_xofs, flipflop;
@@ -161,6 +168,7 @@ void ppu_setnametable(uint8 index, uint8 table);
 void ppu_setmirroring(ppu_mirror_t type);
 uint8 *ppu_getpage(uint32 page_num);
 uint8 *ppu_getnametable(uint8 table);
+void ppu_invalidatechr(void);
 
 /* Control */
 ppu_t *ppu_init(void);
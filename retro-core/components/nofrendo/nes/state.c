@@ -389,6 +389,7 @@ int state_load(const char* fn)
          }
 
          _fread(machine->cart->chr_ram, blockLength);
+         ppu_invalidatechr();
       }
 
 
@@ -474,6 +475,9 @@ int state_load(const char* fn)
    /* close file, we're done */
    fclose(file);
 
+   /* PRG-RAM was overwritten behind the CPU's back */
+   nes6502_invalidate(-1);
+
    MESSAGE_INFO("state_load: Game restored\n");
 
    return 0;
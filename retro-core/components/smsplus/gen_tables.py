@@ -0,0 +1,60 @@
+import os, sys
+
+# This script generates render_lut.h, the constant tables used by render.c.
+# It is run by CMake at build time so that the tables end up in flash/rodata
+# rather than being built in RAM by render_init(). Usage: gen_tables.py <output file>
+
+
+def make_lut():
+    lut = bytearray(0x10000)
+    for bx in range(0x100):
+        for sx in range(0x100):
+            b = bx & 0x0F           # Background pixel
+            bp = bx & 0x20          # Background priority
+            bf = bx & 0x7F          # Full background pixel + priority + sprite marker
+            s = sx & 0x0F           # Sprite pixel
+            sf = s | 0x10 | 0x40    # Full sprite pixel, w/ palette and marker bits added
+            if bx & 0x40:
+                c = bf              # Overwriting a sprite pixel, return the input
+            elif bp and b:
+                c = bf | 0x40       # Underlying pixel is high priority
+            elif s:
+                c = sf
+            else:
+                c = bf
+            lut[(bx << 8) | sx] = c
+    return lut
+
+
+def make_bp_lut():
+    # Little endian layout only, big endian targets must use the runtime path
+    bp_lut = [0] * 0x10000
+    for i in range(0x100):
+        for j in range(0x100):
+            out = 0
+            for x in range(8):
+                if j & (0x80 >> x):
+                    out |= 8 << (x << 2)
+                if i & (0x80 >> x):
+                    out |= 4 << (x << 2)
+            bp_lut[(j << 8) | i] = out
+    return bp_lut
+
+
+def format_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("  " + ",".join(fmt % v for v in values[i : i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+output = "/* Generated by gen_tables.py, do not edit */\n\n"
+output += "/* Pixel look-up table */\n"
+output += "static const uint8 render_lut[0x10000] = {\n%s\n};\n\n" % format_array(make_lut(), "0x%02X", 32)
+output += "/* Bitplane to packed pixel LUT */\n"
+output += "static const uint32 render_bp_lut[0x10000] = {\n%s\n};\n" % format_array(make_bp_lut(), "0x%08X", 8)
+
+output_file = sys.argv[1] if len(sys.argv) > 1 else os.path.join(sys.path[0], "render_lut.h")
+
+with open(output_file, "w", newline="") as f:
+    f.write(output)
@@ -134,6 +134,11 @@ static uint32 atex[4] =
   0x30303030,
 };
 
+#ifdef SMS_GENERATED_LUTS
+/* Generated at build time by gen_tables.py, lives in flash */
+#include "render_lut.h"
+#endif
+
 /* Pixel look-up table */
 static const uint8 *lut; // )[0x10000];
 
@@ -205,11 +210,17 @@ void render_shutdown(void)
 /* Initialize the rendering data */
 void render_init(void)
 {
-  int i, j;
-  int bx, sx, b, s, bp, bf, sf, c;
+  int i;
 
   make_tms_tables();
 
+#ifdef SMS_GENERATED_LUTS
+  lut = render_lut;
+  bp_lut = render_bp_lut;
+#else
+  int j;
+  int bx, sx, b, s, bp, bf, sf, c;
+
   /* Generate 64k of data for the look up table */
   uint8 *_lut = malloc(0x10000);
 
@@ -301,6 +312,7 @@ void render_init(void)
 #endif
   }
   bp_lut = _bp_lut;
+#endif
 
   sms_cram_expand_table[0] =  0;
   sms_cram_expand_table[1] = (5 << 3)  + (1 << 2);
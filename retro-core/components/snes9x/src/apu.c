@@ -11,6 +11,25 @@
 
 extern const int32_t NoiseFreq[32];
 
+SDSPLog* S9xDSPLog = NULL;
+void (*S9xDSPLogFull)(SDSPLog* log) = NULL;
+uint32_t S9xDSPEndFlags = 0;
+uint32_t S9xAPURAMPageEpoch [0x100];
+uint32_t S9xAPURAMEpoch = 1;
+
+/* What the SPC700 reads back from the DSP while its writes are deferred,
+ * APU.DSP then belongs to whoever replays the log. */
+static uint8_t ShadowDSP [0x80];
+
+/* Picks up the end flags raised by the mixer since the last call */
+static void S9xSyncShadowEndFlags()
+{
+   uint32_t flags = __atomic_exchange_n(&S9xDSPEndFlags, 0, __ATOMIC_ACQ_REL);
+
+   ShadowDSP [APU_ENDX] |= flags & 0xff;
+   ShadowDSP [APU_KON] &= ~(flags >> 8);
+}
+
 bool S9xInitAPU()
 {
    IAPU.RAM = (uint8_t*) malloc(0x10000);
@@ -93,9 +112,108 @@ void S9xResetAPU()
    S9xSetEchoEnable(0);
 }
 
+void S9xSetDSPLog(SDSPLog* log)
+{
+   int32_t i;
+
+   /* ARAM may have been replaced (state load, reset) while nothing tracked it */
+   if (log && !S9xDSPLog)
+   {
+      memcpy(ShadowDSP, APU.DSP, sizeof(ShadowDSP));
+      __atomic_store_n(&S9xDSPEndFlags, 0, __ATOMIC_RELEASE);
+      for (i = 0; i < 0x100; i++)
+         S9xAPURAMPageEpoch [i] = S9xAPURAMEpoch;
+   }
+
+   if (log)
+   {
+      log->count = 0;
+      log->synced = false;
+      log->frame_cycles = (Settings.PAL ? SNES_MAX_PAL_VCOUNTER : SNES_MAX_NTSC_VCOUNTER) * Settings.H_Max;
+   }
+
+   S9xDSPLog = log;
+}
+
 void S9xSetAPUDSP(uint8_t byte)
 {
    uint8_t reg = IAPU.RAM [0xf2];
+   SDSPWrite* write;
+   int32_t cycles;
+
+   if (!S9xDSPLog)
+   {
+      S9xApplyAPUDSP(reg, byte);
+      return;
+   }
+
+   if (S9xDSPLog->count >= DSP_LOG_SIZE && S9xDSPLogFull)
+      S9xDSPLogFull(S9xDSPLog);
+
+   if (S9xDSPLog->count >= DSP_LOG_SIZE)
+      return;
+
+   /* The SPC700 runs ahead of the 65c816 by at most one instruction, its own
+    * cycle count is the most accurate time stamp we have. */
+   cycles = CPU.V_Counter * Settings.H_Max + APU.Cycles;
+   write = &S9xDSPLog->writes [S9xDSPLog->count++];
+   write->cycles = cycles < 0 ? 0 : cycles;
+   write->reg = reg;
+   write->byte = byte;
+
+   if (reg >= 0x80)
+      return;
+
+   /* Keep ENDX and KON as the SPC700 would see them now, the mixer's copies
+    * are a frame late. Its end flags from before this write are merged first. */
+   switch (reg)
+   {
+   case APU_FLG:
+      if (byte & APU_SOFT_RESET)
+      {
+         S9xSyncShadowEndFlags();
+         ShadowDSP [APU_ENDX] = 0;
+         ShadowDSP [APU_KOFF] = 0;
+         ShadowDSP [APU_KON] = 0;
+      }
+      break;
+   case APU_ENDX:
+      S9xSyncShadowEndFlags();
+      ShadowDSP [APU_ENDX] = 0;
+      return;
+   case APU_KOFF:
+      S9xSyncShadowEndFlags();
+      ShadowDSP [APU_KON] &= ~byte;
+      break;
+   case APU_KON:
+      S9xSyncShadowEndFlags();
+      ShadowDSP [APU_ENDX] &= ~(byte & ~ShadowDSP [APU_KOFF]);
+      break;
+   default:
+      break;
+   }
+
+   ShadowDSP [reg] = byte;
+}
+
+/* Gives the mixer its own copy of the ARAM, the SPC700 keeps writing to
+ * IAPU.RAM while the log is being replayed. Only the pages written since this
+ * log was last sealed are copied, plus the direct pages and the IPL page. */
+void S9xSealDSPLog(SDSPLog* log)
+{
+   int32_t page;
+
+   for (page = 0; page < 0x100; page++)
+   {
+      if (page < 2 || page == 0xff || S9xAPURAMPageEpoch [page] >= log->ram_epoch)
+         memcpy(log->ram + (page << 8), IAPU.RAM + (page << 8), 0x100);
+   }
+
+   log->ram_epoch = ++S9xAPURAMEpoch;
+}
+
+void S9xApplyAPUDSP(uint8_t reg, uint8_t byte)
+{
    static uint8_t KeyOn;
    static uint8_t KeyOnPrev;
    int32_t i;
@@ -416,6 +534,24 @@ uint8_t S9xGetAPUDSP()
    uint8_t reg = IAPU.RAM [0xf2] & 0x7f;
    uint8_t byte = APU.DSP [reg];
 
+   if (S9xDSPLog)
+   {
+      if (reg == APU_ENDX || reg == APU_KON)
+         S9xSyncShadowEndFlags();
+      byte = ShadowDSP [reg];
+
+      /* OUTX and ENVX come from the mixer. Wait for it to finish the previous
+       * frame and apply this frame's writes so far, then SoundData holds what
+       * the single-threaded path would show. The writes flushed this way lose
+       * their time stamps (they land at the start of the frame). */
+      if (((reg & 0x0f) == APU_OUTX || (reg & 0x0f) == APU_ENVX) && S9xDSPLogFull
+            && (S9xDSPLog->count > 0 || !S9xDSPLog->synced))
+      {
+         S9xDSPLogFull(S9xDSPLog);
+         S9xDSPLog->synced = true;
+      }
+   }
+
    switch (reg)
    {
    case APU_OUTX + 0x00:
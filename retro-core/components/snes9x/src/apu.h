@@ -48,6 +48,11 @@ typedef struct
 extern SAPU APU;
 extern SIAPU IAPU;
 
+/* S9xAPURAMEpoch as of the last SPC700 write to each ARAM page (pages 0, 1
+ * and $FF are not tracked), S9xSealDSPLog() only copies what changed. */
+extern uint32_t S9xAPURAMPageEpoch [0x100];
+extern uint32_t S9xAPURAMEpoch;
+
 static INLINE void S9xAPUUnpackStatus(void)
 {
    IAPU._Zero     = ((IAPU.Registers.P & Zero) == 0) | (IAPU.Registers.P & Negative);
@@ -74,6 +79,7 @@ void S9xDeinitAPU(void);
 void S9xDecacheSamples(void);
 void S9xSetAPUControl(uint8_t byte);
 void S9xSetAPUDSP(uint8_t byte);
+void S9xApplyAPUDSP(uint8_t reg, uint8_t byte);
 uint8_t S9xGetAPUDSP(void);
 bool S9xInitSound(int32_t buffer_ms, int32_t lag_ms);
 void S9xPrintAPUState(void);
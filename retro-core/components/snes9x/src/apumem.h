@@ -110,7 +110,10 @@ static INLINE void S9xAPUSetByte(uint8_t byte, uint32_t Address)
    else
    {
       if (Address < 0xffc0)
+      {
          IAPU.RAM [Address] = byte;
+         S9xAPURAMPageEpoch [Address >> 8] = S9xAPURAMEpoch;
+      }
       else
       {
          APU.ExtraRAM [Address - 0xffc0] = byte;
@@ -65,12 +65,20 @@ static const uint8_t Depths[8][4] =
    {0,         0,         0,         0}          /* 7 */
 };
 
-static NormalTileRenderer  DrawTilePtr;
-static ClippedTileRenderer DrawClippedTilePtr;
-static NormalTileRenderer  DrawHiResTilePtr;
-static ClippedTileRenderer DrawHiResClippedTilePtr;
-static LargePixelRenderer  DrawLargePixelPtr;
-static uint8_t  Mode7Depths [2];
+/* Per thread, like GFX and BG, so that S9xRenderBand() can run beside S9xUpdateScreen() */
+static THREAD_LOCAL NormalTileRenderer  DrawTilePtr;
+static THREAD_LOCAL ClippedTileRenderer DrawClippedTilePtr;
+static THREAD_LOCAL NormalTileRenderer  DrawHiResTilePtr;
+static THREAD_LOCAL ClippedTileRenderer DrawHiResClippedTilePtr;
+static THREAD_LOCAL LargePixelRenderer  DrawLargePixelPtr;
+static THREAD_LOCAL uint8_t  Mode7Depths [2];
+static THREAD_LOCAL uint32_t TileCacheBank;
+
+void (*S9xRenderBandStart)(SGFX* gfx) = NULL;
+void (*S9xRenderBandWait)(void) = NULL;
+
+/* Don't bother splitting smaller updates, the hand-off would cost more than it saves */
+#define RENDER_BAND_MIN_LINES 16
 
 static struct {
    SLineData LineData[240];
@@ -654,8 +662,8 @@ static void DrawOBJS(bool OnMain, uint8_t D)
    BG.PaletteShift = 4;
    BG.PaletteMask = 7;
    BG.Depth = TILE_4BIT;
-   BG.Buffer = IPPU.TileCache;
-   BG.Buffered = IPPU.TileCached;
+   BG.Buffer = IPPU.TileCache + TileCacheBank * (MAX_2BIT_TILES << 6);
+   BG.Buffered = IPPU.TileCached + TileCacheBank * MAX_2BIT_TILES;
    BG.NameSelect = PPU.OBJNameSelect;
    BG.DirectColourMode = false;
    GFX.PixSize = 1;
@@ -1582,8 +1590,8 @@ static void DrawBackground(uint32_t BGMode, uint32_t bg, uint8_t Z1, uint8_t Z2)
    BG.TileAddress = PPU.BG[bg].NameBase << 1;
    BG.NameSelect = 0;
    BG.Depth = Depths [BGMode][bg];
-   BG.Buffer = IPPU.TileCache;
-   BG.Buffered = IPPU.TileCached;
+   BG.Buffer = IPPU.TileCache + TileCacheBank * (MAX_2BIT_TILES << 6);
+   BG.Buffered = IPPU.TileCached + TileCacheBank * MAX_2BIT_TILES;
    BG.PaletteShift = PaletteShifts[BGMode][bg];
    BG.PaletteMask = PaletteMasks[BGMode][bg];
    BG.DirectColourMode = (BGMode == 3 || BGMode == 4) && bg == 0 && (GFX.r2130 & 1);
@@ -2582,93 +2590,17 @@ static void RenderScreen(uint8_t* Screen, bool sub, bool force_no_add, uint8_t D
    }
 }
 
-void S9xUpdateScreen(void)
+static void RenderLines(void)
 {
-   int32_t x2 = 1;
-   uint32_t starty, endy, black;
-
-   GFX.S = GFX.Screen;
-   GFX.r2131 = Memory.FillRAM [0x2131];
-   GFX.r212c = Memory.FillRAM [0x212c];
-   GFX.r212d = Memory.FillRAM [0x212d];
-   GFX.r2130 = Memory.FillRAM [0x2130];
-   GFX.Pseudo = Memory.FillRAM [0x2133] & 8;
-
-   if (IPPU.OBJChanged)
-      S9xSetupOBJ();
-
-   if (PPU.RecomputeClipWindows)
-   {
-      ComputeClipWindows();
-      PPU.RecomputeClipWindows = false;
-   }
-
-   GFX.StartY = IPPU.PreviousLine;
-   if ((GFX.EndY = IPPU.CurrentLine - 1) >= PPU.ScreenHeight)
-      GFX.EndY = PPU.ScreenHeight - 1;
-
-   /* XXX: Check ForceBlank? Or anything else? */
-   PPU.RangeTimeOver |= GFX.OBJLines[GFX.EndY].RTOFlags;
+   int32_t x2 = (PPU.BGMode == 5 || PPU.BGMode == 6 || IPPU.Interlace) ? 2 : 1;
+   uint32_t starty = GFX.StartY;
+   uint32_t endy = GFX.EndY;
+   uint32_t black;
 
-   starty = GFX.StartY;
-   endy   = GFX.EndY;
-
-   if (PPU.BGMode == 5 || PPU.BGMode == 6 || IPPU.Interlace || IPPU.DoubleHeightPixels)
+   if (IPPU.DoubleHeightPixels)
    {
-      if (PPU.BGMode == 5 || PPU.BGMode == 6 || IPPU.Interlace)
-      {
-         IPPU.RenderedScreenWidth = 512;
-         x2 = 2;
-      }
-
-      if (IPPU.DoubleHeightPixels)
-      {
-         starty = GFX.StartY * 2;
-         endy = GFX.EndY * 2 + 1;
-      }
-
-      if ((PPU.BGMode == 5 || PPU.BGMode == 6) && !IPPU.DoubleWidthPixels)
-      {
-         /* The game has switched from lo-res to hi-res mode part way down
-          * the screen. Scale any existing lo-res pixels on screen */
-         uint32_t y;
-         for (y = 0; y < starty; y++)
-         {
-            int32_t x;
-            uint16_t* p = (uint16_t*) (GFX.Screen + y * GFX.Pitch2) + 255;
-            uint16_t* q = (uint16_t*) p + 255;
-            for (x = 255; x >= 0; x--, p--, q -= 2)
-               q[0] = q[1] = p[0];
-         }
-         IPPU.DoubleWidthPixels = true;
-         IPPU.HalfWidthPixels = false;
-      }
-      /* BJ: And we have to change the height if Interlace gets set,
-       *     too. */
-      if (IPPU.Interlace && !IPPU.DoubleHeightPixels)
-      {
-         int32_t y;
-
-         starty                    = GFX.StartY * 2;
-         endy                      = GFX.EndY * 2 + 1;
-         IPPU.RenderedScreenHeight = PPU.ScreenHeight << 1;
-         IPPU.DoubleHeightPixels   = true;
-         GFX.Pitch2                = GFX.RealPitch;
-         GFX.Pitch                 = GFX.RealPitch * 2;
-         GFX.PPL                   = GFX.RealPitch;
-         GFX.PPLx2                 = GFX.RealPitch;
-
-         /* The game has switched from non-interlaced to interlaced mode
-          * part way down the screen. Scale everything. */
-         for (y = (int32_t) GFX.StartY - 1; y >= 0; y--)
-         {
-            /* memmove converted: Same malloc, different addresses, and identical addresses at line 0 [Neb]
-             * DS2 DMA notes: This code path is unused [Neb] */
-            memcpy(GFX.Screen + y * 2 * GFX.Pitch2, GFX.Screen + y * GFX.Pitch2, GFX.Pitch2);
-            /* memmove converted: Same malloc, different addresses [Neb] */
-            memcpy(GFX.Screen + (y * 2 + 1) * GFX.Pitch2, GFX.Screen + y * GFX.Pitch2, GFX.Pitch2);
-         }
-      }
+      starty = GFX.StartY * 2;
+      endy = GFX.EndY * 2 + 1;
    }
 
    black = BLACK | (BLACK << 16);
@@ -3094,6 +3026,112 @@ void S9xUpdateScreen(void)
 
    /* Double the height of the pixels just drawn */
    FIX_INTERLACE(GFX.Screen, false, GFX.ZBuffer);
+}
+
+/* Runs on the thread behind S9xRenderBandStart(), with its own copy of GFX
+ * and the second tile cache bank. Everything else is left untouched by the
+ * CPU thread until S9xRenderBandWait() returns. */
+void S9xRenderBand(SGFX* gfx)
+{
+   S9xGFX = gfx;
+   TileCacheBank = 1;
+   DrawHiResTilePtr = DrawTile16;
+   DrawHiResClippedTilePtr = DrawClippedTile16;
+   RenderLines();
+}
+
+void S9xUpdateScreen(void)
+{
+   uint32_t starty;
+
+   GFX.S = GFX.Screen;
+   GFX.r2131 = Memory.FillRAM [0x2131];
+   GFX.r212c = Memory.FillRAM [0x212c];
+   GFX.r212d = Memory.FillRAM [0x212d];
+   GFX.r2130 = Memory.FillRAM [0x2130];
+   GFX.Pseudo = Memory.FillRAM [0x2133] & 8;
+
+   if (IPPU.OBJChanged)
+      S9xSetupOBJ();
+
+   if (PPU.RecomputeClipWindows)
+   {
+      ComputeClipWindows();
+      PPU.RecomputeClipWindows = false;
+   }
+
+   GFX.StartY = IPPU.PreviousLine;
+   if ((GFX.EndY = IPPU.CurrentLine - 1) >= PPU.ScreenHeight)
+      GFX.EndY = PPU.ScreenHeight - 1;
+
+   /* XXX: Check ForceBlank? Or anything else? */
+   PPU.RangeTimeOver |= GFX.OBJLines[GFX.EndY].RTOFlags;
+
+   starty = GFX.StartY;
+
+   if (PPU.BGMode == 5 || PPU.BGMode == 6 || IPPU.Interlace || IPPU.DoubleHeightPixels)
+   {
+      if (PPU.BGMode == 5 || PPU.BGMode == 6 || IPPU.Interlace)
+         IPPU.RenderedScreenWidth = 512;
+
+      if (IPPU.DoubleHeightPixels)
+         starty = GFX.StartY * 2;
+
+      if ((PPU.BGMode == 5 || PPU.BGMode == 6) && !IPPU.DoubleWidthPixels)
+      {
+         /* The game has switched from lo-res to hi-res mode part way down
+          * the screen. Scale any existing lo-res pixels on screen */
+         uint32_t y;
+         for (y = 0; y < starty; y++)
+         {
+            int32_t x;
+            uint16_t* p = (uint16_t*) (GFX.Screen + y * GFX.Pitch2) + 255;
+            uint16_t* q = (uint16_t*) p + 255;
+            for (x = 255; x >= 0; x--, p--, q -= 2)
+               q[0] = q[1] = p[0];
+         }
+         IPPU.DoubleWidthPixels = true;
+         IPPU.HalfWidthPixels = false;
+      }
+      /* BJ: And we have to change the height if Interlace gets set,
+       *     too. */
+      if (IPPU.Interlace && !IPPU.DoubleHeightPixels)
+      {
+         int32_t y;
+
+         IPPU.RenderedScreenHeight = PPU.ScreenHeight << 1;
+         IPPU.DoubleHeightPixels   = true;
+         GFX.Pitch2                = GFX.RealPitch;
+         GFX.Pitch                 = GFX.RealPitch * 2;
+         GFX.PPL                   = GFX.RealPitch;
+         GFX.PPLx2                 = GFX.RealPitch;
+
+         /* The game has switched from non-interlaced to interlaced mode
+          * part way down the screen. Scale everything. */
+         for (y = (int32_t) GFX.StartY - 1; y >= 0; y--)
+         {
+            /* memmove converted: Same malloc, different addresses, and identical addresses at line 0 [Neb]
+             * DS2 DMA notes: This code path is unused [Neb] */
+            memcpy(GFX.Screen + y * 2 * GFX.Pitch2, GFX.Screen + y * GFX.Pitch2, GFX.Pitch2);
+            /* memmove converted: Same malloc, different addresses [Neb] */
+            memcpy(GFX.Screen + (y * 2 + 1) * GFX.Pitch2, GFX.Screen + y * GFX.Pitch2, GFX.Pitch2);
+         }
+      }
+   }
+
+   if (S9xRenderBandStart && GFX.EndY + 1 - GFX.StartY >= RENDER_BAND_MIN_LINES * 2)
+   {
+      static SGFX band;
+      band = GFX;
+      band.StartY = GFX.StartY + (GFX.EndY + 1 - GFX.StartY) / 2;
+      S9xRenderBandStart(&band);
+      GFX.EndY = band.StartY - 1;
+      RenderLines();
+      S9xRenderBandWait();
+      GFX.EndY = band.EndY;
+   }
+   else
+      RenderLines();
 
    IPPU.PreviousLine = IPPU.CurrentLine;
 }
@@ -66,8 +66,17 @@ typedef struct
    bool        Pseudo;
 } SGFX;
 
-/* External port interface which must be implemented or initialised for each port. */
-extern SGFX GFX;
+/* External port interface which must be implemented or initialised for each port.
+ * Each thread renders through its own SGFX, see S9xRenderBand(). */
+extern THREAD_LOCAL SGFX* S9xGFX;
+#define GFX (*S9xGFX)
+
+/* Optional port hooks to render the bottom part of the lines flushed by
+ * S9xUpdateScreen() on another thread. S9xRenderBandStart() must get
+ * S9xRenderBand(gfx) running there, S9xRenderBandWait() returns once it's done. */
+extern void (*S9xRenderBandStart)(SGFX* gfx);
+extern void (*S9xRenderBandWait)(void);
+void S9xRenderBand(SGFX* gfx);
 
 typedef struct
 {
@@ -109,7 +118,7 @@ typedef struct
    int16_t CentreY;
 } SLineMatrixData;
 
-extern SBG BG;
+extern THREAD_LOCAL SBG BG;
 
 /* Could use BSWAP instruction on Intel port... */
 #define SWAP_DWORD(dword) dword = ((((dword) & 0x000000ff) << 24) \
@@ -175,17 +184,12 @@ static INLINE uint16_t COLOR_SUB(uint16_t C1, uint16_t C2)
 #ifdef NO_ZERO_LUT
 static INLINE uint16_t COLOR_SUB1_2(uint16_t C1, uint16_t C2)
 {
-   // if the top bit of the color value is zero then the value is zero, otherwise its just the value
-   int C = (((C1) | RGB_HI_BITS_MASKx2) - ((C2) & RGB_REMOVE_LOW_BITS_MASK)) >> 1;
-   int r, g, b;
-   DECOMPOSE_PIXEL(C, r, g, b);
-   if (r & 0x10)
-      r = 0;
-   if (g & GREEN_HI_BIT)
-      g = 0;
-   if (b & 0x10)
-      b = 0;
-   return BUILD_PIXEL(r, g, b);
+   /* Same result as the GFX.ZERO lookup below, without the table or branches:
+    * components whose top bit was borrowed from are zeroed, the others just
+    * lose that bit. */
+   uint32_t C  = (((C1) | RGB_HI_BITS_MASKx2) - ((C2) & RGB_REMOVE_LOW_BITS_MASK)) >> 1;
+   uint32_t hi = C & (RGB_HI_BITS_MASKx2 >> 1);
+   return C & (hi - (((hi >> 4) | (hi >> 5)) & RGB_LOW_BITS_MASK));
 }
 #else
 #define COLOR_SUB1_2(C1, C2) \
@@ -37,9 +37,10 @@ SDMA DMA[8];
 uint8_t* HDMAMemPointers [8];
 uint8_t* HDMABasePointers [8];
 
-SBG BG;
+THREAD_LOCAL SBG BG;
 
-SGFX GFX;
+static SGFX MainGFX;
+THREAD_LOCAL SGFX* S9xGFX = &MainGFX;
 
 const int32_t NoiseFreq [32] =
 {
@@ -149,8 +149,9 @@ bool S9xInitMemory(void)
 
    IPPU.ScreenColors = (uint16_t *)calloc(256 * 9, sizeof(uint16_t));
    IPPU.DirectColors = IPPU.ScreenColors + 256;
+   /* Two banks of 64 bytes per tile, the second one belongs to the S9xRenderBand() thread */
    IPPU.TileCache = (uint8_t*) calloc(MAX_2BIT_TILES, 128);
-   IPPU.TileCached = (uint8_t*) calloc(MAX_2BIT_TILES, 1);
+   IPPU.TileCached = (uint8_t*) calloc(MAX_2BIT_TILES, 2);
 
    bytes0x2000 = (uint8_t *)calloc(0x2000, 1);
 
@@ -17,6 +17,10 @@
 #define INLINE inline
 #endif
 
+#ifndef THREAD_LOCAL
+#define THREAD_LOCAL __thread
+#endif
+
 #ifdef PSP
 #define PIXEL_FORMAT BGR555
 #else
@@ -1687,7 +1687,7 @@ static void CommonPPUReset()
    IPPU.OBJChanged = true;
    IPPU.RenderThisFrame = true;
    IPPU.FrameCount = 0;
-   memset(IPPU.TileCached, 0, MAX_2BIT_TILES);
+   memset(IPPU.TileCached, 0, MAX_2BIT_TILES * 2);
    IPPU.FirstVRAMRead = false;
    IPPU.Interlace = false;
    IPPU.DoubleWidthPixels = false;
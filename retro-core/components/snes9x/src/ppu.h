@@ -342,6 +342,15 @@ static INLINE void REGISTER_2104(uint8_t byte)
    Memory.FillRAM [0x2104] = byte;
 }
 
+/* Both tile cache banks hold conversions of the tiles at this address */
+static INLINE void INVALIDATE_TILES(uint32_t address)
+{
+   uint8_t* TileCached = IPPU.TileCached;
+   TileCached[address >> 4] = TileCached[address >> 5] = TileCached[address >> 6] = false;
+   TileCached += MAX_2BIT_TILES;
+   TileCached[address >> 4] = TileCached[address >> 5] = TileCached[address >> 6] = false;
+}
+
 static INLINE void REGISTER_2118(uint8_t Byte)
 {
    uint32_t address;
@@ -353,9 +362,7 @@ static INLINE void REGISTER_2118(uint8_t Byte)
    }
    else
       Memory.VRAM[address = (PPU.VMA.Address << 1) & 0xFFFF] = Byte;
-   IPPU.TileCached[address >> 4] = false;
-   IPPU.TileCached[address >> 5] = false;
-   IPPU.TileCached[address >> 6] = false;
+   INVALIDATE_TILES(address);
    if (!PPU.VMA.High)
       PPU.VMA.Address += PPU.VMA.Increment;
 }
@@ -366,9 +373,7 @@ static INLINE void REGISTER_2118_tile(uint8_t Byte)
    uint32_t rem = PPU.VMA.Address & PPU.VMA.Mask1;
    address = (((PPU.VMA.Address & ~PPU.VMA.Mask1) + (rem >> PPU.VMA.Shift) + ((rem & (PPU.VMA.FullGraphicCount - 1)) << 3)) << 1) & 0xffff;
    Memory.VRAM [address] = Byte;
-   IPPU.TileCached[address >> 4] = false;
-   IPPU.TileCached[address >> 5] = false;
-   IPPU.TileCached[address >> 6] = false;
+   INVALIDATE_TILES(address);
    if (!PPU.VMA.High)
       PPU.VMA.Address += PPU.VMA.Increment;
 }
@@ -377,9 +382,7 @@ static INLINE void REGISTER_2118_linear(uint8_t Byte)
 {
    uint32_t address = (PPU.VMA.Address << 1) & 0xFFFF;
    Memory.VRAM[address] = Byte;
-   IPPU.TileCached[address >> 4] = false;
-   IPPU.TileCached[address >> 5] = false;
-   IPPU.TileCached[address >> 6] = false;
+   INVALIDATE_TILES(address);
    if (!PPU.VMA.High)
       PPU.VMA.Address += PPU.VMA.Increment;
 }
@@ -395,9 +398,7 @@ static INLINE void REGISTER_2119(uint8_t Byte)
    }
    else
       Memory.VRAM[address = ((PPU.VMA.Address << 1) + 1) & 0xFFFF] = Byte;
-   IPPU.TileCached[address >> 4] = false;
-   IPPU.TileCached[address >> 5] = false;
-   IPPU.TileCached[address >> 6] = false;
+   INVALIDATE_TILES(address);
    if (PPU.VMA.High)
       PPU.VMA.Address += PPU.VMA.Increment;
 }
@@ -407,9 +408,7 @@ static INLINE void REGISTER_2119_tile(uint8_t Byte)
    uint32_t rem = PPU.VMA.Address & PPU.VMA.Mask1;
    uint32_t address = ((((PPU.VMA.Address & ~PPU.VMA.Mask1) + (rem >> PPU.VMA.Shift) + ((rem & (PPU.VMA.FullGraphicCount - 1)) << 3)) << 1) + 1) & 0xFFFF;
    Memory.VRAM [address] = Byte;
-   IPPU.TileCached[address >> 4] = false;
-   IPPU.TileCached[address >> 5] = false;
-   IPPU.TileCached[address >> 6] = false;
+   INVALIDATE_TILES(address);
    if (PPU.VMA.High)
       PPU.VMA.Address += PPU.VMA.Increment;
 }
@@ -418,9 +417,7 @@ static INLINE void REGISTER_2119_linear(uint8_t Byte)
 {
    uint32_t address;
    Memory.VRAM[address = ((PPU.VMA.Address << 1) + 1) & 0xFFFF] = Byte;
-   IPPU.TileCached[address >> 4] = false;
-   IPPU.TileCached[address >> 5] = false;
-   IPPU.TileCached[address >> 6] = false;
+   INVALIDATE_TILES(address);
    if (PPU.VMA.High)
       PPU.VMA.Address += PPU.VMA.Increment;
 }
@@ -109,10 +109,13 @@ static const uint32_t IncreaseRate [32] =
 #define LAST_SAMPLE 0xffffff
 #define JUST_PLAYED_LAST_SAMPLE(c) ((c)->sample_pointer >= LAST_SAMPLE)
 
+/* Where samples are read from, the log's copy of the ARAM while replaying one */
+static uint8_t* SampleRAM = NULL;
+
 static INLINE uint8_t* S9xGetSampleAddress(int32_t sample_number)
 {
    uint32_t addr = (((APU.DSP[APU_DIR] << 8) + (sample_number << 2)) & 0xffff);
-   return (IAPU.RAM + addr);
+   return ((SampleRAM ? SampleRAM : IAPU.RAM) + addr);
 }
 
 void S9xAPUSetEndOfSample(int32_t i, Channel* ch)
@@ -123,11 +126,13 @@ void S9xAPUSetEndOfSample(int32_t i, Channel* ch)
    APU.DSP [APU_KON] &= ~(1 << i);
    APU.DSP [APU_KOFF] &= ~(1 << i);
    APU.KeyedChannels &= ~(1 << i);
+   __atomic_fetch_or(&S9xDSPEndFlags, 0x101 << i, __ATOMIC_RELEASE);
 }
 
 void S9xAPUSetEndX(int32_t ch)
 {
    APU.DSP [APU_ENDX] |= 1 << ch;
+   __atomic_fetch_or(&S9xDSPEndFlags, 1 << ch, __ATOMIC_RELEASE);
 }
 
 void S9xSetEnvRate(Channel* ch, uint32_t rate, int32_t direction, int32_t target, uint32_t mode)
@@ -384,7 +389,7 @@ void DecodeBlock(Channel* ch)
       return;
    }
 
-   compressed = (int8_t*) &IAPU.RAM [ch->block_pointer];
+   compressed = (int8_t*) &(SampleRAM ? SampleRAM : IAPU.RAM) [ch->block_pointer];
 
    filter = *compressed;
    if ((ch->last_block = (bool) (filter & 1)))
@@ -921,6 +926,44 @@ void S9xMixSamplesLowPass(int16_t* buffer, int32_t sample_count, int32_t low_pas
    }
 }
 
+/* Mixes the frame in slices, applying each logged DSP write at the sample
+ * matching its time stamp. Without a buffer it just applies the writes. */
+void S9xMixSamplesDeferred(SDSPLog* log, int16_t* buffer, int32_t sample_count, int32_t low_pass_range)
+{
+   int32_t mixed = 0;
+   int32_t i;
+
+   SampleRAM = log->ram;
+
+   for (i = 0; i <= log->count; i++)
+   {
+      int32_t end = sample_count;
+
+      if (i < log->count)
+      {
+         /* Keep the slices on stereo pairs, MixStereo() relies on it */
+         end = ((int64_t) log->writes [i].cycles * (sample_count >> 1) / log->frame_cycles) << 1;
+         if (end > sample_count)
+            end = sample_count;
+      }
+
+      if (end > mixed)
+      {
+         if (low_pass_range)
+            S9xMixSamplesLowPass(buffer + mixed, end - mixed, low_pass_range);
+         else
+            S9xMixSamples(buffer + mixed, end - mixed);
+         mixed = end;
+      }
+
+      if (i < log->count)
+         S9xApplyAPUDSP(log->writes [i].reg, log->writes [i].byte);
+   }
+
+   SampleRAM = NULL;
+   log->count = 0;
+}
+
 void S9xResetSound(bool full)
 {
    int32_t i;
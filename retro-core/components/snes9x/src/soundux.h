@@ -137,5 +137,39 @@ void S9xStartSample(int32_t channel);
 void S9xMixSamples(int16_t* buffer, int32_t sample_count);
 void S9xMixSamplesLowPass(int16_t* buffer, int32_t sample_count, int32_t low_pass_range);
 void S9xSetPlaybackRate(uint32_t rate);
+
+/* DSP register writes of one frame, stamped with the master cycle (since the
+ * start of the frame) at which the SPC700 made them. While S9xDSPLog is set,
+ * S9xSetAPUDSP() queues the writes instead of applying them and the frame is
+ * synthesized later by S9xMixSamplesDeferred(), possibly on another core. */
+#define DSP_LOG_SIZE 1024
+
+typedef struct
+{
+   uint32_t cycles;
+   uint8_t  reg;
+   uint8_t  byte;
+} SDSPWrite;
+
+typedef struct
+{
+   int32_t   count;
+   int32_t   frame_cycles;
+   bool      synced;        /* The previous log has been mixed and this one applied, see S9xGetAPUDSP() */
+   uint32_t  ram_epoch;     /* S9xAPURAMEpoch after the last S9xSealDSPLog(), 0 if never sealed */
+   SDSPWrite writes [DSP_LOG_SIZE];
+   uint8_t   ram [0x10000]; /* ARAM as of S9xSealDSPLog(), where samples are read from */
+} SDSPLog;
+
+extern SDSPLog* S9xDSPLog;
+/* Called when the log is full or the SPC700 reads OUTX/ENVX. Must wait for the
+ * previous log to be mixed and empty this one: S9xSealDSPLog() then
+ * S9xMixSamplesDeferred(log, NULL, 0, 0) will do. */
+extern void (*S9xDSPLogFull)(SDSPLog* log);
+extern uint32_t S9xDSPEndFlags; /* ENDX bits raised by the mixer, | 0x100 << channel when it stopped */
+
+void S9xSetDSPLog(SDSPLog* log);
+void S9xSealDSPLog(SDSPLog* log);
+void S9xMixSamplesDeferred(SDSPLog* log, int16_t* buffer, int32_t sample_count, int32_t low_pass_range);
 #endif
 #endif
@@ -144,21 +144,49 @@ void gw_main(void)
     updates[0] = rg_surface_create(GW_SCREEN_WIDTH, GW_SCREEN_HEIGHT, RG_PIXEL_565_LE, MEM_FAST);
     currentUpdate = updates[0];
 
-    FILE *fp = fopen(app->romPath, "rb");
-    if (!fp)
-        RG_PANIC("Rom load failed");
-    ROM_DATA = malloc(400000);
-    // fseek(fp, 0x15, SEEK_SET);
-    ROM_DATA_LENGTH = fread(ROM_DATA, 1, 400000, fp);
-    fclose(fp);
-
     unsigned previous_m_halt = 2;
 
     /*** load ROM  */
-    bool rom_status = gw_system_romload();
+    // Unpacking a .gw file is slow and needs both the packed and unpacked images in memory,
+    // so the unpacked image is kept in the cache folder, keyed by the ROM's path, size and date.
+    rg_stat_t info = rg_storage_stat(app->romPath);
+    char cache_path[RG_PATH_MAX];
+    snprintf(cache_path, sizeof(cache_path), RG_BASE_PATH_CACHE "/gw_%08X.bin",
+             (unsigned)rg_crc32(info.size ^ (uint32_t)info.mtime, (const uint8_t *)app->romPath, strlen(app->romPath)));
+
+    void *cache_data = NULL;
+    size_t cache_size = 0;
+
+    if (rg_storage_exists(cache_path)
+        && rg_storage_read_file(cache_path, &cache_data, &cache_size, 0)
+        && gw_romloader_unpacked(cache_data, cache_size))
+    {
+        RG_LOGI("Loaded unpacked ROM from %s", cache_path);
+    }
+    else
+    {
+        if (cache_data != GW_ROM)
+            free(cache_data);
 
-    if (!rom_status)
-        RG_PANIC("gw_system_romload failed!");
+        FILE *fp = fopen(app->romPath, "rb");
+        if (!fp)
+            RG_PANIC("Rom load failed");
+        ROM_DATA = malloc(400000);
+        // fseek(fp, 0x15, SEEK_SET);
+        ROM_DATA_LENGTH = fread(ROM_DATA, 1, 400000, fp);
+        fclose(fp);
+
+        bool rom_status = gw_system_romload();
+
+        if (!rom_status)
+            RG_PANIC("gw_system_romload failed!");
+
+        // The packed image isn't needed anymore
+        free(ROM_DATA);
+        ROM_DATA = NULL;
+
+        rg_storage_write_file(cache_path, GW_ROM, GW_ROM_SIZE, 0);
+    }
 
     /*** Clear audio buffer */
     gw_system_sound_init();
@@ -22,7 +22,6 @@ static rg_surface_t *currentUpdate;
 static void set_display_mode(void)
 {
     display_rotation_t rotation = rg_display_get_rotation();
-    int width, height;
 
     if (rotation == RG_DISPLAY_ROTATION_AUTO)
     {
@@ -47,43 +46,34 @@ static void set_display_mode(void)
                 if (lynx->mCart->CartGetRotate() == CART_ROTATE_RIGHT)
                     rotation = RG_DISPLAY_ROTATION_RIGHT;
         }
+
+        rg_display_set_auto_rotation(rotation);
     }
 
+    // Mikie always renders in the native orientation, the display does the rotation
+    lynx->mMikie->SetRotation(MIKIE_NO_ROTATE);
+
     switch(rotation)
     {
         case RG_DISPLAY_ROTATION_LEFT:
-            width = HANDY_SCREEN_HEIGHT;
-            height = HANDY_SCREEN_WIDTH;
-            lynx->mMikie->SetRotation(MIKIE_ROTATE_L);
             dpad_mapped_up    = BUTTON_RIGHT;
             dpad_mapped_down  = BUTTON_LEFT;
             dpad_mapped_left  = BUTTON_UP;
             dpad_mapped_right = BUTTON_DOWN;
             break;
         case RG_DISPLAY_ROTATION_RIGHT:
-            width = HANDY_SCREEN_HEIGHT;
-            height = HANDY_SCREEN_WIDTH;
-            lynx->mMikie->SetRotation(MIKIE_ROTATE_R);
             dpad_mapped_up    = BUTTON_LEFT;
             dpad_mapped_down  = BUTTON_RIGHT;
             dpad_mapped_left  = BUTTON_DOWN;
             dpad_mapped_right = BUTTON_UP;
             break;
         default:
-            width = HANDY_SCREEN_WIDTH;
-            height = HANDY_SCREEN_HEIGHT;
-            lynx->mMikie->SetRotation(MIKIE_NO_ROTATE);
             dpad_mapped_up    = BUTTON_UP;
             dpad_mapped_down  = BUTTON_DOWN;
             dpad_mapped_left  = BUTTON_LEFT;
             dpad_mapped_right = BUTTON_RIGHT;
             break;
     }
-
-    updates[0]->width = width;
-    updates[0]->height = height;
-    updates[1]->width = width;
-    updates[1]->height = height;
 }
 
 static CSystem *new_lynx(void)
@@ -196,9 +186,8 @@ extern "C" void lynx_main(void)
 
     app = rg_system_reinit(AUDIO_SAMPLE_RATE, &handlers, options);
 
-    // the HANDY_SCREEN_WIDTH * HANDY_SCREEN_WIDTH is deliberate because of rotation
-    updates[0] = rg_surface_create(HANDY_SCREEN_WIDTH, HANDY_SCREEN_WIDTH, RG_PIXEL_565_BE, MEM_FAST);
-    updates[1] = rg_surface_create(HANDY_SCREEN_WIDTH, HANDY_SCREEN_WIDTH, RG_PIXEL_565_BE, MEM_FAST);
+    updates[0] = rg_surface_create(HANDY_SCREEN_WIDTH, HANDY_SCREEN_HEIGHT, RG_PIXEL_565_BE, MEM_FAST);
+    updates[1] = rg_surface_create(HANDY_SCREEN_WIDTH, HANDY_SCREEN_HEIGHT, RG_PIXEL_565_BE, MEM_FAST);
     currentUpdate = updates[0];
 
     // The Lynx has a variable framerate but 60 is typical
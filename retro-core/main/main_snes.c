@@ -12,12 +12,25 @@ static rg_surface_t *currentUpdate;
 
 static bool apu_enabled = true;
 static bool lowpass_filter = false;
+static bool dsp_threaded = false;
+static bool gfx_threaded = true;
 
 static int keymap_id = 0;
 static keymap_t keymap;
 
 static const char *SETTING_KEYMAP = "keymap";
 static const char *SETTING_APU_EMULATION = "apu";
+static const char *SETTING_DSP_THREADED = "dsp_threaded";
+static const char *SETTING_GFX_THREADED = "gfx_threaded";
+
+// Renders the bottom half of each S9xUpdateScreen() batch
+static rg_task_t *render_task_handle;
+
+#ifndef USE_BLARGG_APU
+// DSP writes of the current and previous frames, synthesized by audio_task
+static SDSPLog *dsp_logs[2];
+static rg_task_t *audio_task_handle;
+#endif
 // --- MAIN
 
 static void update_keymap(int id)
@@ -31,18 +44,98 @@ static bool screenshot_handler(const char *filename, int width, int height)
     return rg_surface_save_image_file(currentUpdate, filename, width, height);
 }
 
+#ifndef USE_BLARGG_APU
+static void audio_task(void *arg)
+{
+    rg_task_msg_t msg;
+
+    while (true)
+    {
+        rg_task_peek(&msg);
+        if (msg.type == RG_TASK_MSG_STOP)
+            break;
+
+        S9xMixSamplesDeferred((SDSPLog *)msg.dataPtr, (void *)audioBuffer, AUDIO_BUFFER_LENGTH << 1,
+                              lowpass_filter ? AUDIO_LOW_PASS_RANGE : 0);
+        rg_audio_submit(audioBuffer, AUDIO_BUFFER_LENGTH);
+
+        rg_task_receive(&msg);
+    }
+}
+
+// Wait for audio_task to finish the previous frame
+static void audio_sync(void)
+{
+    while (rg_task_messages_waiting(audio_task_handle) > 0)
+        continue;
+}
+
+// The log of the current frame is full, apply it here (its writes will land at the start of the frame)
+static void dsp_log_full(SDSPLog *log)
+{
+    audio_sync();
+    S9xSealDSPLog(log);
+    S9xMixSamplesDeferred(log, NULL, 0, 0);
+}
+
+// Go back to mixing on the CPU thread (at least until the next frame)
+static void dsp_log_stop(void)
+{
+    audio_sync();
+    S9xSetDSPLog(NULL);
+}
+#else
+static void dsp_log_stop(void) {}
+#endif
+
+static void render_task(void *arg)
+{
+    rg_task_msg_t msg;
+
+    while (true)
+    {
+        rg_task_peek(&msg);
+        if (msg.type == RG_TASK_MSG_STOP)
+            break;
+
+        S9xRenderBand((SGFX *)msg.dataPtr);
+
+        rg_task_receive(&msg);
+    }
+}
+
+static void render_band_start(SGFX *gfx)
+{
+    rg_task_send(render_task_handle, &(rg_task_msg_t){.dataPtr = gfx});
+}
+
+static void render_band_wait(void)
+{
+    while (rg_task_messages_waiting(render_task_handle) > 0)
+        continue;
+}
+
+static void update_render_bands(void)
+{
+    S9xRenderBandStart = gfx_threaded ? &render_band_start : NULL;
+    S9xRenderBandWait = gfx_threaded ? &render_band_wait : NULL;
+}
+
 static bool save_state_handler(const char *filename)
 {
+    dsp_log_stop();
     return S9xSaveState(filename);
 }
 
 static bool load_state_handler(const char *filename)
 {
+    dsp_log_stop();
     return S9xLoadState(filename);
 }
 
 static bool reset_handler(bool hard)
 {
+    dsp_log_stop();
     S9xReset();
     return true;
 }
@@ -78,6 +171,33 @@ static rg_gui_event_t lowpass_filter_cb(rg_gui_option_t *option, rg_gui_event_t
     return RG_DIALOG_VOID;
 }
 
+static rg_gui_event_t dsp_threaded_cb(rg_gui_option_t *option, rg_gui_event_t event)
+{
+    if (event == RG_DIALOG_PREV || event == RG_DIALOG_NEXT)
+    {
+        dsp_threaded = !dsp_threaded;
+        rg_settings_set_number(NS_APP, SETTING_DSP_THREADED, dsp_threaded);
+    }
+
+    strcpy(option->value, dsp_threaded ? "On " : "Off");
+
+    return RG_DIALOG_VOID;
+}
+
+static rg_gui_event_t gfx_threaded_cb(rg_gui_option_t *option, rg_gui_event_t event)
+{
+    if (event == RG_DIALOG_PREV || event == RG_DIALOG_NEXT)
+    {
+        gfx_threaded = !gfx_threaded;
+        rg_settings_set_number(NS_APP, SETTING_GFX_THREADED, gfx_threaded);
+        update_render_bands();
+    }
+
+    strcpy(option->value, gfx_threaded ? "On " : "Off");
+
+    return RG_DIALOG_VOID;
+}
+
 static rg_gui_event_t change_keymap_cb(rg_gui_option_t *option, rg_gui_event_t event)
 {
     if (event == RG_DIALOG_PREV || event == RG_DIALOG_NEXT)
@@ -235,12 +355,18 @@ void snes_main(void)
     const rg_gui_option_t options[] = {
         {0, "Audio enable", "-", RG_DIALOG_FLAG_NORMAL, &apu_toggle_cb},
         {0, "Audio filter", "-", RG_DIALOG_FLAG_NORMAL, &lowpass_filter_cb},
+    #ifndef USE_BLARGG_APU
+        {0, "Audio thread", "-", RG_DIALOG_FLAG_NORMAL, &dsp_threaded_cb},
+    #endif
+        {0, "Video thread", "-", RG_DIALOG_FLAG_NORMAL, &gfx_threaded_cb},
         {0, "Controls    ", "-", RG_DIALOG_FLAG_NORMAL, &menu_keymap_cb},
         RG_DIALOG_END,
     };
     app = rg_system_reinit(AUDIO_SAMPLE_RATE, &handlers, options);
 
     apu_enabled = rg_settings_get_number(NS_APP, SETTING_APU_EMULATION, 1);
+    dsp_threaded = rg_settings_get_number(NS_APP, SETTING_DSP_THREADED, 0);
+    gfx_threaded = rg_settings_get_number(NS_APP, SETTING_GFX_THREADED, 1);
 
     updates[0] = rg_surface_create(SNES_WIDTH, SNES_HEIGHT_EXTENDED, RG_PIXEL_565_LE, 0);
     updates[0]->height = SNES_HEIGHT;
@@ -276,6 +402,9 @@ void snes_main(void)
     if (!S9xInitGFX())
         RG_PANIC("Graphics init failed!");
 
+    render_task_handle = rg_task_create("snes_gfx", &render_task, NULL, 4 * 1024, RG_TASK_PRIORITY_3, 1);
+    update_render_bands();
+
     const char *filename = app->romPath;
 
     if (rg_extension_match(filename, "zip"))
@@ -292,6 +421,10 @@ void snes_main(void)
     S9xSetSamplesAvailableCallback(S9xAudioCallback);
 #else
     S9xSetPlaybackRate(Settings.SoundPlaybackRate);
+    dsp_logs[0] = rg_alloc(sizeof(SDSPLog), MEM_SLOW);
+    dsp_logs[1] = rg_alloc(sizeof(SDSPLog), MEM_SLOW);
+    audio_task_handle = rg_task_create("snes_audio", &audio_task, NULL, 2 * 1024, RG_TASK_PRIORITY_2, 1);
+    S9xDSPLogFull = &dsp_log_full;
 #endif
 
     if (app->bootFlags & RG_BOOT_RESUME)
@@ -305,6 +438,7 @@ void snes_main(void)
     bool menuCancelled = false;
     bool menuPressed = false;
     int skipFrames = 0;
+    int frame = 0;
 
     while (1)
     {
@@ -338,8 +472,23 @@ void snes_main(void)
         IPPU.RenderThisFrame = drawFrame;
         GFX.Screen = currentUpdate->data;
 
+    #ifndef USE_BLARGG_APU
+        if (apu_enabled && dsp_threaded)
+            S9xSetDSPLog(dsp_logs[frame++ & 1]);
+        else
+            dsp_log_stop();
+    #endif
+
         S9xMainLoop();
 
+    #ifndef USE_BLARGG_APU
+        if (S9xDSPLog)
+        {
+            S9xSealDSPLog(S9xDSPLog);
+            rg_task_send(audio_task_handle, &(rg_task_msg_t){.dataPtr = S9xDSPLog});
+        }
+    #endif
+
         if (drawFrame)
         {
             slowFrame = !rg_display_sync(false);
@@ -347,16 +496,16 @@ void snes_main(void)
         }
 
     #ifndef USE_BLARGG_APU
-        if (apu_enabled && lowpass_filter)
+        if (apu_enabled && lowpass_filter && !S9xDSPLog)
             S9xMixSamplesLowPass((void *)audioBuffer, AUDIO_BUFFER_LENGTH << 1, AUDIO_LOW_PASS_RANGE);
-        else if (apu_enabled)
+        else if (apu_enabled && !S9xDSPLog)
             S9xMixSamples((void *)audioBuffer, AUDIO_BUFFER_LENGTH << 1);
     #endif
 
         rg_system_tick(rg_system_timer() - startTime);
 
     #ifndef USE_BLARGG_APU
-        if (apu_enabled)
+        if (apu_enabled && !S9xDSPLog)
             rg_audio_submit(audioBuffer, AUDIO_BUFFER_LENGTH);
     #endif
 
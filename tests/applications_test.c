@@ -0,0 +1,212 @@
+/*
+** The launcher's file lists: a synthetic 10,000-file folder in scandir order
+** goes through the sort, the saves index, tab_refresh() and gui_sort_list(),
+** the results are checked and each step is timed. The file includes
+** applications.c to reach its statics and links gui.c for the list code;
+** drawing, storage and the rest of the system are replaced by the minimal
+** versions below.
+**
+** Usage: applications_test [files]
+*/
+
+#include "applications.c"
+
+#define SCREEN_WIDTH 320
+#define SCREEN_HEIGHT 240
+
+static retro_app_t app = {.short_name = "nes", .paths.roms = RG_STORAGE_ROOT "/roms/nes"};
+static tab_t tab = {.name = "nes", .arg = &app, .listbox = {.sort_mode = SORT_TEXT_ASC, .format = format_item}};
+static int failures = 0;
+
+#define CHECK(cond, ...) if (!(cond)) { printf(__VA_ARGS__); printf("\n"); if (++failures > 20) exit(1); }
+
+bool bookmark_add(book_type_t book, const retro_file_t *file) { return false; }
+bool bookmark_exists(book_type_t book, const retro_file_t *file) { return false; }
+retro_file_t *bookmark_find_by_app(book_type_t book, const retro_app_t *app) { return NULL; }
+bool bookmark_remove(book_type_t book, const retro_file_t *file) { return false; }
+const binfile_t *builtin_images[] = {NULL};
+const rg_display_t *rg_display_get_info(void) { static rg_display_t display; return &display; }
+void rg_display_submit(const rg_surface_t *update, uint32_t flags) {}
+bool rg_display_sync(bool block) { return true; }
+uint8_t rg_emu_get_last_used_slot(const char *romPath) { return 0; }
+char *rg_emu_get_path(rg_path_type_t type, const char *filename) { return NULL; }
+rg_emu_states_t *rg_emu_get_states(const char *romPath, size_t slots) { return NULL; }
+void rg_gui_alert(const char *title, const char *message) {}
+bool rg_gui_confirm(const char *title, const char *message, bool default_yes) { return false; }
+intptr_t rg_gui_dialog(const char *title, const rg_gui_option_t *options, int selected) { return RG_DIALOG_CANCELLED; }
+void rg_gui_draw_icons(void) {}
+void rg_gui_draw_image(int x_pos, int y_pos, int width, int height, bool resample, const rg_image_t *img) {}
+void rg_gui_draw_message(const char *format, ...) {}
+rg_color_t rg_gui_get_theme_color(const char *section, const char *key, rg_color_t default_value) { return default_value; }
+rg_image_t *rg_gui_get_theme_image(const char *name) { return NULL; }
+int rg_gui_savestate_menu(const char *title, const char *rom_path, bool quick_return) { return -1; }
+void rg_gui_set_surface(rg_surface_t *surface) {}
+uint32_t rg_input_read_gamepad(void) { return 0; }
+void rg_settings_commit(void) {}
+double rg_settings_get_number(const char *section, const char *key, double default_value) { return default_value; }
+char *rg_settings_get_string(const char *section, const char *key, const char *default_value) { return default_value ? strdup(default_value) : NULL; }
+void rg_settings_set_number(const char *section, const char *key, double value) {}
+void rg_settings_set_string(const char *section, const char *key, const char *value) {}
+bool rg_storage_exists(const char *path) { return false; }
+bool rg_storage_mkdir(const char *dir) { return false; }
+bool rg_storage_read_file(const char *path, void **data_out, size_t *data_len, uint32_t flags) { return false; }
+bool rg_storage_scandir(const char *path, rg_scandir_cb_t *callback, void *arg, uint32_t flags) { return false; }
+rg_stat_t rg_storage_stat(const char *path) { return (rg_stat_t){0}; }
+bool rg_storage_write_file(const char *path, const void *data_ptr, size_t data_len, uint32_t flags) { return false; }
+rg_surface_t *rg_surface_convert(const rg_surface_t *source, int new_width, int new_height, int new_format) { return NULL; }
+rg_surface_t *rg_surface_create(int width, int height, int format, uint32_t alloc_flags) { return NULL; }
+void rg_surface_free(rg_surface_t *surface) {}
+rg_surface_t *rg_surface_load_image(const uint8_t *data, size_t data_len, uint32_t flags) { return NULL; }
+rg_surface_t *rg_surface_load_image_file(const char *filename, uint32_t flags) { return NULL; }
+rg_app_t *rg_system_get_app(void) { static rg_app_t rg_app; return &rg_app; }
+bool rg_system_have_app(const char *app) { return false; }
+void rg_system_switch_app(const char *part, const char *name, const char *args, uint32_t flags) { abort(); }
+
+// Text isn't drawn, only measured as 8x12 cells so that gui.c lays out the list
+rg_rect_t rg_gui_draw_text(int x_pos, int y_pos, int width, const char *text, rg_color_t color_fg,
+                           rg_color_t color_bg, uint32_t flags)
+{
+    return (rg_rect_t){0, 0, RG_MIN((int)strlen(text) * 8, SCREEN_WIDTH), 12};
+}
+
+static double elapsed_ms(int64_t start)
+{
+    return (rg_system_timer() - start) / 1000.0;
+}
+
+static int name_number(const retro_file_t *file)
+{
+    int n = -1;
+    sscanf(file->name, file->type == RETRO_TYPE_FOLDER ? "Folder %d" : "Synthetic Game %d", &n);
+    return n;
+}
+
+// Synthetic folder in scandir order (which is no order at all), with a few subfolders
+static void make_files(int files_count)
+{
+    const char *folder = rg_unique_string(app.paths.roms);
+    char buffer[64];
+
+    app.files = calloc(files_count, sizeof(retro_file_t));
+    app.files_capacity = files_count;
+    for (int i = 0; i < files_count; i++)
+    {
+        int n = (i * 7919) % files_count;
+        bool is_folder = (n % 500) == 0;
+        snprintf(buffer, sizeof(buffer), is_folder ? "Folder %05d" : "Synthetic Game %05d (Rev %c).nes", n, 'A' + n % 3);
+        app.files[app.files_count++] = (retro_file_t){
+            .name = strdup(buffer),
+            .folder = folder,
+            .type = is_folder ? RETRO_TYPE_FOLDER : RETRO_TYPE_FILE,
+            .app = &app,
+        };
+    }
+}
+
+// One save for every fourth file, half of them in a numbered slot
+static void match_saves(int files_count)
+{
+    char buffer[64];
+    for (int i = 0; i < files_count; i += 4)
+    {
+        rg_scandir_t entry = {.basename = buffer, .is_file = true};
+        snprintf(buffer, sizeof(buffer), "Synthetic Game %05d (Rev %c).nes%s.sav", i, 'A' + i % 3, (i & 4) ? "-1" : "");
+        scan_saves_cb(&entry, &app);
+    }
+}
+
+// Folders first, then files, each by name without the extension
+static void check_order(const char *what, int direction)
+{
+    const listbox_t *list = &tab.listbox;
+    for (int i = 1; i < list->length; i++)
+    {
+        const listbox_item_t *a = &list->items[i - 1], *b = &list->items[i];
+        int ret = a->group != b->group ? a->group - b->group : strcasecmp(((retro_file_t *)a->arg)->name,
+                                                                           ((retro_file_t *)b->arg)->name) * direction;
+        CHECK(ret < 0, "%s: '%s' listed before '%s'", what, a->text, b->text);
+    }
+}
+
+static void test_lists(int files_count)
+{
+    int64_t start;
+    char label[96], expected[96];
+
+    make_files(files_count);
+
+    start = rg_system_timer();
+    qsort(app.files, app.files_count, sizeof(retro_file_t), files_comp);
+    double sort_time = elapsed_ms(start);
+
+    start = rg_system_timer();
+    CHECK(files_index_build(&app), "saves index: out of memory");
+    match_saves(files_count);
+    double saves_time = elapsed_ms(start);
+
+    int saves_found = 0;
+    for (size_t i = 0; i < app.files_count; i++)
+    {
+        int n = name_number(&app.files[i]);
+        int saves = app.files[i].type == RETRO_TYPE_FILE && n % 4 == 0;
+        CHECK(app.files[i].saves == saves, "'%s' has %d saves, expected %d", app.files[i].name,
+              app.files[i].saves, saves);
+        CHECK(application_find_file(&app, app.paths.roms, app.files[i].name) == &app.files[i],
+              "'%s' not found in the index", app.files[i].name);
+        saves_found += app.files[i].saves;
+    }
+
+    start = rg_system_timer();
+    tab_refresh(&tab, NULL);
+    double refresh_time = elapsed_ms(start);
+
+    CHECK(tab.listbox.length == files_count, "refresh: %d items, expected %d", tab.listbox.length, files_count);
+    check_order("refresh", 1);
+
+    gui_format_item(&tab.listbox, 0, label, sizeof(label));
+    CHECK(!strcmp(label, "[Folder 00000]"), "first item is '%s'", label);
+    gui_format_item(&tab.listbox, tab.listbox.length - 1, label, sizeof(label));
+    snprintf(expected, sizeof(expected), "Synthetic Game %05d (Rev %c)", files_count - 1, 'A' + (files_count - 1) % 3);
+    CHECK(!strcmp(label, expected), "last item is '%s', expected '%s'", label, expected);
+
+    // Already reversed, then shuffled
+    tab.listbox.sort_mode = SORT_TEXT_DESC;
+    gui_sort_list(&tab);
+    check_order("reversed", -1);
+    for (int i = tab.listbox.length - 1; i > 0; i--)
+    {
+        int j = rand() % (i + 1);
+        listbox_item_t temp = tab.listbox.items[i];
+        tab.listbox.items[i] = tab.listbox.items[j];
+        tab.listbox.items[j] = temp;
+    }
+    tab.listbox.sort_mode = SORT_TEXT_ASC;
+    gui_sort_list(&tab);
+    check_order("shuffled", 1);
+
+    start = rg_system_timer();
+    for (int i = 0; i < 1000; i++)
+    {
+        tab.listbox.cursor = (i * 97) % tab.listbox.length;
+        gui_draw_list(&tab);
+    }
+    double draw_time = elapsed_ms(start);
+
+    printf("%d files, %d saves\n", tab.listbox.length, saves_found);
+    printf("  sort: %.2fms, saves: %.2fms, refresh: %.2fms, list window: %.1fus\n", sort_time, saves_time,
+           refresh_time, draw_time);
+}
+
+int main(int argc, char **argv)
+{
+    int files_count = argc > 1 ? atoi(argv[1]) : 10000;
+
+    gui.width = SCREEN_WIDTH;
+    gui.height = SCREEN_HEIGHT;
+
+    test_lists(files_count);
+
+    if (failures)
+        printf("FAILED (%d)\n", failures);
+    return failures != 0;
+}
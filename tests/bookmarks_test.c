@@ -0,0 +1,315 @@
+/*
+** The launcher's bookmark log: round-trip through the file, recovery from a
+** truncated or corrupted log, import of the old .txt books and compaction.
+** The file includes bookmarks.c to reach the books directly; the GUI and the
+** application list are replaced by minimal versions below.
+**
+** Usage: bookmarks_test <work directory>, the books live in <work directory>/sd
+*/
+
+#include "bookmarks.c"
+
+#include <sys/stat.h>
+#include <unistd.h>
+#include <errno.h>
+
+#define FAVORITE_BIN RG_BASE_PATH_CONFIG "/favorite.bin"
+#define FAVORITE_TXT RG_BASE_PATH_CONFIG "/favorite.txt"
+
+retro_gui_t gui;
+static retro_app_t test_apps[2] = {
+    {.short_name = "nes", .paths.roms = RG_STORAGE_ROOT "/roms/nes"},
+    {.short_name = "gb", .paths.roms = RG_STORAGE_ROOT "/roms/gb"},
+};
+static int failures = 0;
+
+#define CHECK(cond, ...) if (!(cond)) { printf(__VA_ARGS__); printf("\n"); failures++; }
+
+bool application_path_to_file(const char *path, retro_file_t *file)
+{
+    for (size_t i = 0; i < RG_COUNT(test_apps); ++i)
+    {
+        size_t baselen = strlen(test_apps[i].paths.roms);
+        if (strncmp(path, test_apps[i].paths.roms, baselen) == 0 && path[baselen] == '/')
+        {
+            *file = (retro_file_t){
+                .name = rg_unique_string(rg_basename(path)),
+                .folder = rg_unique_string(rg_dirname(path)),
+                .type = RETRO_TYPE_FILE,
+                .app = &test_apps[i],
+            };
+            return true;
+        }
+    }
+    return false;
+}
+
+void application_show_file_menu(retro_file_t *file, bool simplified) {}
+
+tab_t *gui_add_tab(const char *name, const char *desc, void *arg, void *event_handler)
+{
+    tab_t *tab = calloc(1, sizeof(tab_t));
+    snprintf(tab->name, sizeof(tab->name), "%s", name);
+    tab->arg = arg;
+    return tab;
+}
+
+void gui_resize_list(tab_t *tab, int new_size)
+{
+    if (new_size > tab->listbox.capacity)
+    {
+        tab->listbox.items = realloc(tab->listbox.items, new_size * sizeof(listbox_item_t));
+        tab->listbox.capacity = new_size;
+    }
+    tab->listbox.length = new_size;
+}
+
+void gui_sort_list(tab_t *tab) {}
+void gui_set_list_message(tab_t *tab, int cursor, const char *format, ...) {}
+void gui_set_status(tab_t *tab, const char *left, const char *right) {}
+void gui_set_preview(tab_t *tab, rg_image_t *preview) {}
+void gui_load_preview(tab_t *tab) {}
+listbox_item_t *gui_get_selected_item(tab_t *tab) { return NULL; }
+
+bool rg_storage_mkdir(const char *dir)
+{
+    char parent[RG_PATH_MAX + 1];
+    snprintf(parent, sizeof(parent), "%s", rg_dirname(dir));
+    if (strcmp(parent, dir) != 0 && strcmp(parent, ".") != 0)
+        rg_storage_mkdir(parent);
+    return mkdir(dir, 0777) == 0 || errno == EEXIST;
+}
+
+bool rg_storage_read_file(const char *path, void **data_out, size_t *data_len, uint32_t flags)
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp)
+        return false;
+    fseek(fp, 0, SEEK_END);
+    size_t size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    void *data = malloc(size + 1);
+    bool success = fread(data, 1, size, fp) == size;
+    fclose(fp);
+    if (!success)
+        free(data);
+    *data_out = success ? data : NULL;
+    *data_len = success ? size : 0;
+    return success;
+}
+
+static void unload(book_type_t book_type)
+{
+    book_t *book = &books[book_type];
+    if (book->tab)
+        free(book->tab->listbox.items);
+    free(book->tab);
+    free((void *)book->name);
+    free((void *)book->path);
+    free(book->items);
+    free(book->hashes);
+    free(book->labels);
+    memset(book, 0, sizeof(book_t));
+}
+
+static void reload(void)
+{
+    unload(BOOK_TYPE_FAVORITE);
+    unload(BOOK_TYPE_RECENT);
+    bookmarks_init();
+}
+
+// The live items in book order, comma separated
+static const char *contents(book_type_t book_type)
+{
+    static char buffer[4096];
+    book_t *book = &books[book_type];
+    size_t pos = 0;
+
+    buffer[0] = 0;
+    for (size_t i = 0; i < book->capacity; i++)
+    {
+        if (book->items[i].type != RETRO_TYPE_INVALID && pos < sizeof(buffer))
+            pos += snprintf(buffer + pos, sizeof(buffer) - pos, "%s%s", pos ? "," : "", book->items[i].name);
+    }
+    return buffer;
+}
+
+static retro_file_t game(const char *system, const char *name)
+{
+    char path[RG_PATH_MAX + 1];
+    retro_file_t file;
+    snprintf(path, sizeof(path), RG_STORAGE_ROOT "/roms/%s/%s", system, name);
+    if (!application_path_to_file(path, &file))
+        abort();
+    return file;
+}
+
+static long file_size(const char *path)
+{
+    struct stat st;
+    return stat(path, &st) == 0 ? st.st_size : -1;
+}
+
+// Offset of record n in a file that holds one record per given file
+static long record_offset(const retro_file_t *files, size_t n)
+{
+    char path[RG_PATH_MAX + 1];
+    long offset = sizeof(book_header_t);
+    for (size_t i = 0; i < n; i++)
+    {
+        book_path_hash(&files[i], path);
+        offset += sizeof(book_record_t) + strlen(path);
+    }
+    return offset;
+}
+
+static void test_legacy_import(void)
+{
+    FILE *fp = fopen(FAVORITE_TXT, "w");
+    fprintf(fp, RG_STORAGE_ROOT "/roms/nes/old1.nes\r\n" RG_STORAGE_ROOT "/roms/gb/old2.gb\n/elsewhere/old3.nes\n");
+    fclose(fp);
+
+    reload();
+    CHECK(!strcmp(contents(BOOK_TYPE_FAVORITE), "old1.nes,old2.gb"), "import: got '%s'", contents(BOOK_TYPE_FAVORITE));
+    CHECK(books[BOOK_TYPE_FAVORITE].items[1].app == &test_apps[1], "import: wrong application");
+    CHECK(file_size(FAVORITE_BIN) > 0, "import: %s wasn't written", FAVORITE_BIN);
+
+    // The .txt is only read when there's no .bin
+    remove(FAVORITE_TXT);
+    reload();
+    CHECK(!strcmp(contents(BOOK_TYPE_FAVORITE), "old1.nes,old2.gb"), "import reload: got '%s'", contents(BOOK_TYPE_FAVORITE));
+}
+
+static void test_round_trip(void)
+{
+    const char *expected = "old1.nes,old2.gb,game1.nes,game3.nes,game4.nes,game0.nes";
+    char name[32];
+
+    for (int i = 0; i < 5; i++)
+    {
+        sprintf(name, "game%d.nes", i);
+        retro_file_t file = game("nes", name);
+        bookmark_add(BOOK_TYPE_FAVORITE, &file);
+    }
+    retro_file_t removed = game("nes", "game2.nes");
+    retro_file_t moved = game("nes", "game0.nes");
+    CHECK(bookmark_remove(BOOK_TYPE_FAVORITE, &removed), "round trip: remove failed");
+    CHECK(!bookmark_remove(BOOK_TYPE_FAVORITE, &removed), "round trip: removed twice");
+    bookmark_add(BOOK_TYPE_FAVORITE, &moved);
+    CHECK(!bookmark_exists(BOOK_TYPE_FAVORITE, &removed) && bookmark_exists(BOOK_TYPE_FAVORITE, &moved),
+          "round trip: bookmark_exists is wrong");
+
+    CHECK(!strcmp(contents(BOOK_TYPE_FAVORITE), expected), "round trip: live '%s'", contents(BOOK_TYPE_FAVORITE));
+    reload();
+    CHECK(!strcmp(contents(BOOK_TYPE_FAVORITE), expected), "round trip: reloaded '%s'", contents(BOOK_TYPE_FAVORITE));
+    CHECK(books[BOOK_TYPE_FAVORITE].tab->listbox.length == 6, "round trip: %d list items", books[BOOK_TYPE_FAVORITE].tab->listbox.length);
+
+    // Recent is bounded, the oldest entries go first
+    for (int i = 0; i < 120; i++)
+    {
+        sprintf(name, "game%d.nes", i);
+        retro_file_t file = game("nes", name);
+        bookmark_add(BOOK_TYPE_RECENT, &file);
+    }
+    reload();
+    retro_file_t *last = bookmark_find_by_app(BOOK_TYPE_RECENT, &test_apps[0]);
+    CHECK(books[BOOK_TYPE_RECENT].count == 100, "recent: %d items", (int)books[BOOK_TYPE_RECENT].count);
+    CHECK(!strncmp(contents(BOOK_TYPE_RECENT), "game20.nes,", 11), "recent: starts with '%.20s'", contents(BOOK_TYPE_RECENT));
+    CHECK(last && !strcmp(last->name, "game119.nes"), "recent: last is %s", last ? last->name : "none");
+    CHECK(!bookmark_find_by_app(BOOK_TYPE_RECENT, &test_apps[1]), "recent: found a gb game");
+}
+
+static void test_truncated(void)
+{
+    // The last record is the second add of game0, without it game0 is back at its first position
+    CHECK(truncate(FAVORITE_BIN, file_size(FAVORITE_BIN) - 5) == 0, "truncate failed");
+    reload();
+    CHECK(!strcmp(contents(BOOK_TYPE_FAVORITE), "old1.nes,old2.gb,game0.nes,game1.nes,game3.nes,game4.nes"),
+          "truncated: got '%s'", contents(BOOK_TYPE_FAVORITE));
+
+    // The damaged log was replaced by a compact one
+    retro_file_t files[6];
+    for (size_t i = 0; i < 6; i++)
+        files[i] = books[BOOK_TYPE_FAVORITE].items[i];
+    CHECK(file_size(FAVORITE_BIN) == record_offset(files, 6), "truncated: file is %ld bytes, expected %ld",
+          file_size(FAVORITE_BIN), record_offset(files, 6));
+}
+
+static void test_bad_crc(void)
+{
+    retro_file_t files[6];
+    for (size_t i = 0; i < 6; i++)
+        files[i] = books[BOOK_TYPE_FAVORITE].items[i];
+
+    // Damage the path of the fourth record, only the first three survive
+    FILE *fp = fopen(FAVORITE_BIN, "r+b");
+    fseek(fp, record_offset(files, 3) + sizeof(book_record_t) + 2, SEEK_SET);
+    fputc('X', fp);
+    fclose(fp);
+
+    reload();
+    CHECK(!strcmp(contents(BOOK_TYPE_FAVORITE), "old1.nes,old2.gb,game0.nes"), "bad crc: got '%s'", contents(BOOK_TYPE_FAVORITE));
+    CHECK(file_size(FAVORITE_BIN) == record_offset(files, 3), "bad crc: file is %ld bytes", file_size(FAVORITE_BIN));
+
+    // A bad header drops the whole book
+    fp = fopen(FAVORITE_BIN, "r+b");
+    fputc(0, fp);
+    fclose(fp);
+    reload();
+    CHECK(books[BOOK_TYPE_FAVORITE].count == 0, "bad header: %d items", (int)books[BOOK_TYPE_FAVORITE].count);
+}
+
+static void test_compaction(void)
+{
+    long largest = 0;
+    char name[32];
+
+    for (int i = 0; i < 1000; i++)
+    {
+        sprintf(name, "game%d.nes", i % 7);
+        retro_file_t file = game("nes", name);
+        if (i & 1)
+            bookmark_remove(BOOK_TYPE_FAVORITE, &file);
+        else
+            bookmark_add(BOOK_TYPE_FAVORITE, &file);
+        largest = RG_MAX(largest, file_size(FAVORITE_BIN));
+
+        book_t *book = &books[BOOK_TYPE_FAVORITE];
+        CHECK(book->records <= book->count * 2 + 33, "compaction: %d records for %d items", (int)book->records, (int)book->count);
+    }
+
+    // 1000 records of ~30 bytes would be 30KB, the log is compacted well before that
+    CHECK(largest < 3000, "compaction: file reached %ld bytes", largest);
+
+    char expected[sizeof(((book_t *)0)->labels[0]) * 8];
+    snprintf(expected, sizeof(expected), "%s", contents(BOOK_TYPE_FAVORITE));
+    reload();
+    CHECK(!strcmp(contents(BOOK_TYPE_FAVORITE), expected), "compaction: reloaded '%s', expected '%s'",
+          contents(BOOK_TYPE_FAVORITE), expected);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2 || chdir(argv[1]) != 0)
+    {
+        printf("usage: %s <work directory>\n", argv[0]);
+        return 1;
+    }
+
+    remove(FAVORITE_BIN);
+    remove(RG_BASE_PATH_CONFIG "/recent.bin");
+    rg_storage_mkdir(RG_BASE_PATH_CONFIG);
+
+    test_legacy_import();
+    test_round_trip();
+    test_truncated();
+    test_bad_crc();
+    test_compaction();
+
+    unload(BOOK_TYPE_FAVORITE);
+    unload(BOOK_TYPE_RECENT);
+
+    printf(failures ? "FAILED (%d)\n" : "OK\n", failures);
+    return failures != 0;
+}
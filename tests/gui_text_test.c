@@ -0,0 +1,235 @@
+/*
+** rg_gui_draw_text checks and throughput.
+**
+** Every glyph of every font, at both heights, and random strings are drawn to
+** a host surface and compared with a renderer that unpacks each glyph through
+** get_glyph() like rg_gui_draw_text did before the glyph atlas. The file
+** includes rg_gui.c to reach the font code; everything rg_gui.c needs from
+** the rest of the system is replaced by the minimal versions below.
+*/
+
+#include "rg_gui.c"
+
+#define SCREEN_WIDTH 320
+#define SCREEN_HEIGHT 240
+#define COLOR_FG 0xFFFF
+#define COLOR_BG 0x0841
+
+static uint16_t screen[SCREEN_WIDTH * SCREEN_HEIGHT];
+static uint16_t expected[SCREEN_WIDTH * 40];
+static uint32_t seed = 0x12345678;
+static int failures = 0;
+
+#define CHECK(cond, ...) if (!(cond)) { printf(__VA_ARGS__); printf("\n"); if (++failures > 20) exit(1); }
+
+const rg_audio_sink_t *rg_audio_get_sink(void) { return NULL; }
+const rg_audio_sink_t *rg_audio_get_sinks(size_t *count) { *count = 0; return NULL; }
+int rg_audio_get_volume(void) { return 0; }
+void rg_audio_set_mute(bool mute) {}
+void rg_audio_set_sink(const char *driver_name, int device) {}
+void rg_audio_set_volume(int percent) {}
+void rg_display_force_redraw(void) {}
+display_backlight_t rg_display_get_backlight(void) { return 0; }
+char *rg_display_get_border(void) { return NULL; }
+rg_display_counters_t rg_display_get_counters(void) { return (rg_display_counters_t){0}; }
+double rg_display_get_custom_zoom(void) { return 1.0; }
+display_filter_t rg_display_get_filter(void) { return 0; }
+display_scaling_t rg_display_get_scaling(void) { return 0; }
+const rg_display_t *rg_display_get_info(void) { static rg_display_t display; return &display; }
+void rg_display_set_backlight(display_backlight_t percent) {}
+void rg_display_set_border(const char *filename) {}
+void rg_display_set_custom_zoom(double factor) {}
+void rg_display_set_filter(display_filter_t filter) {}
+void rg_display_set_scaling(display_scaling_t scaling) {}
+void rg_display_set_osd(const rg_surface_t *surface, int left, int top) {}
+bool rg_display_sync(bool block) { return true; }
+void rg_display_write(int left, int top, int width, int height, int stride, const uint16_t *buffer, uint32_t flags) {}
+float rg_emu_get_speed(void) { return 1.f; }
+rg_emu_states_t *rg_emu_get_states(const char *romPath, size_t slots) { return NULL; }
+bool rg_emu_load_state(uint8_t slot) { return false; }
+bool rg_emu_save_state(uint8_t slot) { return false; }
+bool rg_emu_reset(bool hard) { return false; }
+bool rg_emu_screenshot(const char *filename, int width, int height) { return false; }
+void rg_emu_set_speed(float speed) {}
+const char *rg_input_get_key_mapping(rg_key_t key) { return NULL; }
+rg_battery_t rg_input_read_battery(void) { return (rg_battery_t){0}; }
+bool rg_input_read_battery_raw(rg_battery_t *out) { return false; }
+uint32_t rg_input_read_gamepad(void) { return 0; }
+bool rg_input_wait_for_key(rg_key_t mask, bool pressed, int timeout_ms) { return true; }
+rg_network_t rg_network_get_info(void) { return (rg_network_t){0}; }
+void rg_settings_commit(void) {}
+double rg_settings_get_number(const char *section, const char *key, double default_value) { return default_value; }
+char *rg_settings_get_string(const char *section, const char *key, const char *default_value) { return default_value ? strdup(default_value) : NULL; }
+void rg_settings_reset(void) {}
+void rg_settings_set_number(const char *section, const char *key, double value) {}
+void rg_settings_set_string(const char *section, const char *key, const char *value) {}
+bool rg_storage_delete(const char *path) { return false; }
+bool rg_storage_read_file(const char *path, void **data_out, size_t *data_len, uint32_t flags) { return false; }
+bool rg_storage_scandir(const char *path, rg_scandir_cb_t *callback, void *arg, uint32_t flags) { return false; }
+void rg_system_exit(void) { abort(); }
+rg_app_t *rg_system_get_app(void) { return NULL; }
+rg_stats_t rg_system_get_counters(void) { return (rg_stats_t){0}; }
+int rg_system_get_overclock(void) { return 0; }
+char *rg_system_get_timezone(void) { return NULL; }
+void rg_system_restart(void) { abort(); }
+bool rg_system_save_trace(const char *filename, bool append) { return false; }
+void rg_system_set_log_level(rg_log_level_t level) {}
+void rg_system_set_overclock(int level) {}
+void rg_system_set_timezone(const char *TZ) {}
+void rg_system_switch_app(const char *part, const char *name, const char *args, uint32_t flags) { abort(); }
+void rg_system_tick(int busyTime) {}
+
+static uint32_t rand32(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+// One line of text at the top left of a draw_width wide box, unpacking each glyph as it goes
+static int reference_text(uint16_t *output, const char *text, uint32_t flags)
+{
+    const rg_font_t *font = gui.style.font;
+    int padding = (flags & RG_TEXT_NO_PADDING) ? 0 : 1;
+    int font_height = (flags & RG_TEXT_BIGGER) ? gui.style.font_height * 2 : gui.style.font_height;
+    int monospace = ((flags & RG_TEXT_MONOSPACE) || font->type == 0) ? gui.style.font_width : 0;
+    int line_height = font_height + padding * 2;
+    int draw_width = padding * 2;
+
+    for (const char *ptr = text; *ptr; ptr++)
+        draw_width += monospace ?: get_glyph(NULL, font, font_height, *ptr);
+    draw_width = RG_MIN(draw_width, SCREEN_WIDTH);
+
+    for (int i = 0; i < draw_width * line_height; i++)
+        output[i] = COLOR_BG;
+
+    int x_offset = padding;
+    for (const char *ptr = text; *ptr && x_offset < draw_width; ptr++)
+    {
+        uint32_t bitmap[32] = {0};
+        int glyph_width = get_glyph(bitmap, font, font_height, *ptr);
+        int width = monospace ?: glyph_width;
+
+        if (draw_width - x_offset < width)
+            break;
+
+        for (int y = 0; y < font_height; y++)
+            for (int x = 0; x < width; x++)
+                output[draw_width * (y + padding) + x_offset + x] = (bitmap[y] & (1 << x)) ? COLOR_FG : COLOR_BG;
+
+        x_offset += width;
+    }
+
+    return draw_width;
+}
+
+static void check_text(const char *text, uint32_t flags, const char *what)
+{
+    int draw_width = reference_text(expected, text, flags);
+    rg_rect_t rect = rg_gui_draw_text(0, 0, 0, text, COLOR_FG, COLOR_BG, flags);
+
+    CHECK(rect.width == draw_width, "font %d, %s: width %d, expected %d", gui.font_index, what, rect.width, draw_width);
+
+    for (int y = 0; y < rect.height && failures <= 20; y++)
+        for (int x = 0; x < draw_width; x++)
+            CHECK(screen[y * SCREEN_WIDTH + x] == expected[y * draw_width + x], "font %d, %s: pixel %d,%d is %04X, expected %04X",
+                  gui.font_index, what, x, y, screen[y * SCREEN_WIDTH + x], expected[y * draw_width + x]);
+}
+
+static void test_glyphs(void)
+{
+    const uint32_t flags[] = {RG_TEXT_NO_PADDING, RG_TEXT_NO_PADDING | RG_TEXT_BIGGER, RG_TEXT_MONOSPACE};
+    char text[2] = {0};
+    char what[64];
+
+    for (int font = 0; font < RG_FONT_MAX; font++)
+    {
+        rg_gui_set_font(font);
+        for (int f = 0; f < RG_COUNT(flags); f++)
+        {
+            for (int c = 1; c < 256; c++)
+            {
+                text[0] = c;
+                snprintf(what, sizeof(what), "flags %02X, glyph %d", (int)flags[f], c);
+                check_text(text, flags[f], what);
+            }
+        }
+    }
+}
+
+static void test_strings(void)
+{
+    const uint32_t flags[] = {0, RG_TEXT_NO_PADDING, RG_TEXT_BIGGER, RG_TEXT_MONOSPACE};
+    char text[48];
+    char what[64];
+
+    for (int round = 0; round < 4000; round++)
+    {
+        size_t length = 1 + rand32() % (sizeof(text) - 1);
+        for (size_t i = 0; i < length; i++)
+            text[i] = (rand32() & 3) ? 32 + rand32() % 95 : 1 + rand32() % 255;
+        text[length] = 0;
+        for (char *nl = strchr(text, '\n'); nl; nl = strchr(nl, '\n'))
+            *nl = ' ';
+
+        rg_gui_set_font(round % RG_FONT_MAX);
+        snprintf(what, sizeof(what), "flags %02X, string of %d", (int)flags[round % 4], (int)strlen(text));
+        check_text(text, flags[round % 4], what);
+    }
+}
+
+// A screen of file list entries, the way the launcher redraws it for every cursor move
+static void bench(int font)
+{
+    static const char *names[] = {
+        "Super Mario Bros. 3 (USA).nes", "Legend of Zelda, The - A Link to the Past (USA).sfc",
+        "Sonic The Hedgehog 2 (World).md", "Pokemon - Crystal Version (USA, Europe).gbc",
+        "Metroid (Europe).nes", "Kirby's Dream Land (USA, Europe).gb", "Tetris (World).gb",
+    };
+    uint16_t line[SCREEN_WIDTH * 40];
+    struct timespec t0, t1;
+    double atlas_secs = 0, unpack_secs = 0;
+    int screens = 0;
+
+    rg_gui_set_font(font);
+    do
+    {
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (int y = 0; y < SCREEN_HEIGHT - 32; y += gui.style.font_height + 2)
+            rg_gui_draw_text(0, y, SCREEN_WIDTH, names[(y + screens) % RG_COUNT(names)], COLOR_FG, COLOR_BG, 0);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        atlas_secs += (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (int y = 0; y < SCREEN_HEIGHT - 32; y += gui.style.font_height + 2)
+            rg_gui_copy_buffer(0, y, reference_text(line, names[(y + screens) % RG_COUNT(names)], 0),
+                               gui.style.font_height + 2, 0, line);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        unpack_secs += (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+        screens++;
+    } while (atlas_secs + unpack_secs < 0.4);
+
+    printf("  font %d: %6.1f us per list with the atlas, %6.1f us unpacking glyphs\n", font,
+           atlas_secs * 1e6 / screens, unpack_secs * 1e6 / screens);
+}
+
+int main(int argc, char **argv)
+{
+    gui.screen_width = SCREEN_WIDTH;
+    gui.screen_height = SCREEN_HEIGHT;
+    rg_gui_set_surface(&(rg_surface_t){SCREEN_WIDTH, SCREEN_HEIGHT, .data = screen});
+    get_draw_buffer(SCREEN_WIDTH, 40, C_BLACK);
+
+    test_glyphs();
+    test_strings();
+
+    printf("file list redraw, %dx%d:\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    for (int font = 0; font < RG_FONT_MAX; font++)
+        bench(font);
+
+    if (failures)
+        printf("FAILED (%d)\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,208 @@
+/*
+** M68K dispatch benchmark
+**
+** Runs synthetic 68000 programs through gwenesis' m68k_run and reports
+** emulated MHz. run_tests.sh builds it once per opcode table layout (flat and
+** compact, see M68K_COMPACT_JUMP_TABLE). Two programs are run:
+**  - tight: a short loop over a handful of opcodes, the tables stay cached
+**  - wide:  a long straight-line run of register and (An)+ instructions with
+**           random registers and sizes, thousands of distinct opcodes
+** Every build variant must print the same checksums. The file includes
+** m68kcpu.c to reach the CPU state.
+*/
+
+#include "m68kcpu.c"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define FRAME_CYCLES (7 * 128000) /* One NTSC frame of 68000 time, in master cycles */
+#define BENCH_FRAMES 600
+
+unsigned char M68K_RAM[0x10000];
+unsigned char *ROM_DATA;
+
+static uint16_t rom[0x20000]; /* 256KB, stored as native 16-bit words like gwenesis' byte-swapped ROM */
+static unsigned rnd_state = 1;
+
+unsigned int m68k_read_memory_8(unsigned int address)
+{
+    return address >= 0xFF0000 ? FETCH8RAM(address) : FETCH8ROM(address % sizeof(rom));
+}
+
+unsigned int m68k_read_memory_16(unsigned int address)
+{
+    return address >= 0xFF0000 ? FETCH16RAM(address) : FETCH16ROM(address % sizeof(rom));
+}
+
+unsigned int m68k_read_memory_32(unsigned int address)
+{
+    return m68k_read_memory_16(address) << 16 | m68k_read_memory_16(address + 2);
+}
+
+void m68k_write_memory_8(unsigned int address, unsigned int value)
+{
+    if (address >= 0xFF0000)
+        WRITE8RAM(address, value);
+}
+
+void m68k_write_memory_16(unsigned int address, unsigned int value)
+{
+    if (address >= 0xFF0000)
+        WRITE16RAM(address, value);
+}
+
+void m68k_write_memory_32(unsigned int address, unsigned int value)
+{
+    m68k_write_memory_16(address, value >> 16);
+    m68k_write_memory_16(address + 2, value);
+}
+
+SaveState *saveGwenesisStateOpenForRead(const char *fileName) { return NULL; }
+SaveState *saveGwenesisStateOpenForWrite(const char *fileName) { return NULL; }
+int saveGwenesisStateGet(SaveState *state, const char *tagName) { return 0; }
+void saveGwenesisStateSet(SaveState *state, const char *tagName, int value) {}
+void saveGwenesisStateGetBuffer(SaveState *state, const char *tagName, void *buffer, int length) {}
+void saveGwenesisStateSetBuffer(SaveState *state, const char *tagName, void *buffer, int length) {}
+
+static unsigned rnd(unsigned range)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return (rnd_state >> 8) % range;
+}
+
+/* One-word instructions that only touch data registers, or memory through A0-A3 */
+static uint16_t random_instruction(int templates, int regs)
+{
+    static const int move_sizes[] = {1, 3, 2}; /* .b .w .l */
+    int s = rnd(3), q = rnd(8), x = rnd(regs), y = rnd(regs), a = rnd(4);
+
+    switch (rnd(templates))
+    {
+    case 0:  return 0x0000 | move_sizes[s] << 12 | x << 9 | y;             /* MOVE Dy,Dx */
+    case 1:  return 0xD000 | x << 9 | s << 6 | y;                          /* ADD Dy,Dx */
+    case 2:  return 0x5000 | q << 9 | s << 6 | x;                          /* ADDQ #q,Dx */
+    case 3:  return 0x7000 | x << 9 | rnd(256);                            /* MOVEQ #n,Dx */
+    case 4:  return 0xB000 | x << 9 | s << 6 | y;                          /* CMP Dy,Dx */
+    case 5:  return 0xE000 | q << 9 | rnd(2) << 8 | s << 6 | rnd(4) << 3 | x; /* shift/rotate #q,Dx */
+    case 6:  return 0x9000 | x << 9 | s << 6 | y;                          /* SUB Dy,Dx */
+    case 7:  return 0xC000 | x << 9 | s << 6 | y;                          /* AND Dy,Dx */
+    case 8:  return 0x2000 | 3 << 6 | y << 9 | a;                          /* MOVE.l (Aa)+,Dy */
+    case 9:  return 0x3000 | a << 9 | 3 << 6 | y;                          /* MOVE.w Dy,(Aa)+ */
+    case 10: return 0x8000 | x << 9 | s << 6 | y;                          /* OR Dy,Dx */
+    case 11: return 0xB100 | y << 9 | s << 6 | x;                          /* EOR Dy,Dx */
+    case 12: return 0x5100 | q << 9 | s << 6 | x;                          /* SUBQ #q,Dx */
+    case 13: return 0xE020 | y << 9 | rnd(2) << 8 | s << 6 | rnd(4) << 3 | x; /* shift/rotate Dy,Dx */
+    case 14: return (rnd(2) ? 0xC0C0 : 0xC1C0) | x << 9 | y;               /* MULU/MULS Dy,Dx */
+    case 15: return 0x4840 | x;                                            /* SWAP Dx */
+    case 16: return (rnd(2) ? 0x4880 : 0x48C0) | x;                        /* EXT.w/.l Dx */
+    case 17: return (0x4200 + rnd(4) * 0x200) | s << 6 | x;               /* CLR/NEG/NOT/... Dx */
+    case 18: return 0x4A00 | s << 6 | x;                                   /* TST Dx */
+    case 19: return 0x0100 | rnd(4) << 6 | y << 9 | x;                     /* BTST/BCHG/BCLR/BSET Dy,Dx */
+    case 20: return 0xC140 | x << 9 | y;                                   /* EXG Dx,Dy */
+    case 21: return (rnd(2) ? 0xD100 : 0x9100) | x << 9 | s << 6 | y;      /* ADDX/SUBX Dy,Dx */
+    case 22: return (rnd(2) ? 0xC100 : 0x8100) | x << 9 | y;               /* ABCD/SBCD Dy,Dx */
+    case 23: return 0x2000 | a << 9 | 2 << 6 | y;                          /* MOVE.l Dy,(Aa) */
+    default: return 0x4E71;                                                /* NOP */
+    }
+}
+
+/* Reset vectors, then a loop: point A0-A3 into RAM, run the body, jump back */
+static int build_program(int length, int templates, int regs)
+{
+    static bool seen[0x10000];
+    uint16_t *p = rom + 0x100;
+    int distinct = 0;
+
+    memset(rom, 0, sizeof(rom));
+    memset(seen, 0, sizeof(seen));
+    rom[0] = 0x00FF, rom[1] = 0xFF00; /* SSP */
+    rom[2] = 0x0000, rom[3] = 0x0200; /* PC */
+
+    for (int a = 0; a < 4; a++)
+    {
+        *p++ = 0x207C | a << 9; /* MOVEA.l #addr,Aa */
+        *p++ = 0x00FF;
+        *p++ = 0x1000 * (a + 1);
+    }
+    for (int i = 0; i < length; i++)
+    {
+        uint16_t op = random_instruction(templates, regs);
+        if (m68ki_instruction_handler(op) == m68k_op_illegal)
+        {
+            printf("generated illegal opcode %04X\n", op);
+            exit(1);
+        }
+        distinct += !seen[op];
+        seen[op] = true;
+        *p++ = op;
+    }
+    *p++ = 0x4EF9; /* JMP $000200 */
+    *p++ = 0x0000;
+    *p++ = 0x0200;
+
+    return distinct;
+}
+
+static uint32_t checksum(void)
+{
+    uint32_t hash = 0;
+    for (int i = 0; i < 16; i++)
+        hash = hash * 31 + REG_DA[i];
+    hash = hash * 31 + m68ki_get_sr();
+    for (int i = 0; i < 0x10000; i++)
+        hash = hash * 31 + M68K_RAM[i];
+    return hash;
+}
+
+/* Table contents: cycles and legality of every opcode the flat table covers */
+static uint32_t table_checksum(void)
+{
+    uint32_t hash = 0;
+    for (int op = 0; op < 0xEFC0; op++)
+        hash = hash * 31 + CYC_INSTRUCTION(op) * 2 + (m68ki_instruction_handler(op) == m68k_op_illegal);
+    return hash;
+}
+
+static void bench(const char *variant, const char *name, int length, int templates, int regs, int frames)
+{
+    struct timespec t0, t1;
+    uint64_t cycles = 0;
+
+    rnd_state = 1;
+    int distinct = build_program(length, templates, regs);
+    memset(M68K_RAM, 0, sizeof(M68K_RAM));
+    m68k_init();
+    m68k_pulse_reset();
+    m68k.cycles = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < frames; i++)
+    {
+        m68k_run(FRAME_CYCLES);
+        cycles += FRAME_CYCLES;
+        m68k.cycles -= FRAME_CYCLES;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+    printf("%-8s %-6s %5d opcodes %8.2f MHz  checksum %08X\n", variant, name, distinct,
+        cycles / MUL / secs / 1e6, checksum());
+}
+
+int main(int argc, char **argv)
+{
+    int frames = argc > 1 ? atoi(argv[1]) : BENCH_FRAMES;
+    const char *variant = argc > 2 ? argv[2] : "m68k";
+
+    ROM_DATA = (unsigned char *)rom;
+
+    printf("%-8s tables        checksum %08X\n", variant, table_checksum());
+    bench(variant, "tight", 64, 8, 4, frames);
+    bench(variant, "wide", 40000, 25, 8, frames);
+
+    return 0;
+}
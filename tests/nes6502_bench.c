@@ -0,0 +1,177 @@
+/*
+** nes6502 dispatch benchmark
+**
+** Runs a small synthetic program through nofrendo's nes6502_execute and
+** reports emulated MHz. The program exercises the paths the PRG block cache
+** has to get right: a switchable bank at $8000 that is swapped before each
+** call into it, and a routine copied to PRG-RAM at $6000 that patches its own
+** next instruction. Every build variant must print the same checksum.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nes/nes.h"
+
+#define FRAME_CYCLES 29781
+#define BENCH_FRAMES 20000
+
+static uint8 ram[0x800];
+static uint8 prg_ram[0x2000];
+static uint8 prg_rom[5][0x4000];
+static uint8 dummy[MEM_PAGESIZE];
+static uint8 *pages[MEM_PAGECOUNT];
+
+void mem_setpage(uint32 page, uint8 *ptr)
+{
+   nes6502_invalidate(page);
+   pages[page] = (ptr ? ptr : dummy) - (page * MEM_PAGESIZE);
+}
+
+uint8 mem_getbyte(uint32 address)
+{
+   if (address < 0x2000)
+      return ram[address & 0x7FF];
+   if (address >= 0x6000)
+      return pages[address >> MEM_PAGESHIFT][address];
+   return 0xFF;
+}
+
+uint32 mem_getword(uint32 address)
+{
+   return mem_getbyte(address + 1) << 8 | mem_getbyte(address);
+}
+
+/* $6000-$7FFF is PRG-RAM, a write at $8000 and up selects the bank at $8000 */
+void mem_putbyte(uint32 address, uint8 value)
+{
+   if (address >= 0x8000)
+   {
+      for (int i = 0; i < 8; i++)
+         mem_setpage(0x10 + i, &prg_rom[value & 3][i * MEM_PAGESIZE]);
+   }
+   else if (address >= 0x6000)
+   {
+      prg_ram[address - 0x6000] = value;
+      nes6502_invalidate(address >> MEM_PAGESHIFT);
+   }
+}
+
+static void build_rom(void)
+{
+   /* Fixed bank at $C000 */
+   static const uint8 main_code[] = {
+      0xA2, 0xFF,             /* $C000  LDX #$FF         */
+      0x9A,                   /* $C002  TXS              */
+      0xA0, 0x00,             /* $C003  LDY #$00         */
+      0xB9, 0x00, 0xC1,       /* $C005  LDA $C100,Y      */
+      0x99, 0x00, 0x60,       /* $C008  STA $6000,Y      */
+      0xC8,                   /* $C00B  INY              */
+      0xC0, 0x10,             /* $C00C  CPY #$10         */
+      0xD0, 0xF5,             /* $C00E  BNE $C005        */
+      0xA5, 0x10,             /* $C010  LDA $10          */
+      0x29, 0x03,             /* $C012  AND #$03         */
+      0x8D, 0x00, 0x80,       /* $C014  STA $8000        */
+      0x20, 0x00, 0x80,       /* $C017  JSR $8000        */
+      0xE6, 0x10,             /* $C01A  INC $10          */
+      0xA5, 0x10,             /* $C01C  LDA $10          */
+      0x20, 0x00, 0x60,       /* $C01E  JSR $6000        */
+      0xA2, 0x00,             /* $C021  LDX #$00         */
+      0xBD, 0x00, 0xC2,       /* $C023  LDA $C200,X      */
+      0x18,                   /* $C026  CLC              */
+      0x65, 0x11,             /* $C027  ADC $11          */
+      0x85, 0x11,             /* $C029  STA $11          */
+      0x45, 0x12,             /* $C02B  EOR $12          */
+      0x2A,                   /* $C02D  ROL A            */
+      0x85, 0x12,             /* $C02E  STA $12          */
+      0xE8,                   /* $C030  INX              */
+      0xD0, 0xF0,             /* $C031  BNE $C023        */
+      0x4C, 0x10, 0xC0,       /* $C033  JMP $C010        */
+   };
+   /* Copied to $6000, stores A into the operand of the LDA that follows */
+   static const uint8 ram_code[] = {
+      0x8D, 0x04, 0x60,       /* $6000  STA $6004        */
+      0xA9, 0x00,             /* $6003  LDA #$00         */
+      0x18,                   /* $6005  CLC              */
+      0x65, 0x15,             /* $6006  ADC $15          */
+      0x85, 0x15,             /* $6008  STA $15          */
+      0x60,                   /* $600A  RTS              */
+   };
+
+   uint8 *fixed = prg_rom[4];
+
+   memcpy(fixed, main_code, sizeof(main_code));
+   memcpy(fixed + 0x100, ram_code, sizeof(ram_code));
+   for (int i = 0; i < 256; i++)
+      fixed[0x200 + i] = (uint8)(i * 73 + 11);
+   fixed[0x3FFC] = 0x00; /* RESET vector: $C000 */
+   fixed[0x3FFD] = 0xC0;
+
+   /* Switchable banks at $8000, each one mixes in its own constants */
+   for (int bank = 0; bank < 4; bank++)
+   {
+      const uint8 code[] = {
+         0x18,                               /* CLC       */
+         0xA5, 0x13,                         /* LDA $13   */
+         0x69, (uint8)(bank * 37 + 1),       /* ADC #nn   */
+         0x85, 0x13,                         /* STA $13   */
+         0xA5, 0x14,                         /* LDA $14   */
+         0x49, (uint8)(bank + 0x5A),         /* EOR #nn   */
+         0x85, 0x14,                         /* STA $14   */
+         0x60,                               /* RTS       */
+      };
+      memcpy(prg_rom[bank], code, sizeof(code));
+   }
+}
+
+int main(int argc, char **argv)
+{
+   int frames = argc > 1 ? atoi(argv[1]) : BENCH_FRAMES;
+   struct timespec t0, t1;
+   uint32 checksum = 0;
+
+   build_rom();
+
+   for (int i = 0; i < MEM_PAGECOUNT; i++)
+      mem_setpage(i, NULL);
+   for (int i = 0; i < 4; i++)
+      mem_setpage(i, ram);
+   for (int i = 0; i < 4; i++)
+      mem_setpage(0x0C + i, &prg_ram[i * MEM_PAGESIZE]);
+   for (int i = 0; i < 8; i++)
+   {
+      mem_setpage(0x10 + i, &prg_rom[0][i * MEM_PAGESIZE]);
+      mem_setpage(0x18 + i, &prg_rom[4][i * MEM_PAGESIZE]);
+   }
+
+   nes6502_t *cpu = nes6502_init(pages);
+   if (!cpu)
+   {
+      printf("nes6502_init failed\n");
+      return 1;
+   }
+   nes6502_reset();
+
+   clock_gettime(CLOCK_MONOTONIC, &t0);
+   for (int i = 0; i < frames; i++)
+      nes6502_execute(FRAME_CYCLES);
+   clock_gettime(CLOCK_MONOTONIC, &t1);
+
+   double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+   for (int i = 0x10; i < 0x16; i++)
+      checksum = checksum * 31 + ram[i];
+   checksum = checksum * 31 + cpu->a_reg;
+   checksum = checksum * 31 + cpu->x_reg;
+   checksum = checksum * 31 + cpu->pc_reg;
+   checksum = checksum * 31 + (uint32)nes6502_getcycles();
+
+   printf("%-24s %8.2f MHz  checksum %08X\n", argc > 2 ? argv[2] : "nes6502",
+      nes6502_getcycles() / secs / 1e6, checksum);
+
+   nes6502_shutdown();
+
+   return 0;
+}
@@ -0,0 +1,181 @@
+/*
+** rg_pool_alloc/rg_pool_free: replays an allocation trace shaped like the
+** emulators' transient buffers (file I/O, decompression, drawing) and checks
+** pool_used, pool_peak, pool_slack and pool_cached against a model after every
+** step, plus the block contents and alignment. Then several threads hammer
+** rg_alloc to check that its counters don't lose updates. The file includes
+** rg_utils.c to look at the pool.
+*/
+
+#include "rg_utils.c"
+
+#include <pthread.h>
+
+#define SLOTS 64
+#define STEPS 200000
+#define THREADS 4
+#define THREAD_ALLOCS 20000
+
+typedef struct
+{
+    uint8_t *ptr;
+    size_t size;
+    uint32_t caps;
+    uint8_t fill;
+} slot_t;
+
+static slot_t slots[SLOTS];
+static size_t model_used[4], model_peak[4], model_slack[4];
+static uint32_t seed = 0x12345678;
+static int failures = 0;
+
+#define CHECK(cond, ...) if (!(cond)) { printf(__VA_ARGS__); printf("\n"); if (++failures > 20) exit(1); }
+
+static uint32_t rand32(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+// Mostly a few fixed buffer sizes, some odd ones and the occasional block too big for any class
+static size_t trace_size(void)
+{
+    static const size_t common[] = {512, 2048, 4096, 8192, 16384, 32768, 65536};
+    uint32_t r = rand32() % 100;
+    if (r < 60)
+        return common[rand32() % RG_COUNT(common)];
+    if (r < 95)
+        return 1 + rand32() % 40000;
+    return 65537 + rand32() % 100000;
+}
+
+static size_t class_slack(size_t size)
+{
+    for (int class = 0; class < POOL_CLASSES; class++)
+        if (size <= (1u << (class + POOL_MIN_SHIFT)))
+            return (1u << (class + POOL_MIN_SHIFT)) - size;
+    return 0;
+}
+
+static void check_stats(int step)
+{
+    for (int kind = 0; kind < 4; kind++)
+    {
+        rg_alloc_stats_t stats = alloc_stats[kind];
+        size_t cached = 0;
+        for (int class = 0; class < POOL_CLASSES; class++)
+        {
+            int count = 0;
+            for (pool_block_t *block = pool.free_list[kind][class]; block; block = block->next)
+                count++;
+            CHECK(count == pool.free_count[kind][class] && count <= POOL_KEEP,
+                  "step %d: kind %d class %d has %d free blocks, counted %d", step, kind, class, count,
+                  pool.free_count[kind][class]);
+            cached += (size_t)count << (class + POOL_MIN_SHIFT);
+        }
+        CHECK(stats.pool_used == model_used[kind] && stats.pool_peak == model_peak[kind] &&
+                  stats.pool_slack == model_slack[kind] && stats.pool_cached == cached,
+              "step %d kind %d: used %d/%d, peak %d/%d, slack %d/%d, cached %d/%d", step, kind,
+              (int)stats.pool_used, (int)model_used[kind], (int)stats.pool_peak, (int)model_peak[kind],
+              (int)stats.pool_slack, (int)model_slack[kind], (int)stats.pool_cached, (int)cached);
+    }
+}
+
+static void release(slot_t *slot)
+{
+    int kind = alloc_kind(slot->caps);
+    for (size_t i = 0; i < slot->size; i += 97)
+        CHECK(slot->ptr[i] == slot->fill, "block of %d corrupted at %d", (int)slot->size, (int)i);
+    rg_pool_free(slot->ptr);
+    model_used[kind] -= slot->size;
+    model_slack[kind] -= class_slack(slot->size);
+    slot->ptr = NULL;
+}
+
+static void replay_trace(void)
+{
+    static const uint32_t caps[] = {MEM_ANY, MEM_SLOW, MEM_FAST, MEM_DMA};
+
+    for (int step = 0; step < STEPS; step++)
+    {
+        slot_t *slot = &slots[rand32() % SLOTS];
+
+        if (slot->ptr)
+        {
+            release(slot);
+        }
+        else
+        {
+            int kind = rand32() % 4;
+            slot->size = trace_size();
+            slot->caps = caps[kind] | ((rand32() & 1) ? MEM_NOZERO : 0);
+            slot->fill = rand32();
+            slot->ptr = rg_pool_alloc(slot->size, slot->caps);
+            CHECK(((uintptr_t)slot->ptr & 7) == 0, "step %d: block %p isn't 8-byte aligned", step, slot->ptr);
+            if (!(slot->caps & MEM_NOZERO))
+                for (size_t i = 0; i < slot->size; i += 97)
+                    CHECK(slot->ptr[i] == 0, "step %d: block of %d not zeroed at %d", step, (int)slot->size, (int)i);
+            memset(slot->ptr, slot->fill, slot->size);
+            model_used[kind] += slot->size;
+            model_peak[kind] = RG_MAX(model_peak[kind], model_used[kind]);
+            model_slack[kind] += class_slack(slot->size);
+        }
+
+        if (step % 64 == 0)
+            check_stats(step);
+        if (step % 50000 == 49999)
+            rg_pool_trim();
+    }
+
+    for (int i = 0; i < SLOTS; i++)
+        if (slots[i].ptr)
+            release(&slots[i]);
+    check_stats(STEPS);
+
+    for (int kind = 0; kind < 4; kind++)
+        printf("  kind %d: peak %7d bytes, %6d hits, %6d misses\n", kind, (int)alloc_stats[kind].pool_peak,
+               (int)alloc_stats[kind].pool_hits, (int)alloc_stats[kind].pool_misses);
+
+    rg_pool_trim();
+    for (int kind = 0; kind < 4; kind++)
+        CHECK(alloc_stats[kind].pool_cached == 0, "kind %d: %d bytes still cached after a trim", kind,
+              (int)alloc_stats[kind].pool_cached);
+}
+
+static void *alloc_thread(void *arg)
+{
+    size_t base = (uintptr_t)arg;
+    for (int i = 0; i < THREAD_ALLOCS; i++)
+        free(rg_alloc(base + i, MEM_FAST | MEM_NOZERO));
+    return NULL;
+}
+
+// rg_alloc isn't locked, its counters must still add up
+static void concurrent_allocs(void)
+{
+    pthread_t threads[THREADS];
+    rg_alloc_stats_t before = alloc_stats[alloc_kind(MEM_FAST)];
+
+    for (int i = 0; i < THREADS; i++)
+        pthread_create(&threads[i], NULL, alloc_thread, (void *)(uintptr_t)(1000 * (i + 1)));
+    for (int i = 0; i < THREADS; i++)
+        pthread_join(threads[i], NULL);
+
+    rg_alloc_stats_t after = alloc_stats[alloc_kind(MEM_FAST)];
+    CHECK(after.allocs - before.allocs == THREADS * THREAD_ALLOCS, "%d allocs counted, expected %d",
+          (int)(after.allocs - before.allocs), THREADS * THREAD_ALLOCS);
+    CHECK(after.largest == RG_MAX(before.largest, (size_t)(1000 * THREADS + THREAD_ALLOCS - 1)),
+          "largest is %d, expected %d", (int)after.largest, 1000 * THREADS + THREAD_ALLOCS - 1);
+}
+
+int main(int argc, char **argv)
+{
+    replay_trace();
+    concurrent_allocs();
+
+    if (failures)
+        printf("FAILED (%d)\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,71 @@
+/*
+** Host replacements for the parts of rg_system.c used by the tests, so that
+** individual modules can be linked without SDL2 or ESP-IDF.
+*/
+
+#include "rg_system.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+int64_t rg_system_timer(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+void rg_system_log(int level, const char *context, const char *format, ...)
+{
+    if (level > RG_LOG_WARN && !getenv("RG_TEST_VERBOSE"))
+        return;
+
+    va_list args;
+    va_start(args, format);
+    printf("  [%s] ", context);
+    vprintf(format, args);
+    va_end(args);
+    if (format[0] && format[strlen(format) - 1] != '\n')
+        printf("\n");
+}
+
+void rg_system_panic(const char *context, const char *message)
+{
+    printf("PANIC in %s: %s\n", context, message);
+    abort();
+}
+
+rg_mutex_t *rg_mutex_create(void)
+{
+    pthread_mutex_t *mutex = malloc(sizeof(pthread_mutex_t));
+    if (mutex)
+        pthread_mutex_init(mutex, NULL);
+    return (rg_mutex_t *)mutex;
+}
+
+void rg_mutex_free(rg_mutex_t *mutex)
+{
+    if (!mutex) return;
+    pthread_mutex_destroy((pthread_mutex_t *)mutex);
+    free(mutex);
+}
+
+bool rg_mutex_give(rg_mutex_t *mutex)
+{
+    RG_ASSERT_ARG(mutex);
+    return pthread_mutex_unlock((pthread_mutex_t *)mutex) == 0;
+}
+
+bool rg_mutex_take(rg_mutex_t *mutex, int timeoutMS)
+{
+    RG_ASSERT_ARG(mutex);
+    return pthread_mutex_lock((pthread_mutex_t *)mutex) == 0;
+}
+
+void rg_task_delay(uint32_t ms)
+{
+    struct timespec ts = {ms / 1000, (ms % 1000) * 1000000};
+    nanosleep(&ts, NULL);
+}
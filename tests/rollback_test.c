@@ -0,0 +1,204 @@
+/*
+** Two rg_rollback sessions talking over the loopback link, with latency and
+** packet loss. Each peer runs a small deterministic "game". Whatever the mode,
+** both peers must end up with the frames a single machine would have produced
+** from the same inputs. Lockstep and rollback are run side by side to compare
+** how often they stall.
+*/
+
+#include "rg_system.h"
+#include "rg_rollback.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define FRAMES 600
+
+typedef struct
+{
+    uint32_t frame;
+    uint32_t hash;
+    int32_t pos[2];
+} game_t;
+
+typedef struct
+{
+    game_t game;
+    uint32_t hashes[FRAMES + 64]; // Hash after each frame, overwritten when re-simulated
+    uint32_t renders;
+} peer_t;
+
+static uint32_t mix(uint32_t h)
+{
+    h ^= h >> 16;
+    h *= 0x7feb352d;
+    h ^= h >> 15;
+    h *= 0x846ca68b;
+    h ^= h >> 16;
+    return h;
+}
+
+// Buttons held by a player when the session is at a given frame, they change every few frames
+static uint8_t player_input(int player, uint32_t frame)
+{
+    return mix(player * 7919 + frame / 7) & 0xFF;
+}
+
+static void game_step(game_t *game, const uint8_t inputs[2])
+{
+    for (int i = 0; i < 2; i++)
+        game->pos[i] += (inputs[i] & 1) - ((inputs[i] >> 1) & 1) + (inputs[i] >> 4);
+    game->hash = mix(game->hash ^ inputs[0] ^ (inputs[1] << 8) ^ (game->pos[0] << 16) ^ game->pos[1]);
+    game->frame++;
+}
+
+static bool save_state(void *arg, void *buffer, size_t size)
+{
+    memcpy(buffer, &((peer_t *)arg)->game, size);
+    return true;
+}
+
+static bool load_state(void *arg, const void *buffer, size_t size)
+{
+    memcpy(&((peer_t *)arg)->game, buffer, size);
+    return true;
+}
+
+static void run_frame(void *arg, const void *inputs, bool render)
+{
+    peer_t *peer = arg;
+    game_step(&peer->game, inputs);
+    if (peer->game.frame <= FRAMES + 63)
+        peer->hashes[peer->game.frame] = peer->game.hash;
+    peer->renders += render;
+}
+
+typedef struct
+{
+    const char *name;
+    int max_rollback;
+    int input_delay;
+    int latency;
+    int loss;
+} scenario_t;
+
+// Returns the number of rg_rollback_advance() rounds needed, or -1 on failure
+static int run_scenario(const scenario_t *sc, const uint32_t *reference)
+{
+    rg_rollback_link_t *links[2];
+    rg_rollback_t *sessions[2];
+    peer_t *peers = calloc(2, sizeof(peer_t));
+    uint32_t target = FRAMES + sc->max_rollback + 2; // Frames up to FRAMES are confirmed by then
+    int rounds = 0;
+    int ret = 0;
+
+    if (!peers || !rg_rollback_link_loopback(links, sc->latency, sc->loss, 1234))
+        return -1;
+
+    for (int i = 0; i < 2; i++)
+    {
+        rg_rollback_config_t config = {
+            .save_state = save_state,
+            .load_state = load_state,
+            .run_frame = run_frame,
+            .arg = &peers[i],
+            .state_size = sizeof(game_t),
+            .input_size = 1,
+            .max_rollback = sc->max_rollback,
+            .input_delay = sc->input_delay,
+        };
+        if (!(sessions[i] = rg_rollback_create(&config, links[i], i)))
+            return -1;
+    }
+
+    while (rg_rollback_frame(sessions[0]) < target || rg_rollback_frame(sessions[1]) < target)
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            uint8_t input = player_input(i, rg_rollback_frame(sessions[i]));
+            if (rg_rollback_frame(sessions[i]) < target)
+                rg_rollback_advance(sessions[i], &input);
+        }
+        if (++rounds > 100 * FRAMES)
+        {
+            printf("%s: no progress after %d rounds (frames %d/%d)\n", sc->name, rounds,
+                   (int)rg_rollback_frame(sessions[0]), (int)rg_rollback_frame(sessions[1]));
+            ret = -1;
+            break;
+        }
+    }
+
+    for (int f = 1; f <= FRAMES && ret == 0; f++)
+    {
+        if (peers[0].hashes[f] != peers[1].hashes[f] || peers[0].hashes[f] != reference[f])
+        {
+            printf("%s: frame %d diverged: peer0=%08X peer1=%08X reference=%08X\n", sc->name, f,
+                   (unsigned)peers[0].hashes[f], (unsigned)peers[1].hashes[f], (unsigned)reference[f]);
+            ret = -1;
+        }
+    }
+
+    const rg_rollback_stats_t *st = rg_rollback_get_stats(sessions[0]);
+    printf("%-22s rounds %5d  stalls %5d  rollbacks %4d  resim %5d  sent %5d  recv %5d  %s\n",
+           sc->name, rounds, (int)st->stalls, (int)st->rollbacks, (int)st->resim_frames,
+           (int)st->packets_sent, (int)st->packets_received, ret == 0 ? "OK" : "FAILED");
+
+    if (ret == 0 && (peers[0].renders != target || peers[1].renders != target))
+    {
+        printf("%s: rendered %d/%d frames, expected %d\n", sc->name,
+               (int)peers[0].renders, (int)peers[1].renders, (int)target);
+        ret = -1;
+    }
+
+    rg_rollback_free(sessions[0]);
+    rg_rollback_free(sessions[1]);
+    free(peers);
+
+    return ret == 0 ? rounds : -1;
+}
+
+int main(void)
+{
+    const scenario_t scenarios[] = {
+        {"lockstep",              0, 0, 0, 0},
+        {"lockstep lat=3 loss=10", 0, 0, 3, 10},
+        {"rollback lat=3 loss=10", 8, 0, 3, 10},
+        {"rollback+delay",         8, 2, 3, 10},
+        {"rollback lat=6 loss=30", 16, 1, 6, 30},
+    };
+    int rounds[RG_COUNT(scenarios)];
+    int failed = 0;
+
+    for (size_t i = 0; i < RG_COUNT(scenarios); i++)
+    {
+        const scenario_t *sc = &scenarios[i];
+        uint32_t reference[FRAMES + 1] = {0};
+        game_t game = {0};
+
+        // What a single machine would compute. The input given at frame f is used at f + input_delay.
+        for (uint32_t f = 0; f < FRAMES; f++)
+        {
+            uint8_t inputs[2] = {0, 0};
+            if (f >= (uint32_t)sc->input_delay)
+            {
+                inputs[0] = player_input(0, f - sc->input_delay);
+                inputs[1] = player_input(1, f - sc->input_delay);
+            }
+            game_step(&game, inputs);
+            reference[f + 1] = game.hash;
+        }
+
+        if ((rounds[i] = run_scenario(sc, reference)) < 0)
+            failed = 1;
+    }
+
+    // With the same link, rollback must hide the latency that lockstep waits for
+    if (!failed && rounds[2] >= rounds[1])
+    {
+        printf("rollback needed %d rounds, lockstep %d\n", rounds[2], rounds[1]);
+        failed = 1;
+    }
+
+    printf(failed ? "FAILED\n" : "OK\n");
+    return failed;
+}
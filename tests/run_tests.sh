@@ -0,0 +1,111 @@
+#!/bin/bash
+
+# Host-side tests and benchmarks, run from the repository root.
+# Supported systems: Linux / MINGW32 / MINGW64
+
+CC="gcc"
+CFLAGS="-O2 -g -Wall -Wextra -Wno-unused-parameter"
+RG_CFLAGS="-DRG_TARGET_SDL2 -fsanitize=address,undefined -fno-sanitize-recover=all -Icomponents/retro-go"
+RG_STUBS="tests/rg_system_stubs.c -lpthread"
+BUILD_DIR="build_tests"
+FAILED=0
+
+mkdir -p $BUILD_DIR
+
+run() # name, command...
+{
+	local name=$1; shift
+	echo "== $name"
+	"$@" || { echo "!! $name failed"; FAILED=1; }
+}
+
+# Every dispatch variant must end in the same state
+nes6502_bench()
+{
+	for variant in switch jumptable switch+cache jumptable+cache; do
+		$BUILD_DIR/nes6502_bench_$variant 20000 $variant || return 1
+	done | tee $BUILD_DIR/nes6502_bench.txt
+	[ $(awk '{print $NF}' $BUILD_DIR/nes6502_bench.txt | sort -u | wc -l) -eq 1 ]
+}
+
+# Both opcode table layouts must decode and run the same
+m68k_bench()
+{
+	for variant in flat compact; do
+		$BUILD_DIR/m68k_bench_$variant 600 $variant || return 1
+	done | tee $BUILD_DIR/m68k_bench.txt
+	[ $(awk '{print $2, $NF}' $BUILD_DIR/m68k_bench.txt | sort -u | wc -l) -eq 3 ]
+}
+
+# The SIMD and scalar rg_surface kernels must produce the same pixels
+surface_test()
+{
+	for variant in simd scalar; do
+		$BUILD_DIR/surface_test_$variant || return 1
+	done | tee $BUILD_DIR/surface_test.txt
+	[ $(grep digest $BUILD_DIR/surface_test.txt | sort -u | wc -l) -eq 1 ]
+}
+
+echo "Building nes6502_bench..."
+NOFRENDO="retro-core/components/nofrendo"
+for variant in "switch:" "jumptable:-DNES6502_JUMPTABLE" "switch+cache:-DNES6502_BLOCKCACHE" \
+			   "jumptable+cache:-DNES6502_JUMPTABLE -DNES6502_BLOCKCACHE"; do
+	$CC $CFLAGS ${variant#*:} -I$NOFRENDO -I$NOFRENDO/nes tests/nes6502_bench.c $NOFRENDO/nes/cpu.c \
+		-o "$BUILD_DIR/nes6502_bench_${variant%%:*}" || exit 1
+done
+
+echo "Building m68k_bench..."
+M68K="gwenesis/components/gwenesis/src/cpus/M68K"
+for variant in "flat:-DM68K_COMPACT_JUMP_TABLE=0" "compact:-DM68K_COMPACT_JUMP_TABLE=1"; do
+	$CC $CFLAGS ${variant#*:} -I$M68K -Igwenesis/components/gwenesis/src/savestate tests/m68k_bench.c \
+		-o "$BUILD_DIR/m68k_bench_${variant%%:*}" || exit 1
+done
+
+echo "Building rollback_test..."
+$CC $CFLAGS $RG_CFLAGS -Icomponents/retro-go/libs/netplay tests/rollback_test.c \
+	components/retro-go/libs/netplay/rg_rollback.c $RG_STUBS -o $BUILD_DIR/rollback_test || exit 1
+
+echo "Building bookmarks_test..."
+$CC $CFLAGS -Wno-sign-compare -Wno-format-truncation $RG_CFLAGS -Ilauncher/main tests/bookmarks_test.c components/retro-go/rg_utils.c \
+	$RG_STUBS -o $BUILD_DIR/bookmarks_test || exit 1
+
+echo "Building applications_test..."
+$CC $CFLAGS -Wno-sign-compare -Wno-format -Wno-format-truncation $RG_CFLAGS -Ilauncher/main tests/applications_test.c \
+	launcher/main/gui.c components/retro-go/rg_utils.c $RG_STUBS -o $BUILD_DIR/applications_test || exit 1
+
+echo "Building pool_test..."
+$CC $CFLAGS -Wno-sign-compare $RG_CFLAGS tests/pool_test.c $RG_STUBS -o $BUILD_DIR/pool_test || exit 1
+
+echo "Building zone_stress..."
+$CC $CFLAGS -fsanitize=address,undefined -fno-sanitize-recover=all -Iprboom-go/components/prboom \
+	tests/zone_stress.c -o $BUILD_DIR/zone_stress || exit 1
+
+echo "Building surface_test..."
+for variant in "simd:" "scalar:-DRG_SURFACE_NO_SIMD"; do
+	$CC $CFLAGS $RG_CFLAGS ${variant#*:} -Icomponents/retro-go/libs/lodepng tests/surface_test.c \
+		components/retro-go/libs/lodepng/lodepng.c $RG_STUBS -o "$BUILD_DIR/surface_test_${variant%%:*}" || exit 1
+done
+
+echo "Building gui_text_test..."
+$CC $CFLAGS -Wno-sign-compare -Wno-format-truncation -Wno-unused-function -Wno-array-bounds $RG_CFLAGS \
+	-Icomponents/retro-go/libs/cJSON -Icomponents/retro-go/libs/lodepng tests/gui_text_test.c \
+	components/retro-go/rg_surface.c components/retro-go/rg_utils.c components/retro-go/fonts/*.c \
+	components/retro-go/libs/cJSON/cJSON.c components/retro-go/libs/lodepng/lodepng.c $RG_STUBS -lm \
+	-o $BUILD_DIR/gui_text_test || exit 1
+
+echo "Building tile_test..."
+$CC $CFLAGS -Wno-implicit-fallthrough -DNO_ZERO_LUT -fsanitize=address,undefined -fno-sanitize-recover=all \
+	-Iretro-core/components/snes9x/src tests/tile_test.c -o $BUILD_DIR/tile_test || exit 1
+
+run nes6502_bench nes6502_bench
+run m68k_bench m68k_bench
+run rollback_test $BUILD_DIR/rollback_test
+run bookmarks_test $BUILD_DIR/bookmarks_test $BUILD_DIR
+run applications_test $BUILD_DIR/applications_test
+run pool_test $BUILD_DIR/pool_test
+run surface_test surface_test
+run zone_stress $BUILD_DIR/zone_stress
+run gui_text_test $BUILD_DIR/gui_text_test
+run tile_test $BUILD_DIR/tile_test
+
+exit $FAILED
@@ -0,0 +1,235 @@
+/*
+** rg_surface fill/copy/blend checks and throughput.
+**
+** Built twice by run_tests.sh: with the SIMD kernels and with
+** RG_SURFACE_NO_SIMD. Both builds must print the same digest. The file includes
+** rg_surface.c to reach the static kernels.
+*/
+
+#include "rg_surface.c"
+
+#include <time.h>
+
+void *rg_alloc(size_t size, uint32_t caps)
+{
+    return malloc(size);
+}
+
+bool rg_storage_read_file(const char *path, void **data_out, size_t *data_len, uint32_t flags)
+{
+    return false;
+}
+
+static uint32_t seed = 0x12345678;
+static int failures = 0;
+
+static uint32_t rand32(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+#define CHECK(cond, ...) if (!(cond)) { printf(__VA_ARGS__); printf("\n"); if (++failures > 20) exit(1); }
+
+// The per-channel formula the vector kernel implements, see blend_pixel()
+static uint16_t reference_blend(uint16_t s, uint16_t d, int alpha)
+{
+    int r = (d >> 11) + ((((s >> 11) - (d >> 11)) * alpha) >> 5);
+    int g = ((d >> 5) & 0x3F) + (((((s >> 5) & 0x3F) - ((d >> 5) & 0x3F)) * alpha) >> 5);
+    int b = (d & 0x1F) + ((((s & 0x1F) - (d & 0x1F)) * alpha) >> 5);
+    return (r << 11) | (g << 5) | b;
+}
+
+// Every pixel of a 565 LE line composed onto another, against a per-pixel model
+static void test_compose(void)
+{
+    uint16_t src[67], dst[67], expected[67];
+
+    for (int round = 0; round < 20000; round++)
+    {
+        size_t count = 1 + rand32() % 66;
+        int alpha = (round % 3 == 0) ? 32 : rand32() % 33;
+        bool swap = rand32() & 1;
+        int color_key = (rand32() & 1) ? -1 : 0;
+
+        for (size_t x = 0; x < count; x++)
+        {
+            src[x] = (rand32() & 3) ? rand32() : 0xF81F;
+            dst[x] = rand32();
+        }
+        if (color_key >= 0)
+            color_key = 0xF81F;
+
+        for (size_t x = 0; x < count; x++)
+        {
+            uint16_t d = swap ? SWAP16(dst[x]) : dst[x];
+            uint16_t out = (int)src[x] == color_key ? d : alpha < 32 ? reference_blend(src[x], d, alpha) : src[x];
+            expected[x] = swap ? SWAP16(out) : out;
+        }
+
+        compose_pixels16(dst, src, count, color_key, alpha, swap);
+
+        for (size_t x = 0; x < count; x++)
+            CHECK(dst[x] == expected[x], "compose(count=%d, key=%d, alpha=%d, swap=%d) pixel %d = %04X, expected %04X",
+                  (int)count, color_key, alpha, swap, (int)x, dst[x], expected[x]);
+    }
+}
+
+static rg_surface_t *random_surface(int width, int height, int format)
+{
+    rg_surface_t *surface = rg_surface_create(width, height, format, 0);
+    uint8_t *data = surface->data;
+    for (size_t i = 0; i < (size_t)surface->stride * height; i++)
+        data[i] = (rand32() & 7) ? rand32() : 0x1F; // Plenty of 0xF81F/0x1FF8 key pixels in 565
+    if (surface->palette)
+        for (int i = 0; i < 256; i++)
+            surface->palette[i] = (i & 7) ? rand32() : 0xF81F;
+    return surface;
+}
+
+static uint32_t digest(uint32_t hash, const rg_surface_t *surface)
+{
+    const uint8_t *data = surface->data;
+    for (size_t i = 0; i < (size_t)surface->stride * surface->height; i++)
+        hash = (hash ^ data[i]) * 16777619;
+    return hash;
+}
+
+// Random fills and blits over every format pair, the result must not depend on the kernels
+static uint32_t test_surfaces(void)
+{
+    const int formats[] = {RG_PIXEL_565_LE, RG_PIXEL_565_BE, RG_PIXEL_888, RG_PIXEL_PAL565_LE, RG_PIXEL_PAL565_BE};
+    const int alphas[] = {255, 200, 128, 37, 0};
+    uint32_t hash = 2166136261;
+
+    for (int round = 0; round < 400; round++)
+    {
+        int src_format = formats[rand32() % 5], dst_format = formats[rand32() % 3];
+        rg_surface_t *src = random_surface(1 + rand32() % 100, 1 + rand32() % 40, src_format);
+        rg_surface_t *dst = random_surface(1 + rand32() % 100, 1 + rand32() % 40, dst_format);
+        rg_rect_t rect = {rand32() % dst->width, rand32() % dst->height, 1 + rand32() % 90, 1 + rand32() % 30};
+        rg_color_t color_key = (rand32() & 1) ? 0xF81F : -1;
+        int alpha = alphas[rand32() % 5];
+        bool scale = rand32() & 1;
+
+        switch (round % 3)
+        {
+        case 0:
+            rg_surface_fill(dst, (round & 4) ? &rect : NULL, rand32() & 0xFFFF);
+            break;
+        case 1:
+            rg_surface_copy(src, NULL, dst, (round & 4) ? &rect : NULL, scale);
+            break;
+        case 2:
+            rg_surface_blend(src, NULL, dst, (round & 4) ? &rect : NULL, scale, color_key, alpha);
+            break;
+        }
+
+        hash = digest(hash, dst);
+        rg_surface_free(src);
+        rg_surface_free(dst);
+    }
+
+    return hash;
+}
+
+// Paletted destinations only take indexes from a source with the same palette
+static void test_paletted_dest(void)
+{
+    rg_surface_t *src = random_surface(16, 16, RG_PIXEL_565_LE);
+    rg_surface_t *pal = random_surface(16, 16, RG_PIXEL_PAL565_LE);
+    rg_surface_t *dst = random_surface(16, 16, RG_PIXEL_PAL565_LE);
+
+    src->palette = dst->palette; // A 565 surface with a palette pointer is still not paletted
+    CHECK(!rg_surface_blend(src, NULL, dst, NULL, false, -1, 255), "blend 565 -> paletted accepted");
+    src->palette = NULL;
+    CHECK(!rg_surface_blend(pal, NULL, dst, NULL, false, -1, 255), "blend with a different palette accepted");
+    memcpy(pal->palette, dst->palette, 512);
+    CHECK(rg_surface_blend(pal, NULL, dst, NULL, false, -1, 255), "blend with the same palette rejected");
+    CHECK(memcmp(pal->data, dst->data, 16 * 16) == 0, "paletted copy changed the indexes");
+
+    rg_surface_free(src);
+    rg_surface_free(pal);
+    rg_surface_free(dst);
+}
+
+// Opaque keyed blit: key pixels keep the destination, all others are the source
+static void test_color_key(void)
+{
+    rg_surface_t *src = random_surface(77, 13, RG_PIXEL_565_LE);
+    rg_surface_t *dst = random_surface(77, 13, RG_PIXEL_565_BE);
+    rg_surface_t *orig = random_surface(77, 13, RG_PIXEL_565_BE);
+    memcpy(orig->data, dst->data, dst->stride * dst->height);
+
+    rg_surface_blend(src, NULL, dst, NULL, false, 0x1F1F, 255);
+
+    for (int i = 0; i < 77 * 13; i++)
+    {
+        uint16_t s = ((uint16_t *)src->data)[i];
+        uint16_t d = ((uint16_t *)dst->data)[i], o = ((uint16_t *)orig->data)[i];
+        CHECK(d == (s == 0x1F1F ? o : SWAP16(s)), "color key: pixel %d is %04X (src %04X, was %04X)", i, d, s, o);
+    }
+
+    rg_surface_free(src);
+    rg_surface_free(dst);
+    rg_surface_free(orig);
+}
+
+static double bench(const char *name, rg_surface_t *src, rg_surface_t *dst, int op, rg_color_t key, int alpha)
+{
+    struct timespec t0, t1;
+    int iterations = 0;
+    double secs;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    do
+    {
+        for (int i = 0; i < 50; i++, iterations++)
+        {
+            if (op == 0)
+                rg_surface_fill(dst, NULL, iterations);
+            else
+                rg_surface_blend(src, NULL, dst, NULL, false, key, alpha);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    } while (secs < 0.2);
+
+    double mpix = (double)iterations * dst->width * dst->height / secs / 1e6;
+    printf("  %-28s %8.1f Mpixel/s\n", name, mpix);
+    return mpix;
+}
+
+int main(int argc, char **argv)
+{
+    test_compose();
+    test_color_key();
+    test_paletted_dest();
+    uint32_t hash = test_surfaces();
+
+#ifdef RG_SURFACE_NO_SIMD
+    printf("scalar kernels, 320x240:\n");
+#else
+    printf("SIMD kernels, 320x240:\n");
+#endif
+    rg_surface_t *src = random_surface(320, 240, RG_PIXEL_565_LE);
+    rg_surface_t *le = random_surface(320, 240, RG_PIXEL_565_LE);
+    rg_surface_t *be = random_surface(320, 240, RG_PIXEL_565_BE);
+    bench("fill 565", NULL, be, 0, -1, 255);
+    bench("copy 565 LE -> LE", src, le, 1, -1, 255);
+    bench("copy 565 LE -> BE", src, be, 1, -1, 255);
+    bench("copy 565 LE -> BE, keyed", src, be, 1, 0xF81F, 255);
+    bench("blend 565 LE -> BE, 50%", src, be, 1, -1, 128);
+    bench("blend 565 LE -> LE, 50% keyed", src, le, 1, 0xF81F, 128);
+    rg_surface_free(src);
+    rg_surface_free(le);
+    rg_surface_free(be);
+
+    printf("digest %08X\n", (unsigned)hash);
+
+    if (failures)
+        printf("FAILED (%d)\n", failures);
+    return failures != 0;
+}
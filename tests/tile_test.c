@@ -0,0 +1,209 @@
+/*
+** snes9x colour math tile writers: checks and throughput.
+**
+** NO_ZERO_LUT is set as in the device builds, the branch-free COLOR_SUB1_2 is
+** checked against the GFX.ZERO table it replaces, then every writer against a
+** per-pixel model. The file includes tile.c to reach the static writers.
+*/
+
+#include <stddef.h>
+
+#include "tile.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+THREAD_LOCAL SGFX* S9xGFX;
+THREAD_LOCAL SBG BG;
+InternalPPU IPPU;
+CMemory Memory;
+
+#define LINE 512
+
+typedef void (*writer_t)(int32_t Offset, uint8_t* Pixels, uint16_t* ScreenColors);
+
+static const struct
+{
+   const char* name;
+   writer_t    write;
+   writer_t    write_flipped;
+} writers[] =
+{
+   {"add",     WRITE_4PIXELS16_ADD,    WRITE_4PIXELS16_FLIPPED_ADD},
+   {"add 1/2", WRITE_4PIXELS16_ADD1_2, WRITE_4PIXELS16_FLIPPED_ADD1_2},
+   {"sub",     WRITE_4PIXELS16_SUB,    WRITE_4PIXELS16_FLIPPED_SUB},
+   {"sub 1/2", WRITE_4PIXELS16_SUB1_2, WRITE_4PIXELS16_FLIPPED_SUB1_2},
+};
+
+static SGFX gfx;
+static uint16_t screen[LINE * 2]; /* Main screen, then the sub screen at GFX.Delta */
+static uint8_t zbuffer[LINE], subzbuffer[LINE];
+static uint16_t colors[256];
+static uint8_t pixels[LINE];
+static uint32_t seed = 0x12345678;
+static int failures = 0;
+
+static uint32_t rand32(void)
+{
+   seed ^= seed << 13;
+   seed ^= seed >> 17;
+   seed ^= seed << 5;
+   return seed;
+}
+
+#define CHECK(cond, ...) if (!(cond)) { printf(__VA_ARGS__); printf("\n"); if (++failures > 20) exit(1); }
+
+/* GFX.ZERO as S9xInitGFX() builds it without NO_ZERO_LUT */
+static uint16_t zero_lut[0x10000];
+
+static void build_zero_lut(void)
+{
+   for (uint32_t r = 0; r <= MAX_RED; r++)
+   {
+      uint32_t r2 = (r & 0x10) ? r & ~0x10 : 0;
+      for (uint32_t g = 0; g <= MAX_GREEN; g++)
+      {
+         uint32_t g2 = (g & GREEN_HI_BIT) ? g & ~GREEN_HI_BIT : 0;
+         for (uint32_t b = 0; b <= MAX_BLUE; b++)
+         {
+            uint32_t b2 = (b & 0x10) ? b & ~0x10 : 0;
+            zero_lut [BUILD_PIXEL2(r, g, b)] = BUILD_PIXEL2(r2, g2, b2);
+            zero_lut [BUILD_PIXEL2(r, g, b) & ~ALPHA_BITS_MASK] = BUILD_PIXEL2(r2, g2, b2);
+         }
+      }
+   }
+}
+
+static void test_sub1_2(void)
+{
+   build_zero_lut();
+   for (int i = 0; i < 4000000; i++)
+   {
+      uint16_t c1 = rand32(), c2 = rand32();
+      uint16_t expected = zero_lut [(((c1) | RGB_HI_BITS_MASKx2) - ((c2) & RGB_REMOVE_LOW_BITS_MASK)) >> 1];
+      uint16_t got = COLOR_SUB1_2(c1, c2);
+      CHECK(got == expected, "COLOR_SUB1_2(%04X, %04X) = %04X, expected %04X", c1, c2, got, expected);
+   }
+}
+
+static uint16_t reference_math(int op, uint16_t main, uint16_t sub, int subz)
+{
+   if (subz == 0)
+      return main;
+   if (subz == 1)
+      return op < 2 ? COLOR_ADD(main, GFX.FixedColour) : COLOR_SUB(main, GFX.FixedColour);
+   switch (op)
+   {
+   case 0:  return COLOR_ADD(main, sub);
+   case 1:  return COLOR_ADD1_2(main, sub);
+   case 2:  return COLOR_SUB(main, sub);
+   default: return COLOR_SUB1_2(main, sub);
+   }
+}
+
+static void randomize(void)
+{
+   for (int i = 0; i < LINE * 2; i++)
+      screen[i] = rand32();
+   for (int i = 0; i < LINE; i++)
+   {
+      zbuffer[i] = rand32() % 8;
+      subzbuffer[i] = (rand32() & 3) ? rand32() % 4 : rand32();
+      pixels[i] = (rand32() & 3) ? rand32() : 0;
+   }
+   for (int i = 0; i < 256; i++)
+      colors[i] = rand32();
+   GFX.Z1 = 1 + rand32() % 8;
+   GFX.Z2 = rand32();
+   GFX.FixedColour = rand32() & 0xFFFF;
+}
+
+/* Every writer over random lines, against a per-pixel model */
+static void test_writers(void)
+{
+   static uint16_t expected[LINE];
+   static uint8_t expected_z[LINE];
+   for (int round = 0; round < 4000; round++)
+   {
+      int op = round % 4;
+      bool flipped = (round / 4) & 1;
+
+      randomize();
+
+      for (int x = 0; x < LINE; x++)
+      {
+         uint8_t pixel = pixels[(x & ~3) + (flipped ? 3 - (x & 3) : (x & 3))];
+         expected[x] = screen[x];
+         expected_z[x] = zbuffer[x];
+         if (GFX.Z1 > zbuffer[x] && pixel)
+         {
+            expected[x] = reference_math(op, colors[pixel], screen[LINE + x], subzbuffer[x]);
+            expected_z[x] = GFX.Z2;
+         }
+      }
+
+      for (int x = 0; x < LINE; x += 4)
+         (flipped ? writers[op].write_flipped : writers[op].write)(x, pixels + x, colors);
+
+      for (int x = 0; x < LINE; x++)
+         CHECK(screen[x] == expected[x] && zbuffer[x] == expected_z[x],
+               "%s%s: pixel %d = %04X z %d, expected %04X z %d", writers[op].name, flipped ? " flipped" : "",
+               x, screen[x], zbuffer[x], expected[x], expected_z[x]);
+   }
+}
+
+/* A 256 pixel line where most pixels pass the depth test, like a full
+ * transparent layer */
+static void bench(int op)
+{
+   struct timespec t0, t1;
+   uint64_t count = 0;
+   double secs;
+
+   seed = 99;
+   randomize();
+   for (int i = 0; i < LINE; i++)
+   {
+      zbuffer[i] = 0;
+      subzbuffer[i] = (i % 16) ? 2 : 1;
+      pixels[i] |= (i % 8) ? 1 : 0;
+   }
+   GFX.Z1 = 8;
+
+   clock_gettime(CLOCK_MONOTONIC, &t0);
+   do
+   {
+      for (int i = 0; i < 1000; i++, count += 256)
+      {
+         for (int x = 0; x < 256; x += 4)
+            writers[op].write(x, pixels + x, colors);
+         GFX.Z2 = 0; /* The next pass draws over this one */
+         memset(zbuffer, 0, 256);
+      }
+      clock_gettime(CLOCK_MONOTONIC, &t1);
+      secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+   } while (secs < 0.2);
+
+   printf("  %-28s %8.1f Mpixel/s\n", writers[op].name, count / secs / 1e6);
+}
+
+int main(int argc, char **argv)
+{
+   S9xGFX = &gfx;
+   GFX.S = (uint8_t*) screen;
+   GFX.ZBuffer = zbuffer;
+   GFX.SubZBuffer = subzbuffer;
+   GFX.Delta = LINE;
+
+   test_sub1_2();
+   test_writers();
+
+   printf("colour math writers:\n");
+   for (int op = 0; op < 4; op++)
+      bench(op);
+
+   if (failures)
+      printf("FAILED (%d)\n", failures);
+   return failures != 0;
+}
@@ -0,0 +1,279 @@
+/*
+** prboom zone allocator: random Z_Malloc/Z_Free/Z_ChangeTag/Z_Realloc/Z_FreeTags
+** traffic with content and owner checks, the whole-arena purge paths, and a
+** synthetic level load cycle for timing. The file includes z_zone.c to look at
+** the arenas.
+**
+** Usage: zone_stress [operations]
+*/
+
+#include "z_zone.c"
+
+#include <stdarg.h>
+#include <time.h>
+
+#undef malloc
+#undef free
+
+#define ENTRIES 20000
+
+typedef struct
+{
+    void *p;
+    void *owner;
+    size_t size;
+    int tag;
+    int owned;
+    unsigned char fill;
+} entry_t;
+
+static entry_t entries[ENTRIES];
+static unsigned rnd_state = 1;
+
+void I_Error(const char *error, ...)
+{
+    va_list args;
+    va_start(args, error);
+    vprintf(error, args);
+    va_end(args);
+    printf("\n");
+    fflush(stdout);
+    abort();
+}
+
+static unsigned rnd(void)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return rnd_state >> 8;
+}
+
+static size_t random_size(void)
+{
+    unsigned r = rnd() % 100;
+    return r < 80 ? 1 + rnd() % 300 : r < 95 ? 300 + rnd() % 2000 : 2000 + rnd() % 40000;
+}
+
+static int random_tag(void)
+{
+    static const int tags[] = {PU_STATIC, PU_SOUND, PU_LEVEL, PU_LEVEL, PU_LEVEL, PU_LEVSPEC, PU_CACHE, PU_CACHE};
+    return tags[rnd() % 8];
+}
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static void check(int i)
+{
+    entry_t *e = &entries[i];
+    if (!e->p)
+        return;
+    if (e->owned && e->owner != e->p)
+        I_Error("entry %d: owner is %p, block is %p", i, e->owner, e->p);
+    for (size_t k = 0; k < e->size; k++)
+        if (((unsigned char *)e->p)[k] != e->fill)
+            I_Error("entry %d: corrupted at %d", i, (int)k);
+}
+
+// Purges clear the owners of the blocks they take
+static void sync_owned(void)
+{
+    for (int i = 0; i < ENTRIES; i++)
+        if (entries[i].p && entries[i].owned && !entries[i].owner)
+            entries[i].p = NULL;
+}
+
+static void do_alloc(int i)
+{
+    entry_t *e = &entries[i];
+    e->size = random_size();
+    e->tag = random_tag();
+    e->owned = e->tag == PU_CACHE || rnd() % 4 == 0;
+    e->fill = rnd();
+    e->p = (Z_Malloc)(e->size, e->tag, e->owned ? &e->owner : NULL);
+    memset(e->p, e->fill, e->size);
+}
+
+static void stress(int operations)
+{
+    for (int r = 0; r < operations; r++)
+    {
+        int i = rnd() % ENTRIES;
+        unsigned op = rnd() % 100;
+        entry_t *e = &entries[i];
+
+        if (!e->p)
+        {
+            do_alloc(i);
+            continue;
+        }
+
+        check(i);
+
+        if (op < 40)
+        {
+            (Z_Free)(e->p);
+            e->p = NULL;
+            if (e->owned && e->owner)
+                I_Error("Z_Free didn't clear the owner of entry %d", i);
+        }
+        else if (op < 60)
+        {
+            int tag = random_tag();
+            if (tag == PU_CACHE && !e->owned)
+                tag = PU_STATIC;
+            (Z_ChangeTag)(e->p, tag);
+            e->tag = tag;
+        }
+        else if (op < 75)
+        {
+            size_t size = random_size();
+            void *p = (Z_Realloc)(e->p, size, e->tag, e->owned ? &e->owner : NULL);
+            for (size_t k = 0; k < MIN(size, e->size); k++)
+                if (((unsigned char *)p)[k] != e->fill)
+                    I_Error("Z_Realloc lost the contents of entry %d", i);
+            e->p = p;
+            e->size = size;
+            memset(p, e->fill, size);
+        }
+        else if (op < 76) // Level change
+        {
+            (Z_FreeTags)(PU_LEVEL, PU_CACHE, -1);
+            for (int j = 0; j < ENTRIES; j++)
+            {
+                if (!entries[j].p || entries[j].tag < PU_LEVEL)
+                    continue;
+                if (entries[j].owned && entries[j].owner)
+                    I_Error("Z_FreeTags didn't clear the owner of entry %d", j);
+                entries[j].p = NULL;
+            }
+        }
+        else if (op < 78) // Out of memory
+        {
+            (Z_FreeTags)(PU_CACHE, PU_CACHE, 2);
+            sync_owned();
+        }
+    }
+
+    for (int i = 0; i < ENTRIES; i++)
+        check(i);
+    sync_owned();
+    for (int i = 0; i < ENTRIES; i++)
+        (Z_Free)(entries[i].p);
+    memset(entries, 0, sizeof(entries));
+
+    for (int i = 0; i < ARENA_MAX; i++)
+        if (arenas[i].live)
+            I_Error("arena %d still has %d blocks after freeing everything", i, (int)arenas[i].live);
+}
+
+// Full purges must release the level and cache arenas as a whole when nothing else lives there
+static void arena_drops(void)
+{
+    static void *cache[1000];
+    void *locked = NULL, *retagged = NULL;
+    unsigned purges = Z_PurgeCount();
+
+    for (int i = 0; i < 3000; i++)
+        (Z_Malloc)(16 + i % 400, PU_LEVEL, NULL);
+    for (int i = 0; i < 1000; i++)
+        (Z_Malloc)(16 + i % 400, PU_CACHE, &cache[i]);
+    (Z_Malloc)(100, PU_STATIC, &retagged);
+    (Z_ChangeTag)(retagged, PU_CACHE);
+
+    (Z_FreeTags)(PU_LEVEL, PU_CACHE, -1);
+    if (Z_PurgeCount() == purges)
+        I_Error("Z_PurgeCount didn't change after a cache purge");
+    if (arenas[ARENA_LEVEL].slabs || arenas[ARENA_CACHE].slabs || arenas[ARENA_CACHE].live)
+        I_Error("arenas not dropped: %d level slabs, %d cache slabs", (int)arenas[ARENA_LEVEL].slabs,
+                (int)arenas[ARENA_CACHE].slabs);
+    for (int i = 0; i < 1000; i++)
+        if (cache[i])
+            I_Error("cache owner %d not cleared", i);
+    if (retagged || arenas[ARENA_STATIC].live)
+        I_Error("retagged block not freed");
+
+    // A locked lump (cache arena, PU_STATIC) keeps the arena, the purge goes block by block
+    for (int i = 0; i < 1000; i++)
+        (Z_Malloc)(16 + i % 400, PU_CACHE, &cache[i]);
+    (Z_Malloc)(64, PU_CACHE, &locked);
+    (Z_ChangeTag)(locked, PU_STATIC);
+    memset(locked, 0x5A, 64);
+
+    (Z_FreeTags)(PU_LEVEL, PU_CACHE, -1);
+    for (int i = 0; i < 1000; i++)
+        if (cache[i])
+            I_Error("cache owner %d not cleared", i);
+    if (!locked || arenas[ARENA_CACHE].live != 1 || ((unsigned char *)locked)[63] != 0x5A)
+        I_Error("locked block lost");
+    (Z_Free)(locked);
+}
+
+// Time to purge a full cache, through the arena drop and block by block
+static void cache_purge_timing(void)
+{
+    static void *cache[20000];
+    double drop = 0, blocks = 0;
+
+    for (int round = 0; round < 20; round++)
+    {
+        for (int i = 0; i < 20000; i++)
+            (Z_Malloc)(16 + i % 500, PU_CACHE, &cache[i]);
+        double t0 = now_ms();
+        if (round & 1)
+            (Z_FreeTags)(PU_CACHE, PU_CACHE, 1 << 30); // A max disables the drop
+        else
+            (Z_FreeTags)(PU_CACHE, PU_CACHE, -1);
+        double t1 = now_ms();
+        *(round & 1 ? &blocks : &drop) += t1 - t0;
+    }
+
+    printf("purge of 20000 cache blocks: %.2f ms with the arena drop, %.2f ms block by block\n", drop / 10, blocks / 10);
+}
+
+// Simulated level loads: many small unowned level blocks, a few big arrays and cache churn
+static void level_cycle(int levels)
+{
+    static void *cache[512];
+
+    rnd_state = 7;
+    double t0 = now_ms();
+    for (int l = 0; l < levels; l++)
+    {
+        (Z_FreeTags)(PU_LEVEL, PU_CACHE, -1);
+        for (int k = 0; k < 8; k++)
+            (Z_Malloc)(10000 + rnd() % 60000, PU_LEVEL, NULL);
+        for (int k = 0; k < 6000; k++)
+            (Z_Malloc)(16 + rnd() % 200, PU_LEVEL, NULL);
+        for (int k = 0; k < 3000; k++)
+        {
+            void *p = (Z_Malloc)(24 + rnd() % 150, PU_LEVSPEC, NULL);
+            if (k & 1)
+                (Z_Free)(p);
+        }
+        for (int k = 0; k < 20000; k++)
+        {
+            int c = rnd() % 512;
+            if (!cache[c])
+                (Z_Malloc)(64 + rnd() % 1200, PU_CACHE, &cache[c]);
+        }
+    }
+    printf("%d level cycles: %.1f ms\n", levels, now_ms() - t0);
+}
+
+int main(int argc, char **argv)
+{
+    int operations = argc > 1 ? atoi(argv[1]) : 2000000;
+
+    stress(operations);
+    arena_drops();
+    cache_purge_timing();
+    level_cycle(200);
+    Z_Close();
+
+    printf("OK\n");
+    return 0;
+}